@@ -9,7 +9,7 @@ public class JoltBridge : ModuleRules
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 		OptimizeCode = CodeOptimization.InShippingBuildsOnly;
 		
-		/*PublicDefinitions.Add("JPH_DOUBLE_PRECISION");*/ // Uncomment this if you want double precision. This is 8-10% slower than single precision
+		// JPH_DOUBLE_PRECISION (large world mode) comes from UnrealJoltLibrary, see MBuildUtils.UseDoublePrecision
 		
 		PublicIncludePaths.AddRange(
 			new string[] {
@@ -47,7 +47,8 @@ public class JoltBridge : ModuleRules
 				"JoltNativeTags",
 				"GameplayTags",
 				"UnrealJoltLibrary",
-				"PhysicsCore"
+				"PhysicsCore",
+				"Landscape"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/BaseClasses/JoltSkeletalMeshComponent.h"
+#include "Core/Singletons/JoltPhysicsWorldSubsystem.h"
+
+
+UJoltSkeletalMeshComponent::UJoltSkeletalMeshComponent(const FObjectInitializer& ObjectInitializer)
+	:Super(ObjectInitializer)
+{
+	// Physics asset bodies are driven by animation, never by the Jolt simulation
+	ShapeOptions.ShapeType = EJoltShapeType::KINEMATIC;
+	ShapeOptions.bAutomaticallyActivate = true;
+	
+	SetGenerateOverlapEvents(ShapeOptions.bGenerateOverlapEventsInChaos);
+}
+
+
+void UJoltSkeletalMeshComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+	SetGenerateOverlapEvents(ShapeOptions.bGenerateOverlapEventsInChaos);
+}
+
+void UJoltSkeletalMeshComponent::OnUnregister()
+{
+	// The compound follows this component's pose every step, it cannot outlive it
+	if (const UWorld* World = GetWorld())
+	{
+		if (UJoltPhysicsWorldSubsystem* Subsystem = World->GetSubsystem<UJoltPhysicsWorldSubsystem>())
+		{
+			Subsystem->UnregisterJoltComponent(this);
+		}
+	}
+	
+	Super::OnUnregister();
+}
+
+bool UJoltSkeletalMeshComponent::UpdateOverlapsImpl(const TOverlapArrayView* PendingOverlaps, bool bDoNotifies, const TOverlapArrayView* OverlapsAtEndLocation)
+{
+	if (!ShapeOptions.bGenerateOverlapEventsInChaos) return true;
+	
+	return Super::UpdateOverlapsImpl(PendingOverlaps, bDoNotifies, OverlapsAtEndLocation);
+}
@@ -4,6 +4,11 @@
 #include "Core/Collision/JoltCallBackContactListener.h"
 #include "Core/Libraries/JoltBridgeLibrary.h"
 
+FJoltCallBackContactListener::FJoltCallBackContactListener(const int32 MaxBodies)
+{
+	BodyContactOverrides.SetNum(FMath::Max(MaxBodies, 0));
+}
+
 JPH::ValidateResult FJoltCallBackContactListener::OnContactValidate(const JPH::Body& inBody1, const JPH::Body& inBody2, JPH::RVec3Arg inBaseOffset, const JPH::CollideShapeResult& inCollisionResult)
 {
 	return ContactListener::OnContactValidate(inBody1, inBody2, inBaseOffset, inCollisionResult);
@@ -19,6 +24,8 @@ void FJoltCallBackContactListener::OnContactAdded(const JPH::Body& inBody1, cons
 		ioSettings.mIsSensor = true;
 		bIsAnOverlap = true;
 	}
+	
+	ApplyBodyContactOverrides(inBody1, inBody2, ioSettings);
 	EstimateCollisionResponse(inBody1, inBody2, inManifold, result, ioSettings.mCombinedFriction, ioSettings.mCombinedRestitution);
 
 	for (uint8 i = 0; const JPH::CollisionEstimationResult::Impulse& impulse : result.mImpulses)
@@ -44,7 +51,8 @@ void FJoltCallBackContactListener::OnContactAdded(const JPH::Body& inBody1, cons
 
 void FJoltCallBackContactListener::OnContactPersisted(const JPH::Body& inBody1, const JPH::Body& inBody2, const JPH::ContactManifold& inManifold, JPH::ContactSettings& ioSettings)
 {
-	// return ContactListener::OnContactPersisted(inBody1, inBody2, inManifold, ioSettings);
+	// Jolt recombines friction/restitution every frame, so the overrides need to be re-applied for persisted contacts as well.
+	ApplyBodyContactOverrides(inBody1, inBody2, ioSettings);
 }
 
 void FJoltCallBackContactListener::OnContactRemoved(const JPH::SubShapeIDPair& inSubShapePair) 
@@ -54,3 +62,77 @@ void FJoltCallBackContactListener::OnContactRemoved(const JPH::SubShapeIDPair& i
 		FContactRemovedInfo(inSubShapePair.GetBody1ID().GetIndexAndSequenceNumber(), inSubShapePair.GetBody2ID().GetIndexAndSequenceNumber())
 	);
 };
+
+void FJoltCallBackContactListener::SetBodyContactOverride(const JPH::BodyID& BodyID, const FJoltBodyContactOverride& Override)
+{
+	const int32 Index = static_cast<int32>(BodyID.GetIndex());
+	if (!BodyContactOverrides.IsValidIndex(Index)) return;
+	
+	FJoltBodyContactOverride& Entry = BodyContactOverrides[Index];
+	NumActiveContactOverrides += (Override.IsActive() ? 1 : 0) - (Entry.IsActive() ? 1 : 0);
+	Entry = Override;
+}
+
+void FJoltCallBackContactListener::ClearBodyContactOverride(const JPH::BodyID& BodyID)
+{
+	SetBodyContactOverride(BodyID, FJoltBodyContactOverride());
+}
+
+void FJoltCallBackContactListener::ClearAllBodyContactOverrides()
+{
+	for (FJoltBodyContactOverride& Entry : BodyContactOverrides)
+	{
+		Entry = FJoltBodyContactOverride();
+	}
+	NumActiveContactOverrides = 0;
+}
+
+const FJoltBodyContactOverride* FJoltCallBackContactListener::GetBodyContactOverride(const JPH::BodyID& BodyID) const
+{
+	const int32 Index = static_cast<int32>(BodyID.GetIndex());
+	return BodyContactOverrides.IsValidIndex(Index) ? &BodyContactOverrides[Index] : nullptr;
+}
+
+void FJoltCallBackContactListener::ApplyBodyContactOverrides(const JPH::Body& inBody1, const JPH::Body& inBody2, JPH::ContactSettings& ioSettings) const
+{
+	if (NumActiveContactOverrides == 0) return;
+	
+	const FJoltBodyContactOverride* O1 = GetBodyContactOverride(inBody1.GetID());
+	const FJoltBodyContactOverride* O2 = GetBodyContactOverride(inBody2.GetID());
+	const bool bHas1 = O1 && O1->IsActive();
+	const bool bHas2 = O2 && O2->IsActive();
+	if (!bHas1 && !bHas2) return;
+	
+	// When both bodies override, the lowest friction and the highest restitution win.
+	// This keeps a mover that zeroes its friction frictionless against everything it touches.
+	if (bHas1 && O1->bOverrideFriction && bHas2 && O2->bOverrideFriction)
+	{
+		ioSettings.mCombinedFriction = FMath::Min(O1->Friction, O2->Friction);
+	}
+	else if (bHas1 && O1->bOverrideFriction)
+	{
+		ioSettings.mCombinedFriction = O1->Friction;
+	}
+	else if (bHas2 && O2->bOverrideFriction)
+	{
+		ioSettings.mCombinedFriction = O2->Friction;
+	}
+	
+	if (bHas1 && O1->bOverrideRestitution && bHas2 && O2->bOverrideRestitution)
+	{
+		ioSettings.mCombinedRestitution = FMath::Max(O1->Restitution, O2->Restitution);
+	}
+	else if (bHas1 && O1->bOverrideRestitution)
+	{
+		ioSettings.mCombinedRestitution = O1->Restitution;
+	}
+	else if (bHas2 && O2->bOverrideRestitution)
+	{
+		ioSettings.mCombinedRestitution = O2->Restitution;
+	}
+	
+	// Jolt expects the world space surface velocity of body 2 minus that of body 1 (conveyor belt style).
+	const JPH::Vec3 Surface1 = (bHas1 && O1->bOverrideSurfaceVelocity) ? JPH::Vec3(O1->SurfaceVelocity) : JPH::Vec3::sZero();
+	const JPH::Vec3 Surface2 = (bHas2 && O2->bOverrideSurfaceVelocity) ? JPH::Vec3(O2->SurfaceVelocity) : JPH::Vec3::sZero();
+	ioSettings.mRelativeLinearSurfaceVelocity = Surface2 - Surface1;
+}
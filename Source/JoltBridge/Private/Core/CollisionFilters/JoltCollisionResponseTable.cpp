@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/CollisionFilters/JoltCollisionResponseTable.h"
+#include "JoltBridgeLogChannels.h"
+
+FJoltCollisionResponseTable::FJoltCollisionResponseTable()
+	: CombinedRows(MakeUnique<uint32[]>(MaxProfiles))
+	, BlockRows(MakeUnique<uint32[]>(MaxProfiles))
+	, OverlapRows(MakeUnique<uint32[]>(MaxProfiles))
+{
+	Reset();
+}
+
+uint16 FJoltCollisionResponseTable::FindOrAddProfile(const uint32 BlockMask, const uint32 OverlapMask, const uint32 CombinedMask)
+{
+	const TTuple<uint32, uint32, uint32> Key(BlockMask, OverlapMask, CombinedMask);
+	if (const uint16* ID = ProfileIDs.Find(Key))
+	{
+		return *ID;
+	}
+	
+	if (NumProfiles >= MaxProfiles)
+	{
+		if (!bWarnedFull)
+		{
+			UE_LOG(LogJoltBridge, Warning, TEXT("FJoltCollisionResponseTable: more than %d response profiles, the rest collide with everything"), MaxProfiles);
+			bWarnedFull = true;
+		}
+		return 0;
+	}
+	
+	const uint16 ID = (uint16)NumProfiles++;
+	CombinedRows[ID] = CombinedMask;
+	BlockRows[ID] = BlockMask;
+	OverlapRows[ID] = OverlapMask;
+	ProfileIDs.Add(Key, ID);
+	return ID;
+}
+
+void FJoltCollisionResponseTable::Reset()
+{
+	ProfileIDs.Reset();
+	NumProfiles = 0;
+	bWarnedFull = false;
+	
+	FindOrAddProfile(~0u, 0u, ~0u);
+}
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/DataTypes/JoltUserDataArena.h"
+#include "JoltBridgeLogChannels.h"
+
+void FJoltUserDataArena::Reserve(const int32 NumEntries)
+{
+	Hot.Reserve(FMath::Min<int32>(NumEntries, IndexMask + 1));
+}
+
+FJoltUserData* FJoltUserDataArena::Alloc()
+{
+	uint32 Index;
+	if (!FreeSlots.IsEmpty())
+	{
+		Index = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		if ((uint32)NumSlots > IndexMask)
+		{
+			UE_LOG(LogJoltBridge, Error, TEXT("FJoltUserDataArena: out of handles (%d slots)"), NumSlots);
+			return nullptr;
+		}
+		
+		if (NumSlots == Chunks.Num() * ChunkSize)
+		{
+			Chunks.Add(MakeUnique<FJoltUserData[]>(ChunkSize));
+		}
+		if (Hot.Num() == Hot.Max() && Hot.Max() > 0)
+		{
+			UE_LOG(LogJoltBridge, Warning, TEXT("FJoltUserDataArena: more user data than reserved (%d), growing the hot array"), Hot.Max());
+		}
+		Index = NumSlots++;
+		Hot.AddDefaulted();
+	}
+	
+	FJoltUserData& UserData = GetSlot(Index);
+	UserData = FJoltUserData();
+	UserData.Handle = Index | ((uint32)Hot[Index].Generation << GenerationShift);
+	return &UserData;
+}
+
+void FJoltUserDataArena::Free(const FJoltUserData* UserData)
+{
+	if (!UserData || UserData->Magic != FJoltUserData::MagicValue) return;
+	
+	const uint32 Index = UserData->Handle & IndexMask;
+	if (Index >= (uint32)NumSlots || &GetSlot(Index) != UserData) return;
+	
+	FJoltUserDataHot& Entry = Hot[Index];
+	const uint8 Generation = Entry.Generation + 1;
+	Entry = FJoltUserDataHot();
+	Entry.Generation = Generation;
+	
+	FJoltUserData& Slot = GetSlot(Index);
+	Slot = FJoltUserData();
+	Slot.Magic = 0;
+	FreeSlots.Add(Index);
+}
+
+void FJoltUserDataArena::Reset()
+{
+	Chunks.Empty();
+	Hot.Reset();
+	ResponseTable.Reset();
+	FreeSlots.Empty();
+	NumSlots = 0;
+}
+
+void FJoltUserDataArena::SyncHot(const FJoltUserData& UserData)
+{
+	const uint32 Index = UserData.Handle & IndexMask;
+	if (UserData.Handle == FJoltUserData::InvalidHandle || Index >= (uint32)NumSlots) return;
+	
+	FJoltUserDataHot& Entry = Hot[Index];
+	Entry.ResponseProfile = ResponseTable.FindOrAddProfile(UserData.BlockMask, UserData.OverlapMask, UserData.CombinedMask);
+	Entry.ObjectChannel = UserData.ObjectChannel;
+	Entry.bQueryEnabled = UserData.bQueryEnabled;
+	Entry.bPhysicsEnabled = UserData.bPhysicsEnabled;
+	Entry.bGenerateOverlapEvents = UserData.bGenerateOverlapEvents;
+	Entry.bGenerateHitEvents = UserData.bGenerateHitEvents;
+}
+
+FJoltUserData* FJoltUserDataArena::Get(const uint32 Handle) const
+{
+	const uint32 Index = Handle & IndexMask;
+	if (!FindHot(Handle) || Index >= (uint32)NumSlots) return nullptr;
+	return &GetSlot(Index);
+}
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JoltBridgeMain.h"
+#include "JoltBridgeLogChannels.h"
+#include "Core/CollisionFilters/UnrealGroupFilter.h"
+#include "Core/Libraries/JoltBridgeLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+// Times the group filter check on random body pairs, the way narrowphase calls it. The old path unpacks a pointer to each
+// body's heap allocated FJoltUserData, checks its Magic and tests the masks. The current one goes through the arena handles,
+// hot entries and response table rows of FUnrealGroupFilter. Both must agree on every pair.
+static FAutoConsoleCommand BenchmarkPairFilterCmd(TEXT("j.debug.BenchmarkPairFilter"), TEXT("Times the body pair collision filter. Args: [NumBodies=10000] [NumPairs=4000000] [NumProfiles=16]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+{
+	const int32 NumBodies = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 2, 1 << 20) : 10000;
+	const int32 NumPairs = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 4000000;
+	const int32 NumProfiles = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 1, FJoltCollisionResponseTable::MaxProfiles - 1) : 16;
+
+	FRandomStream Random(0x5EED);
+
+	// Mostly blocking, some overlapping, some ignoring, like a project's collision profiles
+	TArray<FCollisionResponseContainer> Profiles;
+	for (int32 i = 0; i < NumProfiles; ++i)
+	{
+		FCollisionResponseContainer& Responses = Profiles.AddDefaulted_GetRef();
+		for (int32 Channel = 0; Channel < 32; ++Channel)
+		{
+			const float Roll = Random.FRand();
+			Responses.SetResponse((ECollisionChannel)Channel, Roll < 0.6f ? ECR_Block : Roll < 0.8f ? ECR_Overlap : ECR_Ignore);
+		}
+	}
+
+	FJoltUserDataArena Arena;
+	Arena.Reserve(NumBodies);
+	TArray<TUniquePtr<FJoltUserData>> LegacyUserData;
+	TArray<uint32> Handles;
+	LegacyUserData.Reserve(NumBodies);
+	Handles.Reserve(NumBodies);
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		FJoltUserData* UserData = Arena.Alloc();
+		if (!UserData) break;
+
+		JoltHelpers::BuildResponseMasks(Profiles[Random.RandHelper(NumProfiles)], UserData->BlockMask, UserData->OverlapMask, UserData->CombinedMask);
+		UserData->ObjectChannel = (uint8)Random.RandHelper(32);
+		Arena.SyncHot(*UserData);
+
+		Handles.Add(UserData->Handle);
+		LegacyUserData.Add(MakeUnique<FJoltUserData>(*UserData));
+	}
+
+	const int32 NumCreated = Handles.Num();
+	TArray<JPH::CollisionGroup> GroupsA, GroupsB;
+	TArray<TPair<uint32, uint32>> LegacyGroupsA, LegacyGroupsB;
+	GroupsA.Reserve(NumPairs);
+	GroupsB.Reserve(NumPairs);
+	LegacyGroupsA.Reserve(NumPairs);
+	LegacyGroupsB.Reserve(NumPairs);
+	for (int32 i = 0; i < NumPairs; ++i)
+	{
+		const int32 A = Random.RandHelper(NumCreated);
+		const int32 B = Random.RandHelper(NumCreated);
+		GroupsA.Emplace(nullptr, Handles[A], JPH::CollisionGroup::cInvalidSubGroup);
+		GroupsB.Emplace(nullptr, Handles[B], JPH::CollisionGroup::cInvalidSubGroup);
+
+		uint32 Lo, Hi;
+		JoltHelpers::PackDataToGroupIDs(LegacyUserData[A].Get(), Lo, Hi);
+		LegacyGroupsA.Emplace(Lo, Hi);
+		JoltHelpers::PackDataToGroupIDs(LegacyUserData[B].Get(), Lo, Hi);
+		LegacyGroupsB.Emplace(Lo, Hi);
+	}
+
+	// Not handed to any CollisionGroup, so nothing holds a reference to it
+	const FUnrealGroupFilter Filter(&Arena);
+
+	int32 LegacyAllowed = 0;
+	double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumPairs; ++i)
+	{
+		const FJoltUserData* UA = JoltHelpers::UnpackDataFromGroupIDs<FJoltUserData>(LegacyGroupsA[i].Key, LegacyGroupsA[i].Value);
+		const FJoltUserData* UB = JoltHelpers::UnpackDataFromGroupIDs<FJoltUserData>(LegacyGroupsB[i].Key, LegacyGroupsB[i].Value);
+		const bool bKnown = UA && UA->Magic == FJoltUserData::MagicValue && UB && UB->Magic == FJoltUserData::MagicValue;
+		LegacyAllowed += (!bKnown || JoltHelpers::IsAnyCollisionAllowed(UA, UB)) ? 1 : 0;
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - Start;
+
+	int32 Allowed = 0;
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumPairs; ++i)
+	{
+		Allowed += Filter.CanCollide(GroupsA[i], GroupsB[i]) ? 1 : 0;
+	}
+	const double TableSeconds = FPlatformTime::Seconds() - Start;
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < NumPairs; ++i)
+	{
+		const FJoltUserData* UA = LegacyUserData[GroupsA[i].GetGroupID() & FJoltUserDataArena::IndexMask].Get();
+		const FJoltUserData* UB = LegacyUserData[GroupsB[i].GetGroupID() & FJoltUserDataArena::IndexMask].Get();
+		Mismatches += JoltHelpers::IsAnyCollisionAllowed(UA, UB) != Filter.CanCollide(GroupsA[i], GroupsB[i]) ? 1 : 0;
+	}
+
+	const double LegacyNs = LegacySeconds * 1e9 / NumPairs;
+	const double TableNs = TableSeconds * 1e9 / NumPairs;
+	UE_LOG(LogJoltBridge, Display, TEXT("Pair filter: %d bodies, %d response profiles, %d pairs, %d allowed"), NumCreated, Arena.GetResponseTable().Num() - 1, NumPairs, Allowed);
+	UE_LOG(LogJoltBridge, Display, TEXT("  user data pointers %.2fns/pair, response table %.2fns/pair (%.2fx)"), LegacyNs, TableNs, TableNs > 0.0 ? LegacyNs / TableNs : 0.0);
+	if (Mismatches > 0 || LegacyAllowed != Allowed)
+	{
+		UE_LOG(LogJoltBridge, Error, TEXT("  %d pairs disagree with JoltHelpers::IsAnyCollisionAllowed"), Mismatches);
+	}
+}));
@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JoltBridgeMain.h"
+#include "JoltBridgeLogChannels.h"
+#include "Core/CollisionFilters/JoltFilters.h"
+#include "HAL/IConsoleManager.h"
+
+// Drops a grid of spheres onto a floor DistanceKm away from the origin in a standalone Jolt system, then times the steps and
+// measures how much the resting spheres still move. Run it in the single and double precision builds of the Jolt library
+// (JoltPhysics.Build bDoublePrecision) at a few distances to compare their cost and stability.
+static FAutoConsoleCommand BenchmarkPrecisionCmd(TEXT("j.debug.BenchmarkPrecision"), TEXT("Times and checks stability of a Jolt scene far from the origin. Args: [DistanceKm=0] [NumBodies=1024] [NumSteps=600]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+{
+	if (!JPH::Factory::sInstance)
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("j.debug.BenchmarkPrecision needs Jolt to be initialized, start play first"));
+		return;
+	}
+
+	const double DistanceKm = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 0.0;
+	const int32 NumBodies = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 65536) : 1024;
+	const int32 NumSteps = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 120) : 600;
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr float Radius = 0.5f;
+
+	FBroadPhaseLayerInterfaceImpl BroadPhaseLayers;
+	ObjectVsBroadPhaseLayerFilterImpl ObjectVsBroadPhaseFilter;
+	ObjectLayerPairFilterImpl ObjectPairFilter;
+
+	JPH::PhysicsSystem System;
+	System.Init(NumBodies + 1, 0, NumBodies + 1, NumBodies * 4, BroadPhaseLayers, ObjectVsBroadPhaseFilter, ObjectPairFilter);
+	JPH::TempAllocatorImpl TempAllocator(32 * 1024 * 1024);
+	JPH::JobSystemSingleThreaded JobSystem(JPH::cMaxPhysicsJobs);
+	JPH::BodyInterface& Bodies = System.GetBodyInterfaceNoLock();
+
+	const JPH::RVec3 Center(JPH::Real(DistanceKm * 1000.0), 0, 0);
+	const int32 GridSide = FMath::CeilToInt(FMath::Sqrt((float)NumBodies));
+	const float HalfExtent = GridSide * Radius * 2.f;
+
+	JPH::BodyCreationSettings FloorSettings(new JPH::BoxShape(JPH::Vec3(HalfExtent + 1.f, 1.f, HalfExtent + 1.f)), Center - JPH::RVec3(0, 1, 0), JPH::Quat::sIdentity(), JPH::EMotionType::Static, Layers::NON_MOVING);
+	Bodies.CreateAndAddBody(FloorSettings, JPH::EActivation::DontActivate);
+
+	JPH::RefConst<JPH::Shape> Sphere = new JPH::SphereShape(Radius);
+	TArray<JPH::BodyID> SphereIDs;
+	SphereIDs.Reserve(NumBodies);
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		const JPH::RVec3 Offset((i % GridSide) * Radius * 2.f - HalfExtent + Radius, Radius + 0.25f, (i / GridSide) * Radius * 2.f - HalfExtent + Radius);
+		JPH::BodyCreationSettings SphereSettings(Sphere, Center + Offset, JPH::Quat::sIdentity(), JPH::EMotionType::Dynamic, Layers::MOVING);
+		SphereSettings.mAllowSleeping = false;
+		SphereIDs.Add(Bodies.CreateAndAddBody(SphereSettings, JPH::EActivation::Activate));
+	}
+	System.OptimizeBroadPhase();
+
+	// The last second is spent at rest, anything still moving then is numerical noise
+	const int32 SettleSteps = NumSteps - 60;
+	double MaxRestSpeed = 0.0;
+	double MaxRestDrift = 0.0;
+
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		System.Update(DeltaTime, 1, &TempAllocator, &JobSystem);
+		if (Step < SettleSteps) continue;
+
+		for (const JPH::BodyID& ID : SphereIDs)
+		{
+			MaxRestSpeed = FMath::Max(MaxRestSpeed, (double)Bodies.GetLinearVelocity(ID).Length());
+			MaxRestDrift = FMath::Max(MaxRestDrift, FMath::Abs((double)(Bodies.GetPosition(ID).GetY() - Center.GetY()) - Radius));
+		}
+	}
+	const double StepMs = (FPlatformTime::Seconds() - Start) * 1000.0 / NumSteps;
+
+#ifdef JPH_DOUBLE_PRECISION
+	const TCHAR* Mode = TEXT("double");
+#else
+	const TCHAR* Mode = TEXT("single");
+#endif
+	UE_LOG(LogJoltBridge, Display, TEXT("Precision benchmark (%s precision): %d bodies at %.1fkm, %d steps"), Mode, NumBodies, DistanceKm, NumSteps);
+	UE_LOG(LogJoltBridge, Display, TEXT("  %.3fms per step, resting max speed %.6fm/s, max height error %.6fm"), StepMs, MaxRestSpeed, MaxRestDrift);
+}));
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "JoltBridgeMain.h"
+#include "JoltBridgeLogChannels.h"
+#include "Core/CollisionFilters/JoltFilters.h"
+#include "Core/Singletons/JoltPhysicsWorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+// Moves NumBodies kinematic bodies every frame and times bringing their components along, first one body at a time the way
+// movers used to (GetCenterOfMassTransform + SetWorldTransform), then through UJoltPhysicsWorldSubsystem::WriteBackTransforms.
+// The bodies are moved outside the timed part, without stepping the world. Components belong to one actor and are not attached,
+// so neither path pays for children. Other write backs registered in the world are part of the batched time.
+static void BenchmarkTransformWriteBack(UWorld* World, UJoltPhysicsWorldSubsystem* Subsystem, const int32 NumBodies, const int32 NumFrames, const float MovingFraction)
+{
+	JPH::BodyInterface& Bodies = *Subsystem->GetBodyInterface();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	USceneComponent* Root = NewObject<USceneComponent>(Owner);
+	Root->SetMobility(EComponentMobility::Movable);
+	Owner->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	JPH::RefConst<JPH::Shape> Sphere = new JPH::SphereShape(0.5f);
+	TArray<JPH::BodyID> BodyIDs;
+	TArray<USceneComponent*> Components;
+	TArray<JPH::RVec3> Origins;
+	BodyIDs.Reserve(NumBodies);
+	Components.Reserve(NumBodies);
+	Origins.Reserve(NumBodies);
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		const JPH::RVec3 Origin(JPH::Real((i % 100) * 2), JPH::Real(1000), JPH::Real((i / 100) * 2));
+		JPH::BodyCreationSettings Settings(Sphere, Origin, JPH::Quat::sIdentity(), JPH::EMotionType::Kinematic, Layers::MOVING);
+		const JPH::BodyID ID = Bodies.CreateAndAddBody(Settings, JPH::EActivation::DontActivate);
+		if (ID.IsInvalid()) break;
+
+		USceneComponent* Component = NewObject<USceneComponent>(Owner);
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->RegisterComponent();
+
+		BodyIDs.Add(ID);
+		Components.Add(Component);
+		Origins.Add(Origin);
+	}
+
+	const int32 NumCreated = BodyIDs.Num();
+	const int32 NumMoving = FMath::Clamp(FMath::RoundToInt32(NumCreated * MovingFraction), 0, NumCreated);
+	auto MoveBodies = [&](const int32 Frame)
+	{
+		const JPH::Quat Rotation = JPH::Quat::sRotation(JPH::Vec3::sAxisY(), Frame * 0.05f);
+		for (int32 i = 0; i < NumMoving; ++i)
+		{
+			Bodies.SetPositionAndRotation(BodyIDs[i], Origins[i] + JPH::RVec3(0, FMath::Sin(Frame * 0.1f), 0), Rotation, JPH::EActivation::DontActivate);
+		}
+	};
+
+	double PerBodySeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MoveBodies(Frame);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumCreated; ++i)
+		{
+			Components[i]->SetWorldTransform(JoltHelpers::ToUnrealTransform(Bodies.GetCenterOfMassTransform(BodyIDs[i])));
+		}
+		PerBodySeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	for (int32 i = 0; i < NumCreated; ++i)
+	{
+		Subsystem->AddTransformWriteBack(Components[i], BodyIDs[i], FTransform::Identity, /*bCenterOfMass*/true);
+	}
+
+	// The first pass sorts the new write backs and moves every component
+	Subsystem->WriteBackTransforms();
+
+	double BatchedSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MoveBodies(NumFrames + Frame);
+
+		const double Start = FPlatformTime::Seconds();
+		Subsystem->WriteBackTransforms();
+		BatchedSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	for (USceneComponent* Component : Components)
+	{
+		Subsystem->RemoveTransformWriteBack(Component);
+	}
+	Bodies.RemoveBodies(BodyIDs.GetData(), NumCreated);
+	Bodies.DestroyBodies(BodyIDs.GetData(), NumCreated);
+	Owner->Destroy();
+
+	const double PerBodyMs = PerBodySeconds * 1000.0 / NumFrames;
+	const double BatchedMs = BatchedSeconds * 1000.0 / NumFrames;
+	UE_LOG(LogJoltBridge, Display, TEXT("Transform write back: %d bodies, %d moving, %d frames"), NumCreated, NumMoving, NumFrames);
+	UE_LOG(LogJoltBridge, Display, TEXT("  per body %.3fms/frame, batched %.3fms/frame (%.2fx)"), PerBodyMs, BatchedMs, BatchedMs > 0.0 ? PerBodyMs / BatchedMs : 0.0);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkTransformWriteBackCmd(TEXT("j.debug.BenchmarkTransformWriteBack"), TEXT("Times per body vs batched physics to component transform write back. Args: [NumBodies=0 (1k, 5k and 10k)] [NumFrames=120] [MovingFraction=1]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+{
+	UJoltPhysicsWorldSubsystem* Subsystem = World ? World->GetSubsystem<UJoltPhysicsWorldSubsystem>() : nullptr;
+	if (!Subsystem || !Subsystem->GetBodyInterface())
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("j.debug.BenchmarkTransformWriteBack needs a Jolt world, start play first"));
+		return;
+	}
+
+	const int32 NumBodies = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 0, 65536) : 0;
+	const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 120;
+	const float MovingFraction = Args.Num() > 2 ? FMath::Clamp(FCString::Atof(*Args[2]), 0.f, 1.f) : 1.f;
+
+	if (NumBodies > 0)
+	{
+		BenchmarkTransformWriteBack(World, Subsystem, NumBodies, NumFrames, MovingFraction);
+		return;
+	}
+
+	for (const int32 Num : { 1000, 5000, 10000 })
+	{
+		BenchmarkTransformWriteBack(World, Subsystem, Num, NumFrames, MovingFraction);
+	}
+}));
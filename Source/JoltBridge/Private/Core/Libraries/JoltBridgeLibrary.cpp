@@ -2,3 +2,218 @@
 
 
 #include "Core/Libraries/JoltBridgeLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+namespace JoltConversion
+{
+	// UE is Z up and Jolt is Y up, positions and quaternions both swap their Y and Z lanes
+	FORCEINLINE VectorRegister4Float SwapYZ(const VectorRegister4Float& V)
+	{
+		return VectorSwizzle(V, 0, 2, 1, 3);
+	}
+	
+	FORCEINLINE VectorRegister4Double SwapYZ(const VectorRegister4Double& V)
+	{
+		return VectorSwizzle(V, 0, 2, 1, 3);
+	}
+	
+	// The Y/Z swap mirrors the basis, which negates the quaternion's vector part
+	FORCEINLINE VectorRegister4Float MirrorSigns()
+	{
+		return MakeVectorRegisterFloat(-1.f, -1.f, -1.f, 1.f);
+	}
+}
+
+void JoltHelpers::ToJoltTransforms(TConstArrayView<FTransform> In, TArrayView<FJoltPackedTransform> Out, const FVector& WorldOrigin)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::ToJoltTransforms);
+	check(In.Num() == Out.Num());
+	using namespace JoltConversion;
+	
+	const VectorRegister4Double Origin = VectorLoadFloat3(&WorldOrigin.X);
+#ifdef JPH_DOUBLE_PRECISION
+	const VectorRegister4Double Scale = MakeVectorRegisterDouble(WORLD_TO_JOLT_POSITION_SCALE, WORLD_TO_JOLT_POSITION_SCALE, WORLD_TO_JOLT_POSITION_SCALE, 0.0);
+#else
+	const VectorRegister4Float Scale = MakeVectorRegisterFloat(WORLD_TO_JOLT_SCALE, WORLD_TO_JOLT_SCALE, WORLD_TO_JOLT_SCALE, 0.f);
+#endif
+	const VectorRegister4Float Signs = MirrorSigns();
+	
+	for (int32 i = 0; i < In.Num(); ++i)
+	{
+		const FVector Translation = In[i].GetTranslation();
+		const FQuat Rotation = In[i].GetRotation();
+		
+#ifdef JPH_DOUBLE_PRECISION
+		// Same order as ToJoltPosition: offset and scale in double
+		const VectorRegister4Double Position = VectorSubtract(VectorLoadFloat3(&Translation.X), Origin);
+		VectorStore(VectorMultiply(SwapYZ(Position), Scale), Out[i].Position);
+#else
+		// Same order as ToJoltPosition: offset in double, round to float, then scale in float
+		const VectorRegister4Float Position = MakeVectorRegisterFloatFromDouble(VectorSubtract(VectorLoadFloat3(&Translation.X), Origin));
+		VectorStoreAligned(VectorMultiply(SwapYZ(Position), Scale), Out[i].Position);
+#endif
+		
+		const VectorRegister4Float Quat = MakeVectorRegisterFloatFromDouble(VectorLoad(&Rotation.X));
+		VectorStoreAligned(VectorMultiply(SwapYZ(Quat), Signs), Out[i].Rotation);
+	}
+}
+
+void JoltHelpers::ToUnrealTransforms(TConstArrayView<FJoltPackedTransform> In, TArrayView<FTransform> Out, const FVector& WorldOrigin)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::ToUnrealTransforms);
+	check(In.Num() == Out.Num());
+	using namespace JoltConversion;
+	
+	const VectorRegister4Double Origin = VectorLoadFloat3(&WorldOrigin.X);
+	const VectorRegister4Double Scale = MakeVectorRegisterDouble((double)JOLT_TO_WORLD_SCALE, (double)JOLT_TO_WORLD_SCALE, (double)JOLT_TO_WORLD_SCALE, 0.0);
+	const VectorRegister4Float Signs = MirrorSigns();
+	
+	for (int32 i = 0; i < In.Num(); ++i)
+	{
+		// Same order as ToUnrealPosition: widen to double, scale, then offset
+#ifdef JPH_DOUBLE_PRECISION
+		const VectorRegister4Double Position = VectorAdd(VectorMultiply(SwapYZ(VectorLoad(In[i].Position)), Scale), Origin);
+#else
+		const VectorRegister4Double Position = VectorAdd(VectorMultiply(MakeVectorRegisterDouble(SwapYZ(VectorLoadAligned(In[i].Position))), Scale), Origin);
+#endif
+		const VectorRegister4Double Quat = MakeVectorRegisterDouble(VectorMultiply(SwapYZ(VectorLoadAligned(In[i].Rotation)), Signs));
+		
+		FVector Translation;
+		FQuat Rotation;
+		VectorStoreFloat3(Position, &Translation.X);
+		VectorStore(Quat, &Rotation.X);
+		Out[i] = FTransform(Rotation, Translation);
+	}
+}
+
+void JoltHelpers::ToJoltVectors(TConstArrayView<FVector> In, TArrayView<JPH::Float3> Out)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::ToJoltVectors);
+	check(In.Num() == Out.Num());
+	using namespace JoltConversion;
+	
+	const VectorRegister4Float Scale = VectorSetFloat1(WORLD_TO_JOLT_SCALE);
+	for (int32 i = 0; i < In.Num(); ++i)
+	{
+		const VectorRegister4Float V = MakeVectorRegisterFloatFromDouble(VectorLoadFloat3(&In[i].X));
+		VectorStoreFloat3(VectorMultiply(SwapYZ(V), Scale), &Out[i].x);
+	}
+}
+
+void JoltHelpers::ToUnrealVectors(TConstArrayView<JPH::Float3> In, TArrayView<FVector> Out)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::ToUnrealVectors);
+	check(In.Num() == Out.Num());
+	using namespace JoltConversion;
+	
+	const VectorRegister4Double Scale = MakeVectorRegisterDouble((double)JOLT_TO_WORLD_SCALE, (double)JOLT_TO_WORLD_SCALE, (double)JOLT_TO_WORLD_SCALE, 0.0);
+	for (int32 i = 0; i < In.Num(); ++i)
+	{
+		const VectorRegister4Double V = MakeVectorRegisterDouble(SwapYZ(VectorLoadFloat3(&In[i].x)));
+		VectorStoreFloat3(VectorMultiply(V, Scale), &Out[i].X);
+	}
+}
+
+// Times the batch conversions against the per element helpers over the same data, and checks that both give the same bits
+static FAutoConsoleCommand BenchmarkConversionsCmd(TEXT("j.debug.BenchmarkConversions"), TEXT("Times batch vs per element UE<->Jolt transform conversions. Args: [NumTransforms=65536] [NumPasses=32]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+{
+	const int32 NumTransforms = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 65536;
+	const int32 NumPasses = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 32;
+	const FVector WorldOrigin(1024.0, -2048.0, 512.0);
+	
+	FRandomStream Stream(NumTransforms);
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(NumTransforms);
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		const FVector Location(Stream.FRandRange(-1.0e6, 1.0e6), Stream.FRandRange(-1.0e6, 1.0e6), Stream.FRandRange(-1.0e5, 1.0e5));
+		Transforms.Emplace(FQuat(Stream.GetUnitVector(), Stream.FRandRange(-PI, PI)), Location);
+	}
+	
+	TArray<JPH::RVec3> ScalarPositions;
+	TArray<JPH::Quat> ScalarRotations;
+	ScalarPositions.SetNumUninitialized(NumTransforms);
+	ScalarRotations.SetNumUninitialized(NumTransforms);
+	TArray<FJoltPackedTransform> Packed;
+	Packed.SetNumUninitialized(NumTransforms);
+	TArray<FTransform> ScalarBack;
+	TArray<FTransform> BatchBack;
+	ScalarBack.SetNumUninitialized(NumTransforms);
+	BatchBack.SetNumUninitialized(NumTransforms);
+	
+	double Start = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 i = 0; i < NumTransforms; ++i)
+		{
+			ScalarPositions[i] = JoltHelpers::ToJoltPosition(Transforms[i].GetTranslation(), WorldOrigin);
+			ScalarRotations[i] = JoltHelpers::ToJoltRotation(Transforms[i].GetRotation());
+		}
+	}
+	const double ScalarToJoltMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	
+	Start = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		JoltHelpers::ToJoltTransforms(Transforms, Packed, WorldOrigin);
+	}
+	const double BatchToJoltMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	
+	Start = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 i = 0; i < NumTransforms; ++i)
+		{
+			ScalarBack[i] = JoltHelpers::ToUnrealTransform(JPH::RMat44::sRotationTranslation(Packed[i].GetRotation(), Packed[i].GetPosition()), WorldOrigin);
+		}
+	}
+	const double ScalarToUnrealMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	
+	Start = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		JoltHelpers::ToUnrealTransforms(Packed, BatchBack, WorldOrigin);
+	}
+	const double BatchToUnrealMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	
+	int32 NumToJoltMismatches = 0;
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		FJoltPackedTransform Expected;
+		Expected.Set(ScalarPositions[i], ScalarRotations[i]);
+		if (FMemory::Memcmp(&Expected, &Packed[i], sizeof(FJoltPackedTransform)) != 0)
+		{
+			++NumToJoltMismatches;
+		}
+	}
+	
+	// Going through a matrix re-derives the quaternion, so the translation is checked against ToUnrealTransform and the rotation
+	// against ToUnrealRotation of the packed quaternion
+	int32 NumToUnrealMismatches = 0;
+	int32 NumToUnrealRotationMismatches = 0;
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		const FVector A = ScalarBack[i].GetTranslation();
+		const FVector B = BatchBack[i].GetTranslation();
+		if (FMemory::Memcmp(&A, &B, sizeof(FVector)) != 0)
+		{
+			++NumToUnrealMismatches;
+		}
+		
+		const FQuat ExpectedRotation = JoltHelpers::ToUnrealRotation(Packed[i].GetRotation());
+		const FQuat Rotation = BatchBack[i].GetRotation();
+		if (FMemory::Memcmp(&ExpectedRotation, &Rotation, sizeof(FQuat)) != 0)
+		{
+			++NumToUnrealRotationMismatches;
+		}
+	}
+	
+	const double NumConverted = (double)NumTransforms * NumPasses;
+	UE_LOG(LogJoltBridge, Display, TEXT("Conversion benchmark: %d transforms, %d passes"), NumTransforms, NumPasses);
+	UE_LOG(LogJoltBridge, Display, TEXT("  UE->Jolt  per element %.3fms (%.1f M/s)  batch %.3fms (%.1f M/s)  mismatches %d"),
+		ScalarToJoltMs, NumConverted / (ScalarToJoltMs * 1000.0), BatchToJoltMs, NumConverted / (BatchToJoltMs * 1000.0), NumToJoltMismatches);
+	UE_LOG(LogJoltBridge, Display, TEXT("  Jolt->UE  per element %.3fms (%.1f M/s)  batch %.3fms (%.1f M/s)  translation mismatches %d  rotation mismatches %d"),
+		ScalarToUnrealMs, NumConverted / (ScalarToUnrealMs * 1000.0), BatchToUnrealMs, NumConverted / (BatchToUnrealMs * 1000.0), NumToUnrealMismatches, NumToUnrealRotationMismatches);
+}));
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Simulation/JoltActiveBodyTracker.h"
+
+FJoltActiveBodyTracker::FJoltActiveBodyTracker(const int32 MaxBodies)
+{
+	MovedBits.Init(false, MaxBodies);
+	WokenBits.Init(false, MaxBodies);
+	SleptBits.Init(false, MaxBodies);
+}
+
+void FJoltActiveBodyTracker::OnBodyActivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData)
+{
+	PendingWoken.Enqueue(inBodyID);
+}
+
+void FJoltActiveBodyTracker::OnBodyDeactivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData)
+{
+	PendingSlept.Enqueue(inBodyID);
+}
+
+void FJoltActiveBodyTracker::MarkMoved(const JPH::BodyID& BodyID)
+{
+	if (!BodyID.IsInvalid())
+	{
+		PendingMoved.Enqueue(BodyID);
+	}
+}
+
+void FJoltActiveBodyTracker::MarkAllMoved()
+{
+	bAllMovedPending = true;
+}
+
+void FJoltActiveBodyTracker::AddUnique(TArray<JPH::BodyID>& List, TBitArray<>& Bits, const JPH::BodyID& BodyID)
+{
+	const int32 Index = (int32)BodyID.GetIndex();
+	if (Index >= Bits.Num())
+	{
+		Bits.Add(false, Index + 1 - Bits.Num());
+	}
+	
+	if (!Bits[Index])
+	{
+		Bits[Index] = true;
+		List.Add(BodyID);
+	}
+}
+
+void FJoltActiveBodyTracker::EndStep(const JPH::PhysicsSystem& System)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FJoltActiveBodyTracker::EndStep);
+	
+	for (const JPH::BodyID& BodyID : MovedBodies) MovedBits[BodyID.GetIndex()] = false;
+	for (const JPH::BodyID& BodyID : WokenBodies) WokenBits[BodyID.GetIndex()] = false;
+	for (const JPH::BodyID& BodyID : SleptBodies) SleptBits[BodyID.GetIndex()] = false;
+	MovedBodies.Reset();
+	WokenBodies.Reset();
+	SleptBodies.Reset();
+	
+	bAllMoved = bAllMovedPending;
+	bAllMovedPending = false;
+	
+	JPH::BodyID BodyID;
+	while (PendingWoken.Dequeue(BodyID))
+	{
+		AddUnique(WokenBodies, WokenBits, BodyID);
+	}
+	while (PendingSlept.Dequeue(BodyID))
+	{
+		AddUnique(SleptBodies, SleptBits, BodyID);
+		AddUnique(MovedBodies, MovedBits, BodyID);
+	}
+	while (PendingMoved.Dequeue(BodyID))
+	{
+		AddUnique(MovedBodies, MovedBits, BodyID);
+	}
+	
+	// Stable while the step is not running, only bodies of this physics system are in it
+	const JPH::BodyID* ActiveBodies = System.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+	const int32 NumActiveBodies = (int32)System.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+	MovedBodies.Reserve(MovedBodies.Num() + NumActiveBodies);
+	for (int32 i = 0; i < NumActiveBodies; ++i)
+	{
+		AddUnique(MovedBodies, MovedBits, ActiveBodies[i]);
+	}
+	
+	++StepCount;
+}
+
+void FJoltActiveBodyTracker::Reset()
+{
+	PendingWoken.Empty();
+	PendingSlept.Empty();
+	PendingMoved.Empty();
+	bAllMovedPending = false;
+	bAllMoved = false;
+	
+	MovedBodies.Reset();
+	WokenBodies.Reset();
+	SleptBodies.Reset();
+	MovedBits.SetRange(0, MovedBits.Num(), false);
+	WokenBits.SetRange(0, WokenBits.Num(), false);
+	SleptBits.SetRange(0, SleptBits.Num(), false);
+}
@@ -5,10 +5,16 @@
 #include "Core/DataTypes/JoltBridgeTypes.h"
 #include "JoltBridgeCoreSettings.h"
 #include "JoltBridgeLogChannels.h"
+#include "Algo/StableSort.h"
+#include "AnimationRuntime.h"
 #include "EngineUtils.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "LandscapeProxy.h"
 #include "Components/BoxComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
 #include "Core/Collision/JoltCallBackContactListener.h"
 #include "Core/Collision/Collectors/RaycastCollector_AllHits.h"
 #include "Core/Collision/Collectors/RaycastCollector_Single.h"
@@ -18,17 +24,25 @@
 #include "Core/CollisionFilters/UnrealGroupFilter.h"
 #include "Core/Debug/JoltDebugRenderer.h"
 #include "Core/Interfaces/JoltPrimitiveComponentInterface.h"
+#include "Core/Simulation/JoltActiveBodyTracker.h"
 #include "Core/Simulation/JoltWorker.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PhysicsVolume.h"
 #include "Jolt/Physics/Body/BodyActivationListener.h"
+#include "Jolt/Physics/Body/BodyLockMulti.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/ConvexElem.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 
 int32 DrawDebugShapes = 0;
 static FAutoConsoleVariableRef CVarDrawDebugShapes(
 	TEXT("j.debug.draw.shapes"),
 	DrawDebugShapes,
-	TEXT("Show the jolt collision Shapes according to the jolt world view"),
+	TEXT("Show the jolt collision Shapes according to the jolt world view. 2 only shows the bodies that moved during the last step"),
 	ECVF_Default);
 
 float DrawDebugTraces = 0;
@@ -109,8 +123,11 @@ void UJoltPhysicsWorldSubsystem::InitPhysicsSystem(
 		*ObjectVsObjectLayerFilter);
 
 	BodyInterface = &MainPhysicsSystem->GetBodyInterface();
-	ContactListener = new FJoltCallBackContactListener();
+	ContactListener = new FJoltCallBackContactListener(cMaxBodies);
 	MainPhysicsSystem->SetContactListener(ContactListener);
+	ActiveBodyTracker = new FJoltActiveBodyTracker(cMaxBodies);
+	MainPhysicsSystem->SetBodyActivationListener(ActiveBodyTracker);
+	UserDataArena.Reserve(cMaxBodies);
 	// Spawn jolt worker
 	UE_LOG(LogJoltBridge, Log, TEXT("Jolt subsystem init complete"));
 }
@@ -128,11 +145,37 @@ void UJoltPhysicsWorldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	Super::OnWorldBeginPlay(InWorld);
 	
 	UE_LOG(LogJoltBridge, Log, TEXT("Jolt worker running "));
+	
+	// Everything loaded with the world goes in as a single batch. Play starts with these bodies, so the batch is prepared and
+	// finalized right here instead of on a task.
+	FJoltLevelBodySet InitialBodies;
+	PendingLevelBodySet = &InitialBodies;
 	AddAllJoltActors(GetWorld());
+	AddLandscapeBodies(GetWorld(), nullptr);
+	PendingLevelBodySet = nullptr;
+	
+	if (!InitialBodies.BodyIDs.IsEmpty())
+	{
+		const JPH::BodyInterface::AddState AddState = BodyInterface->AddBodiesPrepare(InitialBodies.BodyIDs.GetData(), InitialBodies.BodyIDs.Num());
+		BodyInterface->AddBodiesFinalize(InitialBodies.BodyIDs.GetData(), InitialBodies.BodyIDs.Num(), AddState, JPH::EActivation::DontActivate);
+		if (!InitialBodies.BodiesToActivate.IsEmpty())
+		{
+			BodyInterface->ActivateBodies(InitialBodies.BodiesToActivate.GetData(), InitialBodies.BodiesToActivate.Num());
+		}
+	}
 	
+	LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UJoltPhysicsWorldSubsystem::OnLevelAddedToWorld);
+	LevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UJoltPhysicsWorldSubsystem::OnLevelRemovedFromWorld);
+	ActorDestroyedHandle = GetWorld()->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UJoltPhysicsWorldSubsystem::OnActorDestroyed));
+	
+	// Everything above was converted under the current origin
+	JoltWorldOrigin = GetWorld()->OriginLocation;
+	if (JoltSettings->bEnableOriginRebasing)
+	{
+		WorldOriginOffsetHandle = FWorldDelegates::OnPostWorldOriginOffset.AddUObject(this, &UJoltPhysicsWorldSubsystem::OnPostWorldOriginOffset);
+	}
 
-	// We were adding bodies one by one above, so need to call this.
-	// TODO: need to look into adding bodies as a batch, as recommended by jolt
+	// Bodies registered before play (e.g. from BeginPlay of other actors) were added one by one, so rebuild the tree once.
 	// https://jrouwe.github.io/JoltPhysics/#creating-bodies
 	MainPhysicsSystem->OptimizeBroadPhase();
 
@@ -162,6 +205,7 @@ void UJoltPhysicsWorldSubsystem::RegisterJoltRigidBody(AActor* Target)
 		// We're baking this in world space, so apply Actor transform to relative
 		const FTransform FinalXform = RelTransform;
 		FJoltUserData* UserData = AllocUserData();
+		if (!UserData) return;
 
 		if (UPrimitiveComponent* P = Descriptor.Shapes.Last().Shape.Get())
 		{
@@ -210,11 +254,31 @@ void UJoltPhysicsWorldSubsystem::RegisterJoltRigidBody(AActor* Target)
 			Descriptor.Shapes.Last().CollisionResponses = ResponseContainer;
 		}
 		
+		if (USkeletalMeshComponent* Skel = Cast<USkeletalMeshComponent>(Descriptor.Shapes.Last().Shape.Get()))
+		{
+			if (JPH::Body* CollisionObject = AddRigidBodyCollider(Skel, RelTransform, Shape, Options, UserData))
+			{
+				Descriptor.Shapes.Last().Id = CollisionObject->GetID().GetIndexAndSequenceNumber();
+			}
+			
+			GlobalShapeDescriptorDataCache.Add(Target, Descriptor);
+			return;
+		}
+		
 		if (Options.ShapeType == EJoltShapeType::DYNAMIC || Options.ShapeType == EJoltShapeType::KINEMATIC)
 		{
 			if (JPH::Body* CollisionObject = AddRigidBodyCollider(Target, RelTransform, Shape, Options, UserData))
 			{
 				Descriptor.Shapes.Last().Id = CollisionObject->GetID().GetIndexAndSequenceNumber();
+				
+				// Kinematic bodies are driven from the component, only dynamic ones lead
+				UPrimitiveComponent* P = Descriptor.Shapes.Last().Shape.Get();
+				if (P && Options.ShapeType == EJoltShapeType::DYNAMIC && JoltSettings->bWriteBackRigidBodyTransforms)
+				{
+					FTransform BodyToComponent = P->GetComponentTransform().GetRelativeTransform(JoltHelpers::ToUnrealTransform(CollisionObject->GetWorldTransform()));
+					BodyToComponent.SetScale3D(FVector::OneVector);
+					AddTransformWriteBack(P, CollisionObject->GetID(), BodyToComponent);
+				}
 			}
 			
 			GlobalShapeDescriptorDataCache.Add(Target, Descriptor);
@@ -232,6 +296,57 @@ void UJoltPhysicsWorldSubsystem::RegisterJoltRigidBody(AActor* Target)
 	}, Descriptor);
 }
 
+void UJoltPhysicsWorldSubsystem::UnregisterJoltRigidBody(AActor* Target)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::UnregisterJoltRigidBody);
+	
+	FUnrealShapeDescriptor Descriptor;
+	if (!MainPhysicsSystem || !GlobalShapeDescriptorDataCache.RemoveAndCopyValue(Target, Descriptor)) return;
+	
+	TSet<uint32> BodyIDs;
+	for (const FUnrealShape& Shape : Descriptor.Shapes)
+	{
+		if (Shape.Id != 0)
+		{
+			BodyIDs.Add(Shape.Id);
+		}
+		RemoveTransformWriteBack(Shape.Shape.Get());
+	}
+	
+	DestroyJoltBodies(BodyIDs);
+}
+
+void UJoltPhysicsWorldSubsystem::UnregisterJoltComponent(const UPrimitiveComponent* Target)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::UnregisterJoltComponent);
+	
+	FUnrealShapeDescriptor* Descriptor = Target && MainPhysicsSystem ? GlobalShapeDescriptorDataCache.Find(Target->GetOwner()) : nullptr;
+	if (!Descriptor) return;
+	
+	TSet<uint32> BodyIDs;
+	Descriptor->Shapes.RemoveAll([Target, &BodyIDs](const FUnrealShape& Shape)
+	{
+		if (Shape.Shape.Get() != Target) return false;
+		
+		if (Shape.Id != 0)
+		{
+			BodyIDs.Add(Shape.Id);
+		}
+		return true;
+	});
+	
+	RemoveTransformWriteBack(Target);
+	DestroyJoltBodies(BodyIDs);
+}
+
+void UJoltPhysicsWorldSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	if (Actor && GlobalShapeDescriptorDataCache.Contains(Actor))
+	{
+		UnregisterJoltRigidBody(Actor);
+	}
+}
+
 void UJoltPhysicsWorldSubsystem::RegisterJoltCharacter(const APawn* Target, const JPH::CharacterVirtualSettings& Settings, uint32& CharacterId)
 {
 	if (!Target) return;
@@ -266,6 +381,22 @@ void UJoltPhysicsWorldSubsystem::DrawDebugLines() const
 		UE_LOG(LogJoltBridge, Warning, TEXT("Debug renderer disabled"));
 		return;
 	}
+	
+	// Only what the last step touched, the rest of the world looks the same as it did
+	class FMovedBodyDrawFilter final : public JPH::BodyDrawFilter
+	{
+	public:
+		explicit FMovedBodyDrawFilter(const FJoltActiveBodyTracker& InTracker) : Tracker(InTracker) {}
+		virtual bool ShouldDraw(const JPH::Body& inBody) const override { return Tracker.HasMoved(inBody.GetID()); }
+		const FJoltActiveBodyTracker& Tracker;
+	};
+	
+	if (DrawDebugShapes == 2 && ActiveBodyTracker)
+	{
+		const FMovedBodyDrawFilter Filter(*ActiveBodyTracker);
+		MainPhysicsSystem->DrawBodies(*DrawSettings, JoltDebugRendererImpl, &Filter);
+		return;
+	}
 	MainPhysicsSystem->DrawBodies(*DrawSettings, JoltDebugRendererImpl);
 }
 
@@ -362,6 +493,34 @@ const JPH::CapsuleShape* UJoltPhysicsWorldSubsystem::GetCapsuleCollisionShape(fl
 
 }
 
+const JPH::Shape* UJoltPhysicsWorldSubsystem::GetTaperedCapsuleCollisionShape(float TopRadius, float BottomRadius, float Height, const JoltPhysicsMaterial* Material)
+{
+	const float Top = JoltHelpers::ToJoltFloat(TopRadius);
+	const float Bottom = JoltHelpers::ToJoltFloat(BottomRadius);
+	const float HalfH = JoltHelpers::ToJoltFloat(Height) * 0.5f;
+	
+	for (const TaperedCapsuleShapeHolder& Holder : TaperedCapsuleShapes)
+	{
+		if (FMath::IsNearlyEqual(Holder.TopRadius, Top) && FMath::IsNearlyEqual(Holder.BottomRadius, Bottom) && FMath::IsNearlyEqual(Holder.HalfHeight, HalfH) && Holder.Material == Material)
+		{
+			return Holder.Shape;
+		}
+	}
+	
+	// Equal radii come back as a plain capsule
+	const JPH::TaperedCapsuleShapeSettings Settings(HalfH, Top, Bottom, Material);
+	const JPH::Shape::ShapeResult Result = Settings.Create();
+	if (!Result.IsValid())
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("Tapered capsule (radius %f/%f, length %f) rejected by Jolt, using a capsule of the larger radius. Error: %s"),
+			TopRadius, BottomRadius, Height, *FString(Result.GetError().c_str()));
+		return GetCapsuleCollisionShape(FMath::Max(TopRadius, BottomRadius), Height, Material);
+	}
+	
+	TaperedCapsuleShapes.Add({Top, Bottom, HalfH, Material, Result.Get()});
+	return TaperedCapsuleShapes.Last().Shape;
+}
+
 const JPH::ConvexHullShape* UJoltPhysicsWorldSubsystem::GetConvexHullCollisionShape(UBodySetup* BodySetup, int ConvexIndex, const FVector& Scale, const JoltPhysicsMaterial* Material)
 {
 	for (const ConvexHullShapeHolder& S : ConvexShapes)
@@ -409,7 +568,37 @@ void UJoltPhysicsWorldSubsystem::CleanUpJoltBridgeWorld()
 		return;
 	}
 	
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedFromWorldHandle);
+	LevelAddedToWorldHandle.Reset();
+	LevelRemovedFromWorldHandle.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	ActorDestroyedHandle.Reset();
+	FWorldDelegates::OnPostWorldOriginOffset.Remove(WorldOriginOffsetHandle);
+	WorldOriginOffsetHandle.Reset();
+	
 	MainPhysicsSystem->SetContactListener(nullptr);
+	if (ContactListener)
+	{
+		ContactListener->ClearAllBodyContactOverrides();
+	}
+	MainPhysicsSystem->SetBodyActivationListener(nullptr);
+	delete ActiveBodyTracker;
+	ActiveBodyTracker = nullptr;
+	
+	// Bodies of a set still being prepared are not in the broadphase and cannot be removed like the others
+	for (TPair<const ULevel*, TUniquePtr<FJoltLevelBodySet>>& Pair : LevelBodySets)
+	{
+		if (!Pair.Value->bInBroadPhase)
+		{
+			AbortLevelBodySet(*Pair.Value);
+			MainPhysicsSystem->GetBodyInterface().DestroyBodies(Pair.Value->BodyIDs.GetData(), Pair.Value->BodyIDs.Num());
+		}
+	}
+	LevelBodySets.Empty();
 	
 	JPH::BodyIDVector Ids;
 	MainPhysicsSystem->GetBodies(Ids);
@@ -441,8 +630,20 @@ void UJoltPhysicsWorldSubsystem::CleanUpJoltBridgeWorld()
 	for (int i = 0; i < ConvexShapes.Num(); i++)
 		delete ConvexShapes[i].Shape;
 	ConvexShapes.Empty();
+	TaperedCapsuleShapes.Empty();
+	
+	SkeletalBodies.Empty();
+	SkeletalBodyIndexByBodyID.Empty();
+	
+	LandscapeBodies.Empty();
+	HeightFieldShapes.Empty();
 	
-	UserDataStore.Empty();
+	WriteBacks.Empty();
+	WriteBackBodyIDs.Empty();
+	WriteBackLastRead.Empty();
+	WriteBackIndexByComponent.Empty();
+	
+	UserDataArena.Reset();
 	
 
 	delete JoltWorker;
@@ -636,7 +837,31 @@ JPH::Body* UJoltPhysicsWorldSubsystem::AddRigidBodyCollider(AActor* Actor, const
 
 JPH::Body* UJoltPhysicsWorldSubsystem::AddRigidBodyCollider(USkeletalMeshComponent* Skel, const FTransform& PhysicsAssetTransform, const JPH::Shape* CollisionShape, const FJoltPhysicsBodySettings& Options, const FJoltUserData* UserData)
 {
-	return nullptr;
+	// The compound was just built by ExtractPhysicsGeometry and is still waiting for its body
+	const int32 SkeletalBodyIndex = SkeletalBodies.FindLastByPredicate([Skel](const FJoltSkeletalBody& B) { return B.Component.Get() == Skel && B.BodyID.IsInvalid(); });
+	if (SkeletalBodyIndex == INDEX_NONE)
+	{
+		UE_LOG(LogJoltBridge, Error, TEXT("No physics asset compound was built for %s"), *GetNameSafe(Skel));
+		return nullptr;
+	}
+	
+	// Animation drives the pose, so the body is kinematic regardless of the configured shape type
+	FJoltPhysicsBodySettings KinematicOptions = Options;
+	KinematicOptions.ShapeType = EJoltShapeType::KINEMATIC;
+	JPH::BodyCreationSettings shapeSettings = MakeBodyCreationSettings(CollisionShape, PhysicsAssetTransform, KinematicOptions, UserData);
+
+	DynamicBodyIDX++;
+	JPH::BodyID* bodyID = new JPH::BodyID(DynamicBodyIDX);
+	JPH::Body* createdBody = AddBodyToSimulation(bodyID, shapeSettings, KinematicOptions, UserData);
+	if (!createdBody)
+	{
+		SkeletalBodies.RemoveAt(SkeletalBodyIndex);
+		return nullptr;
+	}
+	
+	SkeletalBodies[SkeletalBodyIndex].BodyID = createdBody->GetID();
+	SkeletalBodyIndexByBodyID.Add(createdBody->GetID().GetIndexAndSequenceNumber(), SkeletalBodyIndex);
+	return createdBody;
 }
 
 JPH::Body* UJoltPhysicsWorldSubsystem::AddStaticCollider(const JPH::Shape* Shape, const FTransform& Transform, const FJoltPhysicsBodySettings& Options, const FJoltUserData* UserData)
@@ -665,6 +890,17 @@ JPH::Body* UJoltPhysicsWorldSubsystem::AddBodyToSimulation(const JPH::BodyID* Bo
 	createdBody->SetUserData(reinterpret_cast<uint64>(UserData));
 
 	BodyIDBodyMap.Add(createdBody->GetID().GetIndexAndSequenceNumber(), createdBody);
+	ActiveBodyTracker->MarkMoved(createdBody->GetID());
+	if (PendingLevelBodySet)
+	{
+		PendingLevelBodySet->BodyIDs.Add(createdBody->GetID());
+		if (Options.bAutomaticallyActivate)
+		{
+			PendingLevelBodySet->BodiesToActivate.Add(createdBody->GetID());
+		}
+		return createdBody;
+	}
+	
 	BodyInterface->AddBody(createdBody->GetID(), Options.bAutomaticallyActivate ? JPH::EActivation::Activate : JPH::EActivation::DontActivate);
 	return createdBody;
 }
@@ -732,16 +968,18 @@ JPH::BodyCreationSettings UJoltPhysicsWorldSubsystem::MakeBodyCreationSettings(c
 	// In your subsystem (lifetime >= bodies):
 	if (!UEGroupFilter)
 	{
-		UEGroupFilter = new FUnrealGroupFilter();
+		UEGroupFilter = new FUnrealGroupFilter(&UserDataArena);
 	};
 	
-	uint32 Lo, Hi;
-	JoltHelpers::PackDataToGroupIDs(UserData, Lo, Hi);
+	// The user data is filled in by now, the filter reads the hot copy through the handle
+	if (UserData)
+	{
+		UserDataArena.SyncHot(*UserData);
+	}
 
 	JPH::CollisionGroup CG;
 	CG.SetGroupFilter(UEGroupFilter);
-	CG.SetGroupID(Lo);
-	CG.SetSubGroupID(Hi);
+	CG.SetGroupID(UserData ? UserData->Handle : FJoltUserData::InvalidHandle);
 	
 	ShapeSettings.mCollisionGroup = CG;
 
@@ -770,6 +1008,7 @@ void UJoltPhysicsWorldSubsystem::SetPhysicsState(const UPrimitiveComponent* Targ
 		JoltHelpers::ToJoltVector3(Velocity),
 		JoltHelpers::ToJoltVector3(JoltHelpers::DegreesPerSecToRadiansPerSec(AngularVelocity))
 	);
+	ActiveBodyTracker->MarkMoved(ID);
 	
 	
 	
@@ -903,9 +1142,9 @@ void UJoltPhysicsWorldSubsystem::StepPhysics(float FixedTimeStep)
 		OnPrePhysicsStep.Broadcast(FixedTimeStep);
 	}
 	
-	JoltWorker->StepPhysics();
+	AdvancePhysics();
 #ifdef JPH_DEBUG_RENDERER
-	if (DrawDebugShapes == 1) 
+	if (DrawDebugShapes >= 1) 
 	{
 		DrawDebugLines();
 	}
@@ -932,6 +1171,25 @@ void UJoltPhysicsWorldSubsystem::StepPhysics(float FixedTimeStep)
 	}
 }
 
+void UJoltPhysicsWorldSubsystem::AdvancePhysics()
+{
+	FinalizeLevelBodySets();
+	UpdateSkeletalBodies();
+	StepJoltWorld();
+	ActiveBodyTracker->EndStep(*MainPhysicsSystem);
+	WriteBackTransforms(/*bMovedBodiesOnly*/true);
+}
+
+void UJoltPhysicsWorldSubsystem::StepJoltWorld()
+{
+	if (OnModifyContacts.IsBound())
+	{
+		OnModifyContacts.Broadcast();
+	}
+	
+	JoltWorker->StepPhysics();
+}
+
 void UJoltPhysicsWorldSubsystem::StepVirtualCharacters(float FixedTimeStep)
 {
 	for (TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
@@ -975,6 +1233,7 @@ void UJoltPhysicsWorldSubsystem::SetGravityFactor(const UPrimitiveComponent* Tar
 	JPH::BodyID ID(ShapeId);
 	
 	BodyInterface->SetGravityFactor(ID, GravityFactor);
+	ActiveBodyTracker->MarkMoved(ID);
 }
 
 void UJoltPhysicsWorldSubsystem::SetLinearVelocity(const UPrimitiveComponent* Target, const FVector LinearVelocity)
@@ -1008,7 +1267,7 @@ void UJoltPhysicsWorldSubsystem::RestoreCharacterState(const int32 Id, const FTr
 	
 	C->SetLinearVelocity(JoltHelpers::ToJoltVector3(LinearVelocity));
 	C->SetRotation(JoltHelpers::ToJoltRotation(Transform.GetRotation()));
-	C->SetPosition(JoltHelpers::ToJoltVector3(Transform.GetTranslation()));
+	C->SetPosition(JoltHelpers::ToJoltPosition(Transform.GetTranslation()));
 }
 
 
@@ -1052,6 +1311,32 @@ void UJoltPhysicsWorldSubsystem::ZeroActorVelocity(AActor* Target)
 	BodyInterface->SetLinearAndAngularVelocity(JoltBodyId,JoltHelpers::ToJoltVector3(FVector(0)), JoltHelpers::ToJoltVector3(FVector(0)));
 }
 
+void UJoltPhysicsWorldSubsystem::SetBodyContactModifier(const UPrimitiveComponent* Target, const FJoltContactModifierSettings& Settings)
+{
+	const int32 Id = FindShapeId(Target);
+	if (Id == INDEX_NONE || !ContactListener) return;
+	
+	FJoltBodyContactOverride Override;
+	Override.bOverrideFriction = Settings.bOverrideFriction;
+	Override.bOverrideRestitution = Settings.bOverrideRestitution;
+	Override.bOverrideSurfaceVelocity = Settings.bOverrideSurfaceVelocity;
+	Override.Friction = Settings.Friction;
+	Override.Restitution = Settings.Restitution;
+	
+	const JPH::Vec3 SurfaceVelocity = JoltHelpers::ToJoltVector3(Settings.SurfaceVelocity);
+	Override.SurfaceVelocity = JPH::Float3(SurfaceVelocity.GetX(), SurfaceVelocity.GetY(), SurfaceVelocity.GetZ());
+	
+	ContactListener->SetBodyContactOverride(JPH::BodyID(Id), Override);
+}
+
+void UJoltPhysicsWorldSubsystem::ClearBodyContactModifier(const UPrimitiveComponent* Target)
+{
+	const int32 Id = FindShapeId(Target);
+	if (Id == INDEX_NONE || !ContactListener) return;
+	
+	ContactListener->ClearBodyContactOverride(JPH::BodyID(Id));
+}
+
 TArray<AActor*> UJoltPhysicsWorldSubsystem::GetOverlappingActors(AActor* Target) const
 {
 	TArray<AActor*> OverlappingActors;
@@ -1317,7 +1602,7 @@ int32 UJoltPhysicsWorldSubsystem::SweepTraceSingle(const FCollisionShape& Shape,
 	JPH::RMat44 ToTransform = JoltHelpers::ToJoltTransform(FTransform(Rotation, FinalEnd));
 	JPH::Vec3 Dir = JoltHelpers::ToJoltVector3(End - Start);
 	
-	JPH::RShapeCast ShapeCast = JPH::RShapeCast::sFromWorldTransform(CollisionShape, JPH::RVec3::sOne(), FromTransform, Dir);
+	JPH::RShapeCast ShapeCast = JPH::RShapeCast::sFromWorldTransform(CollisionShape, JPH::Vec3::sOne(), FromTransform, Dir);
 	/*{ 
 		CollisionShape,
 		JoltHelpers::ToJoltVector3(FVector(1), false),
@@ -1443,7 +1728,7 @@ TArray<int32> UJoltPhysicsWorldSubsystem::SweepTraceMulti(const FCollisionShape&
 	JPH::RMat44 ToTransform = JoltHelpers::ToJoltTransform(FTransform(Rotation, FinalEnd));
 	JPH::Vec3 Dir = JoltHelpers::ToJoltVector3(End - Start);
 	
-	JPH::RShapeCast ShapeCast = JPH::RShapeCast::sFromWorldTransform(CollisionShape, JPH::RVec3::sOne(), FromTransform, Dir);
+	JPH::RShapeCast ShapeCast = JPH::RShapeCast::sFromWorldTransform(CollisionShape, JPH::Vec3::sOne(), FromTransform, Dir);
 	/*{ 
 		CollisionShape,
 		JoltHelpers::ToJoltVector3(FVector(1), true),
@@ -1475,7 +1760,7 @@ TArray<int32> UJoltPhysicsWorldSubsystem::SweepTraceMulti(const FCollisionShape&
 		(
 			ShapeCast,
 			Settings,
-			JPH::RVec3::sZero(),
+			ShapeCast.mCenterOfMassStart.GetTranslation(),
 			Collector,
 			{},
 			{},
@@ -1488,7 +1773,7 @@ TArray<int32> UJoltPhysicsWorldSubsystem::SweepTraceMulti(const FCollisionShape&
 		(
 			ShapeCast,
 			Settings,
-			JPH::RVec3::sZero(),
+			ShapeCast.mCenterOfMassStart.GetTranslation(),
 			Collector,
 			{},
 			{},
@@ -1579,6 +1864,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FRaycastCollector_Firs
 		UPrimitiveComponent* HitComp = Data.FindClosestPrimitive(HitLocation);
 		OutHit.Component = HitComp;
 		OutHit.HitObjectHandle = FActorInstanceHandle(HitActor);
+		OutHit.BoneName = GetHitBoneName(Result.mBodyID, Result.mSubShapeID2);
 		
 		OutHit.PhysMaterial = UserData->PhysMaterial;
 	}
@@ -1622,6 +1908,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FClosestShapeCastHitCo
 		UPrimitiveComponent* HitComp = Data.FindClosestPrimitive(HitLocation);
 		OutHit.Component = HitComp;
 		OutHit.HitObjectHandle = FActorInstanceHandle(HitActor);
+		OutHit.BoneName = GetHitBoneName(Result.mBodyID, Result.mSubShapeID2);
 		OutHit.PhysMaterial = UserData->PhysMaterial;
 	}
 }
@@ -1661,6 +1948,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FRaycastCollector_AllH
 			UPrimitiveComponent* HitComp = Data.FindClosestPrimitive(HitLocation);
 			OutHit.Component = HitComp;
 			OutHit.HitObjectHandle = FActorInstanceHandle(HitActor);
+			OutHit.BoneName = GetHitBoneName(HitBodyId, SubShapeId);
 			OutHit.PhysMaterial = UserData->PhysMaterial;
 		}
 		
@@ -1679,7 +1967,9 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FSweepCastCollector_Al
 		const JPH::ShapeCastResult& Hit = Result.mHits.at(i);
 		const FJoltUserData* UserData = reinterpret_cast<const FJoltUserData*>(BodyInterface->GetUserData(Hit.mBodyID2));
 		if (!UserData) return;
-		const FVector& HitLocation = JoltHelpers::ToUnrealVector3(Hit.mContactPointOn2);
+		// Contact points are relative to the base offset the cast ran with, the start of the cast
+		const JPH::RVec3 BaseOffset = Result.mRay.mCenterOfMassStart.GetTranslation();
+		const FVector HitLocation = JoltHelpers::ToUnrealPosition(BaseOffset + Hit.mContactPointOn2, UE_WORLD_ORIGIN);
 		const FVector& ImpactNormal = JoltHelpers::ToUnrealNormal(-Hit.mPenetrationAxis.Normalized());
 		
 		UPhysicalMaterial* UEMat = nullptr;
@@ -1691,7 +1981,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FSweepCastCollector_Al
 		OutHit.ImpactPoint = HitLocation;
 		OutHit.ImpactNormal = ImpactNormal;
 		OutHit.Normal = ImpactNormal;
-		OutHit.Distance = FVector::Distance(HitLocation, JoltHelpers::ToUnrealPosition(Result.mRay.mCenterOfMassStart.GetTranslation()));
+		OutHit.Distance = FVector::Distance(HitLocation, JoltHelpers::ToUnrealPosition(BaseOffset, UE_WORLD_ORIGIN));
 	
 		if (!HitActor) return;
 	
@@ -1701,6 +1991,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FSweepCastCollector_Al
 			UPrimitiveComponent* HitComp = Data.FindClosestPrimitive(HitLocation);
 			OutHit.Component = HitComp;
 			OutHit.HitObjectHandle = FActorInstanceHandle(HitActor);
+			OutHit.BoneName = GetHitBoneName(Hit.mBodyID2, Hit.mSubShapeID2);
 			OutHit.PhysMaterial = UserData->PhysMaterial;
 		}
 		
@@ -1708,7 +1999,7 @@ void UJoltPhysicsWorldSubsystem::ConstructHitResult(const FSweepCastCollector_Al
 	}
 }
 
-void UJoltPhysicsWorldSubsystem::AddAllJoltActors(const UWorld* World)
+void UJoltPhysicsWorldSubsystem::AddAllJoltActors(const UWorld* World, const ULevel* Level)
 {
 	TArray<AActor*> dynamicActors;
 
@@ -1718,10 +2009,26 @@ void UJoltPhysicsWorldSubsystem::AddAllJoltActors(const UWorld* World)
 		return;
 	}
 	
-	// Iterate over all Actors in the world
-	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+	// Every Actor in the world, or only those of Level
+	TArray<AActor*> Candidates;
+	if (Level)
+	{
+		Candidates.Reserve(Level->Actors.Num());
+		for (AActor* Actor : Level->Actors)
+		{
+			Candidates.Add(Actor);
+		}
+	}
+	else
+	{
+		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+		{
+			Candidates.Add(*ActorItr);
+		}
+	}
+	
+	for (AActor* Actor : Candidates)
 	{
-		AActor* Actor = *ActorItr;
 		if (!Actor)
 			continue;
 		
@@ -1801,7 +2108,7 @@ void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(const AActor* Actor, Phy
 		}
 		else if (Cast<USkeletalMeshComponent>(Comp))
 		{
-			// Extract Shapes From Physics Asset.
+			ExtractPhysicsGeometry(Cast<USkeletalMeshComponent>(Comp), InvActorTransform, CB, ShapeDescriptor);
 		}
 	}
 }
@@ -1915,6 +2222,160 @@ void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(UStaticMeshComponent* SM
 }
 
 
+void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(USkeletalMeshComponent* Skel, const FTransform& InvActorXform, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor)
+{
+	if (!Skel) return;
+	IJoltPrimitiveComponentInterface* I = Cast<IJoltPrimitiveComponentInterface>(Skel);
+	if (!I) return;
+	UPhysicsAsset* PhysicsAsset = Skel->GetPhysicsAsset();
+	if (!PhysicsAsset) return;
+	
+	const FTransform CompTransform = Skel->GetComponentTransform();
+	const FVector Scale = CompTransform.GetScale3D();
+	
+	// Animation may not have run yet, fall back to the reference pose for the initial layout
+	const TArray<FTransform>& BoneTransforms = Skel->GetComponentSpaceTransforms();
+	const FReferenceSkeleton* RefSkeleton = Skel->GetSkinnedAsset() ? &Skel->GetSkinnedAsset()->GetRefSkeleton() : nullptr;
+	
+	FJoltSkeletalBody SkeletalBody;
+	SkeletalBody.Component = Skel;
+	SkeletalBody.Scale = Scale;
+	
+	JPH::MutableCompoundShapeSettings CompoundSettings;
+	
+	auto AddElement = [&](const JPH::Shape* ElemShape, const FTransform& ElemTransform, const int32 BoneIndex, const FName BoneName)
+	{
+		FTransform BoneTransform = FTransform::Identity;
+		if (BoneTransforms.IsValidIndex(BoneIndex))
+		{
+			BoneTransform = BoneTransforms[BoneIndex];
+		}
+		else if (RefSkeleton)
+		{
+			BoneTransform = FAnimationRuntime::GetComponentSpaceTransformRefPose(*RefSkeleton, BoneIndex);
+		}
+		
+		// Sub-shape positions live in the unscaled body space, sizes were already scaled when the shape was fetched
+		const FTransform SubShapeTransform = ElemTransform * BoneTransform;
+		CompoundSettings.AddShape(
+			JoltHelpers::ToJoltVector3(SubShapeTransform.GetLocation() * Scale),
+			JoltHelpers::ToJoltRotation(SubShapeTransform.GetRotation()),
+			ElemShape);
+		
+		SkeletalBody.SubShapeBoneIndices.Add(BoneIndex);
+		SkeletalBody.SubShapeBoneNames.Add(BoneName);
+		SkeletalBody.SubShapeLocalTransforms.Add(ElemTransform);
+	};
+	
+	for (USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
+	{
+		if (!BodySetup) continue;
+		
+		const int32 BoneIndex = Skel->GetBoneIndex(BodySetup->BoneName);
+		if (BoneIndex == INDEX_NONE) continue;
+		
+		const JoltPhysicsMaterial* physicsMaterial = GetJoltPhysicsMaterial(BodySetup->GetPhysMaterial());
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		
+		for (const FKBoxElem& ueBox : AggGeom.BoxElems)
+		{
+			AddElement(GetBoxCollisionShape(FVector(ueBox.X, ueBox.Y, ueBox.Z) * Scale, physicsMaterial), ueBox.GetTransform(), BoneIndex, BodySetup->BoneName);
+		}
+		for (const FKSphereElem& ueSphere : AggGeom.SphereElems)
+		{
+			// Only support uniform Scale so use X
+			AddElement(GetSphereCollisionShape(ueSphere.Radius * Scale.X, physicsMaterial), ueSphere.GetTransform(), BoneIndex, BodySetup->BoneName);
+		}
+		for (const FKSphylElem& Capsule : AggGeom.SphylElems)
+		{
+			// X Scales Radius, Z Scales Height
+			AddElement(GetCapsuleCollisionShape(Capsule.Radius * Scale.X, Capsule.Length * Scale.Z, physicsMaterial), Capsule.GetTransform(), BoneIndex, BodySetup->BoneName);
+		}
+		for (int32 i = 0; i < AggGeom.ConvexElems.Num(); ++i)
+		{
+			AddElement(GetConvexHullCollisionShape(BodySetup, i, Scale, physicsMaterial), AggGeom.ConvexElems[i].GetTransform(), BoneIndex, BodySetup->BoneName);
+		}
+		for (const FKTaperedCapsuleElem& Capsule : AggGeom.TaperedCapsuleElems)
+		{
+			AddElement(GetTaperedCapsuleCollisionShape(Capsule.Radius0 * Scale.X, Capsule.Radius1 * Scale.X, Capsule.Length * Scale.Z, physicsMaterial), Capsule.GetTransform(), BoneIndex, BodySetup->BoneName);
+		}
+	}
+	
+	const int32 NumSubShapes = SkeletalBody.SubShapeBoneIndices.Num();
+	if (NumSubShapes == 0)
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("Physics asset %s on %s has no supported primitives"), *GetNameSafe(PhysicsAsset), *GetNameSafe(Skel));
+		return;
+	}
+	
+	JPH::Shape::ShapeResult Result = CompoundSettings.Create();
+	if (!Result.IsValid())
+	{
+		UE_LOG(LogJoltBridge, Error, TEXT("Failed to create physics asset compound for %s. Error: %s"), *GetNameSafe(Skel), *FString(Result.GetError().c_str()));
+		return;
+	}
+	
+	SkeletalBody.Shape = static_cast<JPH::MutableCompoundShape*>(Result.Get().GetPtr());
+	SkeletalBody.Positions.resize(NumSubShapes);
+	SkeletalBody.Rotations.resize(NumSubShapes);
+	SkeletalBodies.Add(MoveTemp(SkeletalBody));
+	
+	// The body carries the component's location and rotation, scale is baked into the sub-shapes
+	const FTransform BodyTransform(CompTransform.GetRotation(), CompTransform.GetLocation());
+	CB(SkeletalBodies.Last().Shape, BodyTransform, I->GetJoltPhysicsBodySettings());
+}
+
+void UJoltPhysicsWorldSubsystem::UpdateSkeletalBodies()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::UpdateSkeletalBodies);
+	
+	for (FJoltSkeletalBody& SkeletalBody : SkeletalBodies)
+	{
+		const USkeletalMeshComponent* Skel = SkeletalBody.Component.Get();
+		if (!Skel || SkeletalBody.BodyID.IsInvalid()) continue;
+		
+		const TArray<FTransform>& BoneTransforms = Skel->GetComponentSpaceTransforms();
+		const int32 NumSubShapes = SkeletalBody.SubShapeBoneIndices.Num();
+		
+		bool bHasPose = true;
+		for (int32 i = 0; i < NumSubShapes; ++i)
+		{
+			const int32 BoneIndex = SkeletalBody.SubShapeBoneIndices[i];
+			if (!BoneTransforms.IsValidIndex(BoneIndex))
+			{
+				bHasPose = false;
+				break;
+			}
+			
+			const FTransform SubShapeTransform = SkeletalBody.SubShapeLocalTransforms[i] * BoneTransforms[BoneIndex];
+			SkeletalBody.Positions[i] = JoltHelpers::ToJoltVector3(SubShapeTransform.GetLocation() * SkeletalBody.Scale);
+			SkeletalBody.Rotations[i] = JoltHelpers::ToJoltRotation(SubShapeTransform.GetRotation());
+		}
+		
+		if (!bHasPose) continue;
+		
+		// Every bone goes into the compound in one batch, then a single body interface call moves the body and
+		// refreshes its broadphase bounds from the new sub-shape layout.
+		SkeletalBody.Shape->ModifyShapes(0, NumSubShapes, SkeletalBody.Positions.data(), SkeletalBody.Rotations.data());
+		
+		const FTransform& CompTransform = Skel->GetComponentTransform();
+		BodyInterface->SetPositionAndRotation(SkeletalBody.BodyID, JoltHelpers::ToJoltPosition(CompTransform.GetLocation()), JoltHelpers::ToJoltRotation(CompTransform.GetRotation()), JPH::EActivation::DontActivate);
+		ActiveBodyTracker->MarkMoved(SkeletalBody.BodyID);
+	}
+}
+
+FName UJoltPhysicsWorldSubsystem::GetHitBoneName(const JPH::BodyID& BodyID, const JPH::SubShapeID& SubShapeID) const
+{
+	const int32* SkeletalBodyIndex = SkeletalBodyIndexByBodyID.Find(BodyID.GetIndexAndSequenceNumber());
+	if (!SkeletalBodyIndex) return NAME_None;
+	
+	const FJoltSkeletalBody& SkeletalBody = SkeletalBodies[*SkeletalBodyIndex];
+	JPH::SubShapeID Remainder;
+	const uint32 SubShapeIndex = SkeletalBody.Shape->GetSubShapeIndexFromID(SubShapeID, Remainder);
+	
+	return SkeletalBody.SubShapeBoneNames.IsValidIndex(SubShapeIndex) ? SkeletalBody.SubShapeBoneNames[SubShapeIndex] : NAME_None;
+}
+
 void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(UShapeComponent* Sc, const FTransform& InvActorXform, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor)
 {
 	// We want the complete transform from Actor to this component, not just relative to parent
@@ -2020,10 +2481,8 @@ void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(UPrimitiveComponent* Pri
 	
 	for (const FKTaperedCapsuleElem& Capsule : BodySetup->AggGeom.TaperedCapsuleElems)
 	{
-		// TODO:@GreggoryAddison::CodeCompletion || Tapered capsules are used in the skeletal Mesh physics object. Will need to support this for ragdolls
 		// X Scales Radius, Z Scales Height
-		/*const JPH::CapsuleShape* capsule = GetCapsuleCollisionShape(Capsule.Radius * Scale.X, Capsule.Length * Scale.Z, physicsMaterial);
-		JoltShape = capsule;
+		JoltShape = GetTaperedCapsuleCollisionShape(Capsule.Radius0 * Scale.X, Capsule.Radius1 * Scale.X, Capsule.Length * Scale.Z, physicsMaterial);
 		if (compoundShapeSettings)
 		{
 			compoundShapeSettings->AddShape(
@@ -2031,14 +2490,14 @@ void UJoltPhysicsWorldSubsystem::ExtractPhysicsGeometry(UPrimitiveComponent* Pri
 				JoltHelpers::ToJoltRotation(Capsule.GetTransform().GetRotation()),
 				JoltShape);
 			continue;
-		}*/
+		}
 
-		//FTransform ShapeXform(Capsule.GetTransform().GetRotation(), Capsule.Center);
+		FTransform ShapeXform(Capsule.GetTransform().GetRotation(), Capsule.Center);
 		// Shape transform adds to any relative transform already here
-		/*FTransform XForm = ShapeXform * XformSoFar;
-		ShapeDescriptor.Shapes.Last().ShapeRadius = Capsule.Radius * Scale.X;
+		FTransform XForm = ShapeXform * XformSoFar;
+		ShapeDescriptor.Shapes.Last().ShapeRadius = FMath::Max(Capsule.Radius0, Capsule.Radius1) * Scale.X;
 		ShapeDescriptor.Shapes.Last().ShapeHeight = Capsule.Length * Scale.Z;
-		CB(JoltShape, XForm, I->GetShapeOptions());*/
+		CB(JoltShape, XForm, I->GetJoltPhysicsBodySettings());
 	}
 
 	// Convex hull
@@ -2143,56 +2602,797 @@ const UPhysicalMaterial* UJoltPhysicsWorldSubsystem::GetUEPhysicsMaterial(const
 }
 
 
-#pragma region SNAPSHOT HISTORY
-static constexpr int32 MinSnapshotCapacity = 8;
+#pragma region LANDSCAPE
+// Bump whenever the layout of the built heightfield changes, so stale cooked files are ignored
+static constexpr int32 JoltHeightFieldCacheVersion = 1;
 
-int32 UJoltPhysicsWorldSubsystem::RoundUpToPowerOfTwo(int32 Value)
-{
-	if (Value <= 1) return 1;
-	// Round up to next power of two
-	Value--;
-	Value |= Value >> 1;
-	Value |= Value >> 2;
-	Value |= Value >> 4;
-	Value |= Value >> 8;
-	Value |= Value >> 16;
-	Value++;
-	return Value;
-}
+// Chaos stores landscape holes as this material index
+static constexpr uint8 LandscapeHoleMaterialIndex = TNumericLimits<uint8>::Max();
 
-void UJoltPhysicsWorldSubsystem::InitializeSnapshotHistory()
+void UJoltPhysicsWorldSubsystem::AddLandscapeBodies(const UWorld* World, const ULevel* Level)
 {
-	int32 Desired = JoltSettings->SnapshotHistoryCapacity;
-	Desired = FMath::Max(Desired, MinSnapshotCapacity);
-
-	if (JoltSettings->bForcePowerOfTwoSnapshotCapacity)
+	if (!World || !JoltSettings->bRegisterLandscapeCollision) return;
+	
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::AddLandscapeBodies);
+	
+	auto AddProxy = [this](const ALandscapeProxy* Proxy)
 	{
-		Desired = RoundUpToPowerOfTwo(Desired);
-	}
-
-	;
-
-	SnapshotHistory.SetNum(Desired);
-	for (FJoltPhysicsSnapshotSlot& Slot : SnapshotHistory)
+		if (!Proxy) return;
+		
+		for (ULandscapeHeightfieldCollisionComponent* Component : Proxy->CollisionComponents)
+		{
+			AddLandscapeBody(Component);
+		}
+	};
+	
+	if (Level)
 	{
-		Slot.Reset();
+		for (const AActor* Actor : Level->Actors)
+		{
+			AddProxy(Cast<ALandscapeProxy>(Actor));
+		}
+		return;
 	}
-
-	UE_LOG(LogTemp, Log, TEXT("UJoltPhysicsWorldSubsystem: Snapshot history initialized. Capacity=%d"), Desired);
-}
-
-void UJoltPhysicsWorldSubsystem::EnsureSnapshotHistoryReady()
-{
-	if (SnapshotHistory.Num() <= 0)
+	
+	for (TActorIterator<ALandscapeProxy> It(World); It; ++It)
 	{
-		InitializeSnapshotHistory();
+		AddProxy(*It);
 	}
 }
 
-
-bool UJoltPhysicsWorldSubsystem::GetDataStreamForCommandFrame(const int32 CommandFrame, FString& DataStream) const
+void UJoltPhysicsWorldSubsystem::AddLandscapeBody(ULandscapeHeightfieldCollisionComponent* Component)
 {
-	if (SnapshotHistory.Num() == 0) return false;
+	if (!Component || !Component->IsRegistered() || Component->GetCollisionEnabled() == ECollisionEnabled::NoCollision) return;
+	if (LandscapeBodies.ContainsByPredicate([Component](const FJoltLandscapeBody& B) { return B.Component.Get() == Component; })) return;
+	
+	const JPH::ShapeRefC Shape = GetHeightFieldShape(Component);
+	if (!Shape) return;
+	
+	AActor* Proxy = Component->GetOwner();
+	const ALandscapeProxy* LandscapeProxy = Cast<ALandscapeProxy>(Proxy);
+	UPhysicalMaterial* PhysMaterial = LandscapeProxy && LandscapeProxy->DefaultPhysMaterial ? LandscapeProxy->DefaultPhysMaterial.Get() : GEngine->DefaultPhysMaterial.Get();
+	
+	FJoltPhysicsBodySettings Options;
+	Options.ShapeType = EJoltShapeType::STATIC;
+	Options.bGenerateOverlapEventsInJolt = false;
+	Options.bUsePhysicsMaterial = PhysMaterial != nullptr;
+	Options.PhysMaterial = PhysMaterial;
+	Options.Friction = PhysMaterial ? PhysMaterial->Friction : Options.Friction;
+	Options.Restitution = PhysMaterial ? PhysMaterial->Restitution : 0.f;
+	
+	const FCollisionResponseContainer& ResponseContainer = Component->GetCollisionResponseToChannels();
+	FJoltUserData* UserData = AllocUserData();
+	if (!UserData) return;
+	JoltHelpers::BuildResponseMasks(ResponseContainer, UserData->BlockMask, UserData->OverlapMask, UserData->CombinedMask);
+	UserData->ObjectChannel = (uint8)Component->GetCollisionObjectType();
+	UserData->DefaultRestitution = Options.Restitution;
+	UserData->DefaultSlidingFriction = Options.Friction;
+	UserData->Component = Component;
+	UserData->OwnerActor = Proxy;
+	UserData->PhysMaterial = PhysMaterial;
+	UserData->bGenerateHitEvents = Options.bGenerateCollisionEventsInJolt;
+	
+	// Sample spacing and height scale are baked into the shape, the body only carries location and yaw
+	const FTransform& CompTransform = Component->GetComponentTransform();
+	const FTransform BodyTransform(CompTransform.GetRotation(), CompTransform.GetLocation());
+	
+	JPH::Body* Body = AddStaticCollider(Shape.GetPtr(), BodyTransform, Options, UserData);
+	if (!Body)
+	{
+		UserDataArena.Free(UserData);
+		return;
+	}
+	
+	FJoltLandscapeBody& LandscapeBody = LandscapeBodies.AddDefaulted_GetRef();
+	LandscapeBody.Component = Component;
+	LandscapeBody.Proxy = Proxy;
+	LandscapeBody.Level = Component->GetComponentLevel();
+	LandscapeBody.BodyID = Body->GetID();
+	LandscapeBody.UserData = UserData;
+	
+	// Lets hits and shape id lookups resolve the collision component like any other registered primitive
+	FUnrealShapeDescriptor& Descriptor = GlobalShapeDescriptorDataCache.FindOrAdd(Proxy);
+	Descriptor.ShapeOwner = Proxy;
+	Descriptor.Add(Component, false);
+	Descriptor.Shapes.Last().Id = Body->GetID().GetIndexAndSequenceNumber();
+	Descriptor.Shapes.Last().CollisionResponses = ResponseContainer;
+}
+
+void UJoltPhysicsWorldSubsystem::RemoveLandscapeBodies(const ULevel* Level, TSet<uint32>& OutBodyIDs)
+{
+	for (int32 i = LandscapeBodies.Num() - 1; i >= 0; --i)
+	{
+		const FJoltLandscapeBody& LandscapeBody = LandscapeBodies[i];
+		if (LandscapeBody.Level != Level && LandscapeBody.Component.IsValid()) continue;
+		
+		const uint32 Id = LandscapeBody.BodyID.GetIndexAndSequenceNumber();
+		OutBodyIDs.Add(Id);
+		
+		if (FUnrealShapeDescriptor* Descriptor = GlobalShapeDescriptorDataCache.Find(LandscapeBody.Proxy))
+		{
+			Descriptor->Shapes.RemoveAllSwap([Id](const FUnrealShape& S) { return S.Id == Id; });
+			if (Descriptor->Shapes.IsEmpty())
+			{
+				GlobalShapeDescriptorDataCache.Remove(LandscapeBody.Proxy);
+			}
+		}
+		
+		LandscapeBodies.RemoveAtSwap(i);
+	}
+}
+
+JPH::ShapeRefC UJoltPhysicsWorldSubsystem::GetHeightFieldShape(const ULandscapeHeightfieldCollisionComponent* Component)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::GetHeightFieldShape);
+	
+	// Material indices in the heightfield point into the component's cooked physical materials
+	JPH::PhysicsMaterialList Materials;
+	for (const UPhysicalMaterial* Material : Component->CookedPhysicalMaterials)
+	{
+		const JoltPhysicsMaterial* JoltMaterial = Material ? GetJoltPhysicsMaterial(Material) : nullptr;
+		Materials.push_back(JoltMaterial ? JoltMaterial : JPH::PhysicsMaterial::sDefault.GetPtr());
+	}
+	
+	// Without a guid there is nothing identifying the height data, so the shape can only be built
+	if (!Component->HeightfieldGuid.IsValid())
+	{
+		return BuildHeightFieldShape(Component, Materials);
+	}
+	
+	const FVector Scale = Component->GetComponentTransform().GetScale3D();
+	const uint32 SettingsHash = HashCombine(HashCombine(GetTypeHash(Scale), GetTypeHash(Component->CollisionScale)), GetTypeHash(JoltSettings->HeightFieldBlockSize));
+	const FString CacheKey = FString::Printf(TEXT("%s_%d_%d_%08X_v%d"), *Component->HeightfieldGuid.ToString(EGuidFormats::Digits), Component->CollisionSizeQuads,
+		(int32)Materials.size(), SettingsHash, JoltHeightFieldCacheVersion);
+	
+	if (const JPH::ShapeRefC* Found = HeightFieldShapes.Find(CacheKey))
+	{
+		return *Found;
+	}
+	
+	const FString CachePath = JoltSettings->HeightFieldCacheDirectory.IsEmpty() ? FString() : FPaths::Combine(FPaths::ProjectDir(), JoltSettings->HeightFieldCacheDirectory, CacheKey + TEXT(".jhf"));
+	
+	JPH::ShapeRefC Shape;
+	TArray<uint8> CookedBytes;
+	if (!CachePath.IsEmpty() && FFileHelper::LoadFileToArray(CookedBytes, *CachePath, FILEREAD_Silent))
+	{
+		JPH::StateRecorderImpl Reader;
+		Reader.WriteBytes(CookedBytes.GetData(), CookedBytes.Num());
+		
+		JPH::Shape::ShapeResult Result = JPH::Shape::sRestoreFromBinaryState(Reader);
+		if (Result.IsValid() && !Reader.IsFailed())
+		{
+			// Materials are not part of the binary state, they are resolved against the live physical materials
+			Result.Get()->RestoreMaterialState(Materials.data(), (JPH::uint)Materials.size());
+			Shape = Result.Get();
+		}
+		else
+		{
+			UE_LOG(LogJoltBridge, Warning, TEXT("Ignoring unreadable cooked heightfield %s"), *CachePath);
+		}
+	}
+	
+	if (!Shape)
+	{
+		Shape = BuildHeightFieldShape(Component, Materials);
+		if (Shape && !CachePath.IsEmpty())
+		{
+			JPH::StateRecorderImpl Writer;
+			Shape->SaveBinaryState(Writer);
+			const std::string Data = Writer.GetData();
+			if (!FFileHelper::SaveArrayToFile(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Data.data()), (int32)Data.size()), *CachePath))
+			{
+				UE_LOG(LogJoltBridge, Verbose, TEXT("Could not write cooked heightfield %s"), *CachePath);
+			}
+		}
+	}
+	
+	if (Shape)
+	{
+		HeightFieldShapes.Add(CacheKey, Shape);
+	}
+	return Shape;
+}
+
+JPH::ShapeRefC UJoltPhysicsWorldSubsystem::BuildHeightFieldShape(const ULandscapeHeightfieldCollisionComponent* Component, const JPH::PhysicsMaterialList& Materials) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::BuildHeightFieldShape);
+	
+	const int32 NumSamples = Component->CollisionSizeQuads + 1;
+	const int32 NumCells = NumSamples - 1;
+	if (NumCells <= 0) return nullptr;
+	
+	// World space heights, one per collision vertex
+	TArray<float> Heights;
+	Heights.SetNumUninitialized(NumSamples * NumSamples);
+	if (!Component->FillHeightTile(Heights, 0, NumSamples))
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("%s has no heightfield collision data, skipping"), *GetPathNameSafe(Component));
+		return nullptr;
+	}
+	
+	TArray<uint8> CellMaterials;
+	CellMaterials.SetNumZeroed(NumCells * NumCells);
+	Component->FillMaterialIndexTile(CellMaterials, 0, NumCells);
+	
+	// Jolt wants a whole number of blocks per side, the extra samples are padded out as holes
+	const int32 BlockSize = FMath::Clamp(JoltSettings->HeightFieldBlockSize, 2, 8);
+	const int32 PaddedSamples = FMath::DivideAndRoundUp(NumSamples, BlockSize) * BlockSize;
+	const int32 PaddedCells = PaddedSamples - 1;
+	
+	const float ComponentZ = Component->GetComponentLocation().Z;
+	auto IsHole = [&CellMaterials, NumCells](int32 X, int32 Y)
+	{
+		return X < 0 || Y < 0 || X >= NumCells || Y >= NumCells || CellMaterials[Y * NumCells + X] == LandscapeHoleMaterialIndex;
+	};
+	
+	TArray<float> Samples;
+	Samples.Init(JPH::HeightFieldShapeConstants::cNoCollisionValue, PaddedSamples * PaddedSamples);
+	TArray<uint8> MaterialIndices;
+	MaterialIndices.SetNumZeroed(PaddedCells * PaddedCells);
+	
+	for (int32 Y = 0; Y < NumSamples; ++Y)
+	{
+		for (int32 X = 0; X < NumSamples; ++X)
+		{
+			// Jolt drops every triangle touching a no-collision sample, while landscape holes are per cell. Only samples whose
+			// surrounding cells are all holes are removed, so hole edges never open up solid cells next to them.
+			const bool bHole = IsHole(X - 1, Y - 1) && IsHole(X, Y - 1) && IsHole(X - 1, Y) && IsHole(X, Y);
+			if (!bHole)
+			{
+				Samples[Y * PaddedSamples + X] = Heights[Y * NumSamples + X] - ComponentZ;
+			}
+			
+			if (X < NumCells && Y < NumCells)
+			{
+				const uint8 MaterialIndex = CellMaterials[Y * NumCells + X];
+				MaterialIndices[Y * PaddedCells + X] = MaterialIndex < Materials.size() ? MaterialIndex : 0;
+			}
+		}
+	}
+	
+	// Sample X runs along the component's X axis and sample Y along its Y axis, which Jolt calls Z. Heights are in cm above the component.
+	const FVector Scale = Component->GetComponentTransform().GetScale3D() * Component->CollisionScale;
+	const JPH::Vec3 JoltScale(Scale.X * WORLD_TO_JOLT_SCALE, WORLD_TO_JOLT_SCALE, Scale.Y * WORLD_TO_JOLT_SCALE);
+	
+	JPH::HeightFieldShapeSettings Settings(Samples.GetData(), JPH::Vec3::sZero(), JoltScale, PaddedSamples, MaterialIndices.GetData(), Materials);
+	Settings.mBlockSize = BlockSize;
+	
+	const JPH::ShapeSettings::ShapeResult Result = Settings.Create();
+	if (Result.HasError())
+	{
+		UE_LOG(LogJoltBridge, Error, TEXT("Failed to build heightfield for %s: %hs"), *GetPathNameSafe(Component), Result.GetError().c_str());
+		return nullptr;
+	}
+	return Result.Get();
+}
+
+void UJoltPhysicsWorldSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld() || !MainPhysicsSystem || !Level) return;
+	AddLevelBodies(World, Level);
+}
+
+void UJoltPhysicsWorldSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld() || !MainPhysicsSystem) return;
+	RemoveLevelBodies(Level);
+}
+
+#pragma endregion
+
+
+#pragma region LEVEL STREAMING
+void UJoltPhysicsWorldSubsystem::AddLevelBodies(const UWorld* World, const ULevel* Level)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::AddLevelBodies);
+	
+	if (LevelBodySets.Contains(Level)) return;
+	
+	TUniquePtr<FJoltLevelBodySet> Set = MakeUnique<FJoltLevelBodySet>();
+	PendingLevelBodySet = Set.Get();
+	AddAllJoltActors(World, Level);
+	AddLandscapeBodies(World, Level);
+	PendingLevelBodySet = nullptr;
+	
+	if (Set->BodyIDs.IsEmpty()) return;
+	
+	// Building the broadphase subtree for the whole level is the expensive part of adding it. Jolt allows it to run alongside
+	// the simulation, only the finalize step touches the live broadphase and that happens at the start of a later step.
+	FJoltLevelBodySet* SetPtr = Set.Get();
+	JPH::BodyInterface* Interface = BodyInterface;
+	SetPtr->PrepareTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [SetPtr, Interface]()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::PrepareLevelBodies);
+		SetPtr->AddState = Interface->AddBodiesPrepare(SetPtr->BodyIDs.GetData(), SetPtr->BodyIDs.Num());
+	});
+	
+	LevelBodySets.Add(Level, MoveTemp(Set));
+}
+
+void UJoltPhysicsWorldSubsystem::FinalizeLevelBodySets()
+{
+	for (TPair<const ULevel*, TUniquePtr<FJoltLevelBodySet>>& Pair : LevelBodySets)
+	{
+		FJoltLevelBodySet& Set = *Pair.Value;
+		if (Set.bInBroadPhase || !Set.PrepareTask.IsCompleted()) continue;
+		
+		TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::FinalizeLevelBodySets);
+		BodyInterface->AddBodiesFinalize(Set.BodyIDs.GetData(), Set.BodyIDs.Num(), Set.AddState, JPH::EActivation::DontActivate);
+		if (!Set.BodiesToActivate.IsEmpty())
+		{
+			BodyInterface->ActivateBodies(Set.BodiesToActivate.GetData(), Set.BodiesToActivate.Num());
+		}
+		
+		Set.AddState = nullptr;
+		Set.bInBroadPhase = true;
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::AbortLevelBodySet(FJoltLevelBodySet& Set) const
+{
+	Set.PrepareTask.Wait();
+	MainPhysicsSystem->GetBodyInterface().AddBodiesAbort(Set.BodyIDs.GetData(), Set.BodyIDs.Num(), Set.AddState);
+	Set.AddState = nullptr;
+}
+
+void UJoltPhysicsWorldSubsystem::RemoveLevelBodies(const ULevel* Level)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::RemoveLevelBodies);
+	
+	TUniquePtr<FJoltLevelBodySet> Set;
+	if (LevelBodySets.RemoveAndCopyValue(Level, Set) && !Set->bInBroadPhase)
+	{
+		AbortLevelBodySet(*Set);
+	}
+	
+	// Every body of the level, whether it came in with the level or was registered later on by one of its actors
+	TSet<uint32> BodyIDs;
+	RemoveLandscapeBodies(Level, BodyIDs);
+	for (auto It = GlobalShapeDescriptorDataCache.CreateIterator(); It; ++It)
+	{
+		const AActor* Owner = It->Value.ShapeOwner.Get();
+		if (!Owner || Owner->GetLevel() != Level) continue;
+		
+		for (const FUnrealShape& Shape : It->Value.Shapes)
+		{
+			if (Shape.Id != 0)
+			{
+				BodyIDs.Add(Shape.Id);
+			}
+		}
+		It.RemoveCurrent();
+	}
+	
+	DestroyJoltBodies(BodyIDs);
+}
+
+void UJoltPhysicsWorldSubsystem::DestroyJoltBodies(const TSet<uint32>& BodyIDs)
+{
+	if (BodyIDs.IsEmpty()) return;
+	
+	// A set that has not reached the broadphase yet would add the destroyed bodies later on, prepare it again without them
+	for (TPair<const ULevel*, TUniquePtr<FJoltLevelBodySet>>& Pair : LevelBodySets)
+	{
+		FJoltLevelBodySet& Set = *Pair.Value;
+		if (Set.bInBroadPhase || !Set.BodyIDs.ContainsByPredicate([&BodyIDs](const JPH::BodyID& ID) { return BodyIDs.Contains(ID.GetIndexAndSequenceNumber()); })) continue;
+		
+		AbortLevelBodySet(Set);
+		Set.BodyIDs.RemoveAll([&BodyIDs](const JPH::BodyID& ID) { return BodyIDs.Contains(ID.GetIndexAndSequenceNumber()); });
+		Set.BodiesToActivate.RemoveAll([&BodyIDs](const JPH::BodyID& ID) { return BodyIDs.Contains(ID.GetIndexAndSequenceNumber()); });
+		Set.AddState = Set.BodyIDs.IsEmpty() ? nullptr : BodyInterface->AddBodiesPrepare(Set.BodyIDs.GetData(), Set.BodyIDs.Num());
+		Set.PrepareTask = UE::Tasks::FTask();
+	}
+	
+	TArray<JPH::BodyID> ToRemove;
+	TArray<JPH::BodyID> ToDestroy;
+	TSet<const FJoltUserData*> UserDataToFree;
+	ToRemove.Reserve(BodyIDs.Num());
+	ToDestroy.Reserve(BodyIDs.Num());
+	for (const uint32 Id : BodyIDs)
+	{
+		JPH::Body* Body = nullptr;
+		if (!BodyIDBodyMap.RemoveAndCopyValue(Id, Body) || !Body) continue;
+		
+		const JPH::BodyID BodyID(Id);
+		UserDataToFree.Add(reinterpret_cast<const FJoltUserData*>(Body->GetUserData()));
+		ToDestroy.Add(BodyID);
+		
+		// Overrides are stored per body index, a body created later in the same slot must not inherit them
+		if (ContactListener)
+		{
+			ContactListener->ClearBodyContactOverride(BodyID);
+		}
+		if (BodyInterface->IsAdded(BodyID))
+		{
+			ToRemove.Add(BodyID);
+		}
+	}
+	
+	if (!ToRemove.IsEmpty())
+	{
+		BodyInterface->RemoveBodies(ToRemove.GetData(), ToRemove.Num());
+	}
+	BodyInterface->DestroyBodies(ToDestroy.GetData(), ToDestroy.Num());
+	ActiveBodyTracker->MarkAllMoved();
+	SnapshotTrackedBodies.RemoveFromBodyIDAllowList(ToDestroy);
+	
+	const int32 NumSkeletalBodies = SkeletalBodies.Num();
+	SkeletalBodies.RemoveAll([&BodyIDs](const FJoltSkeletalBody& B) { return BodyIDs.Contains(B.BodyID.GetIndexAndSequenceNumber()); });
+	if (SkeletalBodies.Num() != NumSkeletalBodies)
+	{
+		SkeletalBodyIndexByBodyID.Reset();
+		for (int32 i = 0; i < SkeletalBodies.Num(); ++i)
+		{
+			SkeletalBodyIndexByBodyID.Add(SkeletalBodies[i].BodyID.GetIndexAndSequenceNumber(), i);
+		}
+	}
+	
+	for (const FJoltUserData* UserData : UserDataToFree)
+	{
+		UserDataArena.Free(UserData);
+	}
+}
+
+#pragma endregion
+
+
+#pragma region LARGE WORLD
+void UJoltPhysicsWorldSubsystem::RequestOriginRebase(const FIntVector& NewOrigin)
+{
+	UWorld* World = GetWorld();
+	if (!JoltSettings->bEnableOriginRebasing || !World) return;
+	
+	const int32 Grid = FMath::Max(JoltSettings->OriginRebaseGridSize, 1);
+	const FIntVector Snapped(
+		FMath::RoundToInt((double)NewOrigin.X / Grid) * Grid,
+		FMath::RoundToInt((double)NewOrigin.Y / Grid) * Grid,
+		FMath::RoundToInt((double)NewOrigin.Z / Grid) * Grid);
+	
+	// UE applies the request at the start of its next tick, before any physics step of that frame
+	if (Snapped != World->OriginLocation)
+	{
+		World->RequestNewWorldOrigin(Snapped);
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::OnPostWorldOriginOffset(UWorld* InWorld, const FIntVector SrcOrigin, const FIntVector DstOrigin)
+{
+	if (InWorld != GetWorld() || !MainPhysicsSystem) return;
+	
+	UE_LOG(LogJoltBridge, Log, TEXT("Rebasing Jolt world from %s to %s"), *SrcOrigin.ToString(), *DstOrigin.ToString());
+	ShiftJoltWorld(DstOrigin - SrcOrigin);
+	JoltWorldOrigin = DstOrigin;
+}
+
+void UJoltPhysicsWorldSubsystem::ShiftJoltWorld(const FIntVector& Offset)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::ShiftJoltWorld);
+	
+	if (Offset == FIntVector::ZeroValue) return;
+	
+	// Level batches still waiting for the broadphase were prepared with their old bounds, build them again once moved
+	TArray<FJoltLevelBodySet*> PendingSets;
+	for (TPair<const ULevel*, TUniquePtr<FJoltLevelBodySet>>& Pair : LevelBodySets)
+	{
+		if (!Pair.Value->bInBroadPhase)
+		{
+			AbortLevelBodySet(*Pair.Value);
+			PendingSets.Add(Pair.Value.Get());
+		}
+	}
+	
+	// Whole centimetres converted like any other position, so the same offset gives the same bits on every peer
+	const JPH::RVec3 JoltOffset = JoltHelpers::ToJoltPosition(FVector(Offset));
+	ActiveBodyTracker->MarkAllMoved();
+	
+	JPH::BodyIDVector BodyIDs;
+	MainPhysicsSystem->GetBodies(BodyIDs);
+	for (const JPH::BodyID& ID : BodyIDs)
+	{
+		BodyInterface->SetPosition(ID, BodyInterface->GetPosition(ID) - JoltOffset, JPH::EActivation::DontActivate);
+	}
+	
+	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
+	{
+		C.Value->SetPosition(C.Value->GetPosition() - JoltOffset);
+	}
+	
+	for (FJoltLevelBodySet* Set : PendingSets)
+	{
+		Set->AddState = BodyInterface->AddBodiesPrepare(Set->BodyIDs.GetData(), Set->BodyIDs.Num());
+		Set->PrepareTask = UE::Tasks::FTask();
+	}
+}
+#pragma endregion
+
+
+#pragma region TRANSFORM WRITE BACK
+void UJoltPhysicsWorldSubsystem::AddTransformWriteBack(USceneComponent* Component, const JPH::BodyID& BodyID, const FTransform& BodyToComponent, const bool bCenterOfMass)
+{
+	if (!Component || BodyID.IsInvalid()) return;
+	
+	if (Component->Mobility != EComponentMobility::Movable)
+	{
+		UE_LOG(LogJoltBridge, Warning, TEXT("%s is not movable and cannot follow its Jolt body"), *GetPathNameSafe(Component));
+		return;
+	}
+	
+	int32 Index;
+	if (const int32* Existing = WriteBackIndexByComponent.Find(Component))
+	{
+		Index = *Existing;
+	}
+	else
+	{
+		Index = WriteBacks.AddDefaulted();
+		WriteBackBodyIDs.AddDefaulted();
+		WriteBackLastRead.AddDefaulted();
+		WriteBackIndexByComponent.Add(Component, Index);
+		bWriteBackOrderDirty = true;
+	}
+	
+	FJoltTransformWriteBack& WriteBack = WriteBacks[Index];
+	WriteBack.Component = Component;
+	WriteBack.BodyToComponent = BodyToComponent;
+	WriteBack.BodyToComponent.SetScale3D(FVector::OneVector);
+	WriteBack.bCenterOfMass = bCenterOfMass;
+	WriteBack.bBodyFound = false;
+	WriteBackBodyIDs[Index] = BodyID;
+	
+	// W is always 0 once read, so the next pass sees the body as moved
+	WriteBackLastRead[Index].Position[3] = 1;
+	ActiveBodyTracker->MarkMoved(BodyID);
+}
+
+bool UJoltPhysicsWorldSubsystem::AddTransformWriteBack(USceneComponent* Component, const UPrimitiveComponent* BodyComponent, const bool bCenterOfMass)
+{
+	const int32 ShapeId = FindShapeId(BodyComponent);
+	if (!Component || ShapeId == INDEX_NONE) return false;
+	
+	const JPH::BodyID ID(ShapeId);
+	const FTransform BodyTransform = JoltHelpers::ToUnrealTransform(bCenterOfMass ? BodyInterface->GetCenterOfMassTransform(ID) : BodyInterface->GetWorldTransform(ID));
+	AddTransformWriteBack(Component, ID, Component->GetComponentTransform().GetRelativeTransform(BodyTransform), bCenterOfMass);
+	return WriteBackIndexByComponent.Contains(Component);
+}
+
+void UJoltPhysicsWorldSubsystem::RemoveTransformWriteBack(const USceneComponent* Component)
+{
+	int32 Index;
+	if (WriteBackIndexByComponent.RemoveAndCopyValue(Component, Index))
+	{
+		// Indices stay valid until the next pass compacts the arrays
+		WriteBacks[Index].Component.Reset();
+		bWriteBackOrderDirty = true;
+	}
+}
+
+bool UJoltPhysicsWorldSubsystem::GetWriteBackState(const USceneComponent* Component, FTransform& OutBodyTransform, FVector& OutVelocity, FVector& OutAngularVelocity) const
+{
+	const int32* Index = WriteBackIndexByComponent.Find(Component);
+	if (!Index || !WriteBacks[*Index].bBodyFound) return false;
+	
+	const FJoltTransformWriteBack& WriteBack = WriteBacks[*Index];
+	OutBodyTransform = WriteBack.BodyTransform;
+	OutVelocity = WriteBack.LinearVelocity;
+	OutAngularVelocity = WriteBack.AngularVelocity;
+	return true;
+}
+
+void UJoltPhysicsWorldSubsystem::SortTransformWriteBacks()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::SortTransformWriteBacks);
+	
+	bWriteBackOrderDirty = false;
+	
+	TArray<TPair<int32, int32>> DepthAndIndex;
+	DepthAndIndex.Reserve(WriteBacks.Num());
+	for (int32 i = 0; i < WriteBacks.Num(); ++i)
+	{
+		const USceneComponent* Component = WriteBacks[i].Component.Get();
+		if (!Component) continue;
+		
+		int32 Depth = 0;
+		for (const USceneComponent* Parent = Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+		{
+			++Depth;
+		}
+		DepthAndIndex.Emplace(Depth, i);
+	}
+	
+	// Stable, so the order bodies were registered in (and with it the lock order) only changes when it has to
+	Algo::StableSortBy(DepthAndIndex, [](const TPair<int32, int32>& Pair) { return Pair.Key; });
+	
+	TArray<FJoltTransformWriteBack> SortedWriteBacks;
+	TArray<JPH::BodyID> SortedBodyIDs;
+	TArray<FJoltPackedTransform> SortedLastRead;
+	SortedWriteBacks.Reserve(DepthAndIndex.Num());
+	SortedBodyIDs.Reserve(DepthAndIndex.Num());
+	SortedLastRead.Reserve(DepthAndIndex.Num());
+	WriteBackIndexByComponent.Reset();
+	for (const TPair<int32, int32>& Pair : DepthAndIndex)
+	{
+		WriteBackIndexByComponent.Add(WriteBacks[Pair.Value].Component.Get(), SortedWriteBacks.Num());
+		SortedWriteBacks.Add(MoveTemp(WriteBacks[Pair.Value]));
+		SortedBodyIDs.Add(WriteBackBodyIDs[Pair.Value]);
+		SortedLastRead.Add(WriteBackLastRead[Pair.Value]);
+	}
+	WriteBacks = MoveTemp(SortedWriteBacks);
+	WriteBackBodyIDs = MoveTemp(SortedBodyIDs);
+	WriteBackLastRead = MoveTemp(SortedLastRead);
+}
+
+void UJoltPhysicsWorldSubsystem::WriteBackTransforms(const bool bMovedBodiesOnly)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::WriteBackTransforms);
+	
+	if (!MainPhysicsSystem || WriteBacks.IsEmpty()) return;
+	
+	if (bWriteBackOrderDirty)
+	{
+		SortTransformWriteBacks();
+	}
+	
+	// Sleeping bodies keep their transform, so a step only needs the ones the tracker saw moving
+	ReadWriteBacks.Reset();
+	ReadBodyIDs.Reset();
+	const bool bReadAll = !bMovedBodiesOnly || ActiveBodyTracker->AreAllMoved();
+	for (int32 i = 0; i < WriteBacks.Num(); ++i)
+	{
+		if (bReadAll || ActiveBodyTracker->HasMoved(WriteBackBodyIDs[i]))
+		{
+			ReadWriteBacks.Add(i);
+			ReadBodyIDs.Add(WriteBackBodyIDs[i]);
+		}
+	}
+	
+	MovedWriteBacks.Reset();
+	MovedPackedTransforms.Reset();
+	if (!ReadWriteBacks.IsEmpty())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::WriteBackTransforms::Read);
+		
+		// Every body mutex involved is taken once for the whole pass instead of once per body. Removed bodies come back null.
+		const JPH::BodyLockMultiRead Lock(MainPhysicsSystem->GetBodyLockInterface(), ReadBodyIDs.GetData(), ReadBodyIDs.Num());
+		for (int32 r = 0; r < ReadWriteBacks.Num(); ++r)
+		{
+			const int32 i = ReadWriteBacks[r];
+			FJoltTransformWriteBack& WriteBack = WriteBacks[i];
+			const JPH::Body* Body = Lock.GetBody(r);
+			WriteBack.bBodyFound = Body != nullptr;
+			if (!Body) continue;
+			
+			WriteBack.LinearVelocity = JoltHelpers::ToUnrealVector3(Body->GetLinearVelocity());
+			WriteBack.AngularVelocity = JoltHelpers::ToUnrealVector3(Body->GetAngularVelocity());
+			
+			FJoltPackedTransform Read;
+			Read.Set(WriteBack.bCenterOfMass ? Body->GetCenterOfMassPosition() : Body->GetPosition(), Body->GetRotation());
+			if (FMemory::Memcmp(&Read, &WriteBackLastRead[i], sizeof(FJoltPackedTransform)) == 0) continue;
+			
+			WriteBackLastRead[i] = Read;
+			MovedWriteBacks.Add(i);
+			MovedPackedTransforms.Add(Read);
+		}
+	}
+	
+	if (MovedWriteBacks.IsEmpty()) return;
+	
+	MovedTransforms.SetNumUninitialized(MovedPackedTransforms.Num(), EAllowShrinking::No);
+	JoltHelpers::ToUnrealTransforms(MovedPackedTransforms, MovedTransforms);
+	
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltPhysicsWorldSubsystem::WriteBackTransforms::Apply);
+	
+	WriteBackOverlapUpdates.Reset();
+	for (int32 m = 0; m < MovedWriteBacks.Num(); ++m)
+	{
+		FJoltTransformWriteBack& WriteBack = WriteBacks[MovedWriteBacks[m]];
+		WriteBack.BodyTransform = MovedTransforms[m];
+		
+		USceneComponent* Component = WriteBack.Component.Get();
+		if (!Component)
+		{
+			bWriteBackOrderDirty = true;
+			continue;
+		}
+		
+		FTransform NewTransform = WriteBack.BodyToComponent * WriteBack.BodyTransform;
+		NewTransform.SetScale3D(Component->GetComponentScale());
+		
+		if (Component->IsUsingAbsoluteLocation() || Component->IsUsingAbsoluteRotation())
+		{
+			Component->SetWorldTransform(NewTransform, false, nullptr, ETeleportType::TeleportPhysics);
+			continue;
+		}
+		
+		// Set the relative transform directly and propagate once, MoveComponent would also sweep, update overlaps and
+		// push the transform back into the UE physics body
+		const USceneComponent* Parent = Component->GetAttachParent();
+		const FTransform Relative = Parent ? NewTransform.GetRelativeTransform(Parent->GetSocketTransform(Component->GetAttachSocketName())) : NewTransform;
+		Component->SetRelativeLocation_Direct(Relative.GetLocation());
+		Component->SetRelativeRotation_Direct(Relative.Rotator());
+		Component->UpdateComponentToWorld(EUpdateTransformFlags::SkipPhysicsUpdate, ETeleportType::TeleportPhysics);
+		
+		UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+		if (Primitive && Primitive->GetGenerateOverlapEvents())
+		{
+			WriteBackOverlapUpdates.Add(Primitive);
+		}
+	}
+	
+	for (UPrimitiveComponent* Primitive : WriteBackOverlapUpdates)
+	{
+		Primitive->UpdateOverlaps();
+	}
+}
+#pragma endregion
+
+
+#pragma region SNAPSHOT HISTORY
+static constexpr int32 MinSnapshotCapacity = 8;
+
+DECLARE_STATS_GROUP(TEXT("JoltSnapshots"), STATGROUP_JoltSnapshots, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Snapshot History Memory"), STAT_JoltSnapshotHistoryMemory, STATGROUP_JoltSnapshots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Snapshot History Capacity"), STAT_JoltSnapshotHistoryCapacity, STATGROUP_JoltSnapshots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Average Snapshot Bytes"), STAT_JoltSnapshotAverageBytes, STATGROUP_JoltSnapshots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Required Rollback Frames"), STAT_JoltSnapshotRequiredRollbackFrames, STATGROUP_JoltSnapshots);
+
+TRACE_DECLARE_MEMORY_COUNTER(JoltSnapshotHistoryMemory, TEXT("JoltBridge/Snapshots/Memory"));
+TRACE_DECLARE_INT_COUNTER(JoltSnapshotHistoryCapacity, TEXT("JoltBridge/Snapshots/Capacity"));
+
+int32 UJoltPhysicsWorldSubsystem::RoundUpToPowerOfTwo(int32 Value)
+{
+	if (Value <= 1) return 1;
+	// Round up to next power of two
+	Value--;
+	Value |= Value >> 1;
+	Value |= Value >> 2;
+	Value |= Value >> 4;
+	Value |= Value >> 8;
+	Value |= Value >> 16;
+	Value++;
+	return Value;
+}
+
+void UJoltPhysicsWorldSubsystem::InitializeSnapshotHistory()
+{
+	int32 Desired = JoltSettings->SnapshotHistoryCapacity;
+	Desired = FMath::Max(Desired, MinSnapshotCapacity);
+
+	if (JoltSettings->bForcePowerOfTwoSnapshotCapacity)
+	{
+		Desired = RoundUpToPowerOfTwo(Desired);
+	}
+
+	;
+
+	SnapshotHistory.SetNum(Desired);
+	for (FJoltPhysicsSnapshotSlot& Slot : SnapshotHistory)
+	{
+		Slot.Reset();
+	}
+	SnapshotHistoryCapacity = Desired;
+	
+	LatestSavedFrame = INDEX_NONE;
+	RollbackDepthThisInterval = 0;
+	RollbackDepthLastInterval = 0;
+	SavesSinceResizeCheck = 0;
+	SnapshotBytesAllocated = 0;
+	UpdateSnapshotMemoryStats();
+
+	UE_LOG(LogTemp, Log, TEXT("UJoltPhysicsWorldSubsystem: Snapshot history initialized. Capacity=%d"), Desired);
+}
+
+void UJoltPhysicsWorldSubsystem::EnsureSnapshotHistoryReady()
+{
+	if (SnapshotHistory.Num() <= 0)
+	{
+		InitializeSnapshotHistory();
+	}
+}
+
+
+bool UJoltPhysicsWorldSubsystem::GetDataStreamForCommandFrame(const int32 CommandFrame, FString& DataStream) const
+{
+	if (SnapshotHistory.Num() == 0) return false;
 	
 	const int32 SlotIdx = FrameToSlotIndex(CommandFrame);
 	
@@ -2225,6 +3425,7 @@ bool UJoltPhysicsWorldSubsystem::RestorePhysicsStateFromDataStream(const FString
 
 	// Must match what you saved: Bodies (and any other categories you saved)
 	MainPhysicsSystem->RestoreState(Reader, nullptr);
+	ActiveBodyTracker->MarkAllMoved();
 
 	// Restore your virtual characters too (must match SaveState)
 	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
@@ -2254,9 +3455,23 @@ int32 UJoltPhysicsWorldSubsystem::FrameToSlotIndex(const int32 CommandFrame) con
 
 void UJoltPhysicsWorldSubsystem::SaveStateForFrame(const int32 CommandFrame, const JPH::StateRecorderFilter* SaveFilter)
 {
-	if (!JoltSettings->bStoreSnapshotsOnServer && (GetWorld()->GetNetMode() == NM_DedicatedServer))
+	if (GetWorld()->GetNetMode() == NM_DedicatedServer)
 	{
-		return;
+		if (!JoltSettings->bStoreSnapshotsOnServer)
+		{
+			return;
+		}
+		
+		const EServerSnapshotMode Mode = GetServerSnapshotMode(CommandFrame);
+		PendingServerSnapshotFrames = FMath::Max(PendingServerSnapshotFrames - 1, 0);
+		if (Mode == EServerSnapshotMode::None)
+		{
+			return;
+		}
+		if (Mode == EServerSnapshotMode::Partial && !SaveFilter)
+		{
+			SaveFilter = &SnapshotTrackedBodies;
+		}
 	}
 	
 	EnsureSnapshotHistoryReady();
@@ -2266,74 +3481,361 @@ void UJoltPhysicsWorldSubsystem::SaveStateForFrame(const int32 CommandFrame, con
 
 	const int32 SlotIdx = FrameToSlotIndex(CommandFrame);
 	FJoltPhysicsSnapshotSlot& Slot = SnapshotHistory[SlotIdx];
+	
+	// A single step that touched nothing separates this frame from the one saved last, so that snapshot is this frame's too
+	const FJoltPhysicsSnapshotSlot* QuietSource = nullptr;
+	if (JoltSettings->bReuseQuietFrameSnapshots && !SaveFilter && VirtualCharacterMap.IsEmpty() && LastSaveFrame != INDEX_NONE && CommandFrame == LastSaveFrame + 1
+		&& ActiveBodyTracker->GetStepCount() == LastSaveStepCount + 1 && ActiveBodyTracker->IsQuiet())
+	{
+		const FJoltPhysicsSnapshotSlot& Previous = SnapshotHistory[FrameToSlotIndex(LastSaveFrame)];
+		if (&Previous != &Slot && Previous.Frame == LastSaveFrame && !Previous.bPartial && Previous.Origin == JoltWorldOrigin)
+		{
+			QuietSource = &Previous;
+		}
+	}
+	LastSaveFrame = CommandFrame;
+	LastSaveStepCount = ActiveBodyTracker->GetStepCount();
 
-	// Create a recorder on the stack (no heap alloc needed).
-	Snapshot.Reset();
-	JPH::StateRecorderImpl Recorder;
+	// Overwrite (do NOT append). This keeps memory bounded.
+	SnapshotBytesAllocated -= Slot.Bytes.GetAllocatedSize();
+	Slot.Frame = CommandFrame;
+	Slot.Origin = JoltWorldOrigin;
+	Slot.bPartial = SaveFilter != nullptr;
+	
+	if (QuietSource)
+	{
+		Slot.Bytes = QuietSource->Bytes;
+	}
+	else
+	{
+		// Create a recorder on the stack (no heap alloc needed).
+		Snapshot.Reset();
+		JPH::StateRecorderImpl Recorder;
 
-	// Save only "Bodies" state per your earlier approach; adjust if you need more.
-	// If you later decide to include constraints, broaden EStateRecorderState accordingly.
-	MainPhysicsSystem->SaveState(Recorder, JPH::EStateRecorderState::All, SaveFilter);
+		// Save only "Bodies" state per your earlier approach; adjust if you need more.
+		// If you later decide to include constraints, broaden EStateRecorderState accordingly.
+		MainPhysicsSystem->SaveState(Recorder, JPH::EStateRecorderState::All, SaveFilter);
 
-	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
+		for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
+		{
+			C.Value->SaveState(Recorder);
+		}
+
+		const std::string Data = Recorder.GetData();
+		
+		Slot.Bytes.SetNumUninitialized(static_cast<int32>(Data.size()));
+		if (!Slot.Bytes.IsEmpty())
+		{
+			FMemory::Memcpy(Slot.Bytes.GetData(), Data.data(), Data.size());
+		}
+	}
+	SnapshotBytesAllocated += Slot.Bytes.GetAllocatedSize();
+	
+	// Rollback resimulation saves older frames again, only a new frame moves the head of the history
+	LatestSavedFrame = FMath::Max(LatestSavedFrame, CommandFrame);
+	UpdateAdaptiveSnapshotHistory(Slot.Bytes.Num());
+}
+
+void UJoltPhysicsWorldSubsystem::ReportRollbackWindow(const int32 NumFrames)
+{
+	RollbackDepthThisInterval = FMath::Max(RollbackDepthThisInterval, NumFrames);
+}
+
+int32 UJoltPhysicsWorldSubsystem::ComputeAdaptiveSnapshotCapacity() const
+{
+	const int32 MinCapacity = FMath::Max(JoltSettings->MinSnapshotHistoryCapacity, MinSnapshotCapacity);
+	const int32 MaxCapacity = FMath::Max(JoltSettings->MaxSnapshotHistoryCapacity, MinCapacity);
+
+	// The memory budget caps the rollback distance, the minimum capacity caps the budget
+	int32 UpperCapacity = MaxCapacity;
+	if (JoltSettings->SnapshotMemoryBudgetMB > 0.f && AverageSnapshotBytes > 0.0)
 	{
-		C.Value->SaveState(Recorder);
+		const double BudgetBytes = JoltSettings->SnapshotMemoryBudgetMB * 1024.0 * 1024.0;
+		UpperCapacity = FMath::Max((int32)FMath::Min(BudgetBytes / AverageSnapshotBytes, (double)MaxCapacity), MinCapacity);
 	}
 
-	const std::string Data = Recorder.GetData();
-	
+	// +1 keeps the latest frame and the deepest one it may roll back to in separate slots
+	const int32 RequiredFrames = FMath::Max(RollbackDepthThisInterval, RollbackDepthLastInterval) + 1 + JoltSettings->SnapshotHistorySlackFrames;
+	int32 Capacity = FMath::Clamp(RequiredFrames, MinCapacity, UpperCapacity);
 
-	// Overwrite (do NOT append). This keeps memory bounded.
-	Slot.Frame = CommandFrame;
-	Slot.Bytes.SetNumUninitialized(static_cast<int32>(Data.size()));
-	if (!Slot.Bytes.IsEmpty())
+	if (JoltSettings->bForcePowerOfTwoSnapshotCapacity)
 	{
-		FMemory::Memcpy(Slot.Bytes.GetData(), Data.data(), Data.size());
+		Capacity = RoundUpToPowerOfTwo(Capacity);
+		if (Capacity > UpperCapacity && Capacity / 2 >= MinCapacity)
+		{
+			Capacity /= 2;
+		}
 	}
+	return Capacity;
+}
+
+void UJoltPhysicsWorldSubsystem::ResizeSnapshotHistory(const int32 NewCapacity)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltPhysicsWorldSubsystem::ResizeSnapshotHistory);
 	
+	TArray<FJoltPhysicsSnapshotSlot> OldHistory = MoveTemp(SnapshotHistory);
+	SnapshotHistory.SetNum(NewCapacity);
+	SnapshotHistoryCapacity = NewCapacity;
+	SnapshotBytesAllocated = 0;
+
+	for (FJoltPhysicsSnapshotSlot& OldSlot : OldHistory)
+	{
+		if (OldSlot.Frame == INDEX_NONE)
+		{
+			continue;
+		}
+
+		FJoltPhysicsSnapshotSlot& NewSlot = SnapshotHistory[FrameToSlotIndex(OldSlot.Frame)];
+		if (NewSlot.Frame == INDEX_NONE || NewSlot.Frame < OldSlot.Frame)
+		{
+			NewSlot = MoveTemp(OldSlot);
+		}
+	}
+
+	for (const FJoltPhysicsSnapshotSlot& Slot : SnapshotHistory)
+	{
+		SnapshotBytesAllocated += Slot.Bytes.GetAllocatedSize();
+	}
+
+	UE_LOG(LogJoltBridge, Verbose, TEXT("UJoltPhysicsWorldSubsystem: Snapshot history resized %d -> %d (rollback depth %d, average snapshot %d bytes)"),
+		OldHistory.Num(), NewCapacity, FMath::Max(RollbackDepthThisInterval, RollbackDepthLastInterval), (int32)AverageSnapshotBytes);
+}
+
+void UJoltPhysicsWorldSubsystem::UpdateAdaptiveSnapshotHistory(const int32 SavedBytes)
+{
+	AverageSnapshotBytes = AverageSnapshotBytes > 0.0 ? FMath::Lerp(AverageSnapshotBytes, (double)SavedBytes, 0.05) : (double)SavedBytes;
+
+	if (++SavesSinceResizeCheck < JoltSettings->SnapshotHistoryResizeInterval)
+	{
+		return;
+	}
+	SavesSinceResizeCheck = 0;
+
+	if (JoltSettings->bAdaptiveSnapshotHistory)
+	{
+		const int32 NewCapacity = ComputeAdaptiveSnapshotCapacity();
+		if (NewCapacity != SnapshotHistory.Num())
+		{
+			ResizeSnapshotHistory(NewCapacity);
+		}
+	}
+	UpdateSnapshotMemoryStats();
+
+	RollbackDepthLastInterval = RollbackDepthThisInterval;
+	RollbackDepthThisInterval = 0;
+}
+
+FJoltSnapshotMemoryStats UJoltPhysicsWorldSubsystem::GetSnapshotMemoryStats() const
+{
+	FJoltSnapshotMemoryStats Stats;
+	Stats.Capacity = SnapshotHistory.Num();
+	Stats.AllocatedBytes = SnapshotHistory.GetAllocatedSize() + SnapshotBytesAllocated;
+	Stats.AverageSnapshotBytes = (int32)AverageSnapshotBytes;
+	Stats.RequiredRollbackFrames = FMath::Max(RollbackDepthThisInterval, RollbackDepthLastInterval);
+	for (const FJoltPhysicsSnapshotSlot& Slot : SnapshotHistory)
+	{
+		Stats.UsedSlots += Slot.Frame != INDEX_NONE ? 1 : 0;
+	}
+	return Stats;
 }
 
-bool UJoltPhysicsWorldSubsystem::RestoreStateForFrame(const int32 CommandFrame)
+void UJoltPhysicsWorldSubsystem::UpdateSnapshotMemoryStats() const
+{
+	const int64 AllocatedBytes = SnapshotHistory.GetAllocatedSize() + SnapshotBytesAllocated;
+	SET_MEMORY_STAT(STAT_JoltSnapshotHistoryMemory, AllocatedBytes);
+	SET_DWORD_STAT(STAT_JoltSnapshotHistoryCapacity, SnapshotHistory.Num());
+	SET_DWORD_STAT(STAT_JoltSnapshotAverageBytes, (uint32)AverageSnapshotBytes);
+	SET_DWORD_STAT(STAT_JoltSnapshotRequiredRollbackFrames, FMath::Max(RollbackDepthThisInterval, RollbackDepthLastInterval));
+	TRACE_COUNTER_SET(JoltSnapshotHistoryMemory, AllocatedBytes);
+	TRACE_COUNTER_SET(JoltSnapshotHistoryCapacity, SnapshotHistory.Num());
+}
+
+EJoltSnapshotRestoreResult UJoltPhysicsWorldSubsystem::RestoreStateForFrame(const int32 CommandFrame)
 {
 	EnsureSnapshotHistoryReady();
 
 	check(CommandFrame != INDEX_NONE);
 	check(MainPhysicsSystem != nullptr);
 
+	// Counted even when the frame is already gone, so a too small ring grows at the next resize decision
+	if (LatestSavedFrame != INDEX_NONE)
+	{
+		ReportRollbackWindow(LatestSavedFrame - CommandFrame);
+	}
+
 	const int32 SlotIdx = FrameToSlotIndex(CommandFrame);
 	const FJoltPhysicsSnapshotSlot& Slot = SnapshotHistory[SlotIdx];
+	const bool bHasSlot = Slot.Frame == CommandFrame && Slot.Bytes.Num() > 0;
 
 	if (ContactListener)
 	{	
 		ContactListener->ClearContactCache();
 	}
 	
+	if (bHasSlot && !Slot.bPartial)
+	{
+		if (!RestoreSnapshotSlot(Slot))
+		{
+			return EJoltSnapshotRestoreResult::Failed;
+		}
+		
+		// Frames saved before a rebase come back in the coordinates of their own origin
+		if (Slot.Origin != JoltWorldOrigin)
+		{
+			ShiftJoltWorld(JoltWorldOrigin - Slot.Origin);
+		}
+		return EJoltSnapshotRestoreResult::Full;
+	}
+	
+	// No full snapshot for this frame (elided by the server snapshot policy): rebuild it from an earlier one
+	const int32 KeyFrame = FindReplayKeyframe(CommandFrame);
+	if (KeyFrame != INDEX_NONE)
+	{
+		return ReplayStateForFrame(KeyFrame, CommandFrame) ? EJoltSnapshotRestoreResult::Full : EJoltSnapshotRestoreResult::Failed;
+	}
 	
-
-	// Validate that this slot still represents the requested frame
-	if (Slot.Frame != CommandFrame)
+	// Nothing to replay from, the tracked bodies alone are still worth having back
+	if (bHasSlot && Slot.Origin == JoltWorldOrigin)
 	{
-		// Slot was overwritten or never written; history window not large enough or frame mismatch.
-		return false;
+		return RestoreSnapshotSlot(Slot) ? EJoltSnapshotRestoreResult::Partial : EJoltSnapshotRestoreResult::Failed;
 	}
+	
+	// Slot was overwritten or never written; history window not large enough or frame mismatch.
+	return EJoltSnapshotRestoreResult::Failed;
+}
 
-	if (Slot.Bytes.Num() <= 0)
+bool UJoltPhysicsWorldSubsystem::CanRestoreStateForFrame(const int32 CommandFrame) const
+{
+	if (SnapshotHistory.Num() <= 0 || CommandFrame == INDEX_NONE)
 	{
 		return false;
 	}
+	
+	const FJoltPhysicsSnapshotSlot& Slot = SnapshotHistory[FrameToSlotIndex(CommandFrame)];
+	const bool bHasSlot = Slot.Frame == CommandFrame && Slot.Bytes.Num() > 0;
+	return (bHasSlot && !Slot.bPartial) || FindReplayKeyframe(CommandFrame) != INDEX_NONE;
+}
 
+bool UJoltPhysicsWorldSubsystem::RestoreSnapshotSlot(const FJoltPhysicsSnapshotSlot& Slot)
+{
 	JPH::StateRecorderImpl Recorder;
 	Recorder.WriteBytes(Slot.Bytes.GetData(), Slot.Bytes.Num());
 
 	MainPhysicsSystem->RestoreState(Recorder);
+	ActiveBodyTracker->MarkAllMoved();
 	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
 	{
 		C.Value->RestoreState(Recorder);
 	}
 	
+	return !Recorder.IsFailed();
+}
+
+int32 UJoltPhysicsWorldSubsystem::FindReplayKeyframe(const int32 CommandFrame) const
+{
+	const int32 MaxReplayFrames = FMath::Min(JoltSettings->MaxSnapshotReplayFrames, SnapshotHistory.Num() - 1);
+	for (int32 Frame = CommandFrame - 1; Frame >= FMath::Max(CommandFrame - MaxReplayFrames, 0); --Frame)
+	{
+		const FJoltPhysicsSnapshotSlot& Slot = SnapshotHistory[FrameToSlotIndex(Frame)];
+		if (Slot.Frame == Frame && !Slot.bPartial && Slot.Bytes.Num() > 0)
+		{
+			return Frame;
+		}
+	}
+	return INDEX_NONE;
+}
+
+bool UJoltPhysicsWorldSubsystem::ReplayStateForFrame(const int32 KeyFrame, const int32 CommandFrame)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltPhysicsWorldSubsystem::ReplayStateForFrame);
+	
+	const FJoltPhysicsSnapshotSlot& Key = SnapshotHistory[FrameToSlotIndex(KeyFrame)];
+	if (!RestoreSnapshotSlot(Key))
+	{
+		return false;
+	}
+	
+	// Replay in the keyframe's coordinates, partial snapshots saved under another origin cannot be applied on top
+	for (int32 Frame = KeyFrame + 1; Frame <= CommandFrame; ++Frame)
+	{
+		OnSnapshotReplayStep.Broadcast(Frame);
+		StepVirtualCharacters(JoltSettings->FixedDeltaTime);
+		StepJoltWorld();
+		
+		const FJoltPhysicsSnapshotSlot& Partial = SnapshotHistory[FrameToSlotIndex(Frame)];
+		if (Partial.Frame == Frame && Partial.bPartial && Partial.Origin == Key.Origin && Partial.Bytes.Num() > 0)
+		{
+			RestoreSnapshotSlot(Partial);
+		}
+	}
+	
+	// A replay rebuilds a past frame, its contacts were already reported when the frame first ran
+	ClearContactCache();
+	
+	// Components only follow the restored frame, not every replayed step. The next live step writes every body back.
+	ActiveBodyTracker->MarkAllMoved();
+	
+	if (Key.Origin != JoltWorldOrigin)
+	{
+		ShiftJoltWorld(JoltWorldOrigin - Key.Origin);
+	}
 	return true;
 }
 
+UJoltPhysicsWorldSubsystem::EServerSnapshotMode UJoltPhysicsWorldSubsystem::GetServerSnapshotMode(const int32 CommandFrame) const
+{
+	const bool bFull = PendingServerSnapshotFrames > 0
+		|| JoltSettings->ServerSnapshotPolicy == EJoltServerSnapshotPolicy::EveryFrame
+		|| (JoltSettings->ServerSnapshotPolicy == EJoltServerSnapshotPolicy::Interval && CommandFrame % FMath::Max(JoltSettings->ServerSnapshotInterval, 1) == 0);
+	
+	if (bFull)
+	{
+		return EServerSnapshotMode::Full;
+	}
+	return SnapshotTrackedBodies.IsEmpty() ? EServerSnapshotMode::None : EServerSnapshotMode::Partial;
+}
+
+void UJoltPhysicsWorldSubsystem::AddSnapshotTrackedBody(const JPH::BodyID& BodyID)
+{
+	if (!SnapshotTrackedBodies.IsAllowed(BodyID))
+	{
+		SnapshotTrackedBodies.AddToBodyIDAllowList(BodyID);
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::AddSnapshotTrackedBody(const UPrimitiveComponent* Target)
+{
+	const int32 Id = FindShapeId(Target);
+	if (Id != INDEX_NONE)
+	{
+		AddSnapshotTrackedBody(JPH::BodyID(Id));
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::RemoveSnapshotTrackedBody(const JPH::BodyID& BodyID)
+{
+	SnapshotTrackedBodies.RemoveFromBodyIDAllowList(BodyID);
+}
+
+void UJoltPhysicsWorldSubsystem::RemoveSnapshotTrackedBody(const UPrimitiveComponent* Target)
+{
+	const int32 Id = FindShapeId(Target);
+	if (Id != INDEX_NONE)
+	{
+		RemoveSnapshotTrackedBody(JPH::BodyID(Id));
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::ClearSnapshotTrackedBodies()
+{
+	SnapshotTrackedBodies.ClearBodyIDAllowList();
+}
+
+void UJoltPhysicsWorldSubsystem::RequestServerSnapshots(const int32 NumFrames)
+{
+	PendingServerSnapshotFrames = FMath::Max(PendingServerSnapshotFrames, NumFrames);
+}
+
 bool UJoltPhysicsWorldSubsystem::RestoreStateFromBytes(TArrayView<const uint8> SnapshotBytes, const JPH::StateRecorderFilter* RestoreFilter)
 {
 	check(MainPhysicsSystem);
@@ -2348,6 +3850,7 @@ bool UJoltPhysicsWorldSubsystem::RestoreStateFromBytes(TArrayView<const uint8> S
 	
 	// Must match what you saved: Bodies (and any other categories you saved)
 	MainPhysicsSystem->RestoreState(Reader, RestoreFilter);
+	ActiveBodyTracker->MarkAllMoved();
 
 	// Restore your virtual characters too (must match SaveState)
 	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
@@ -2358,6 +3861,75 @@ bool UJoltPhysicsWorldSubsystem::RestoreStateFromBytes(TArrayView<const uint8> S
 	return !Reader.IsFailed();
 }
 
+bool UJoltPhysicsWorldSubsystem::SaveFilteredState(const SaveStateFilter& Filter, TArray<uint8>& OutBytes) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltPhysicsWorldSubsystem::SaveFilteredState);
+	check(MainPhysicsSystem);
+	
+	JPH::StateRecorderImpl Recorder;
+	MainPhysicsSystem->SaveState(Recorder, JPH::EStateRecorderState::All, &Filter);
+	
+	// Same layout as the other snapshots, so RestoreStateFromBytes can read it
+	for (const TTuple<unsigned, JPH::CharacterVirtual*>& C : VirtualCharacterMap)
+	{
+		C.Value->SaveState(Recorder);
+	}
+	
+	const std::string Data = Recorder.GetData();
+	OutBytes.SetNumUninitialized(static_cast<int32>(Data.size()));
+	if (!OutBytes.IsEmpty())
+	{
+		FMemory::Memcpy(OutBytes.GetData(), Data.data(), Data.size());
+	}
+	return !Recorder.IsFailed();
+}
+
+bool UJoltPhysicsWorldSubsystem::RestoreFilteredState(TArrayView<const uint8> SnapshotBytes, const SaveStateFilter& Filter)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(JoltPhysicsWorldSubsystem::RestoreFilteredState);
+	
+	return RestoreStateFromBytes(SnapshotBytes, &Filter);
+}
+
+void UJoltPhysicsWorldSubsystem::GatherPawnBodies(SaveStateFilter& Filter) const
+{
+	// Walk the live pawns rather than the bodies, whose owner pointer is not kept alive
+	for (TActorIterator<APawn> It(GetWorld()); It; ++It)
+	{
+		const FUnrealShapeDescriptor* Descriptor = GlobalShapeDescriptorDataCache.Find(*It);
+		if (!Descriptor) continue;
+		
+		for (const FUnrealShape& Shape : Descriptor->Shapes)
+		{
+			if (Shape.Id != 0 && BodyIDBodyMap.Contains(Shape.Id))
+			{
+				Filter.AddToBodyIDAllowList(JPH::BodyID(Shape.Id));
+			}
+		}
+	}
+}
+
+void UJoltPhysicsWorldSubsystem::GatherBodiesInBox(const FBox& Box, SaveStateFilter& Filter, const bool bMovingOnly) const
+{
+	check(MainPhysicsSystem);
+	
+	// The axes are swizzled on the way to Jolt, so the corners may swap
+	JPH::AABox JoltBox;
+	JoltBox.Encapsulate(JPH::Vec3(JoltHelpers::ToJoltPosition(Box.Min)));
+	JoltBox.Encapsulate(JPH::Vec3(JoltHelpers::ToJoltPosition(Box.Max)));
+	
+	JPH::AllHitCollisionCollector<JPH::CollideShapeBodyCollector> Collector;
+	const JPH::SpecifiedBroadPhaseLayerFilter MovingBroadPhaseFilter(BroadPhaseLayers::MOVING);
+	const JPH::SpecifiedObjectLayerFilter MovingObjectFilter(Layers::MOVING);
+	const JPH::BroadPhaseLayerFilter AnyBroadPhaseFilter;
+	const JPH::ObjectLayerFilter AnyObjectFilter;
+	MainPhysicsSystem->GetBroadPhaseQuery().CollideAABox(JoltBox, Collector,
+		bMovingOnly ? static_cast<const JPH::BroadPhaseLayerFilter&>(MovingBroadPhaseFilter) : AnyBroadPhaseFilter,
+		bMovingOnly ? static_cast<const JPH::ObjectLayerFilter&>(MovingObjectFilter) : AnyObjectFilter);
+	
+	Filter.AddToBodyIDAllowList(TConstArrayView<JPH::BodyID>(Collector.mHits.data(), (int32)Collector.mHits.size()));
+}
+
 bool UJoltPhysicsWorldSubsystem::HasStateForFrame(int32 CommandFrame) const
 {
 	if (SnapshotHistory.Num() <= 0 || CommandFrame == INDEX_NONE)
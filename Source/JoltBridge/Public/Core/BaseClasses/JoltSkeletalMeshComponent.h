@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Core/DataTypes/JoltBridgeTypes.h"
+#include "Core/Interfaces/JoltPrimitiveComponentInterface.h"
+#include "JoltSkeletalMeshComponent.generated.h"
+
+/**
+ * Skeletal mesh whose physics asset bodies are mirrored in the Jolt world as a single kinematic compound body.
+ * Every sphyl, tapered capsule, box, sphere and convex element becomes a sub-shape that follows its bone, the subsystem refreshes
+ * all of them from the animated pose once per physics step.
+ */
+UCLASS(ClassGroup=(Jolt), meta=(BlueprintSpawnableComponent), PrioritizeCategories="Jolt Physics", 
+	HideCategories=(VirtualTexture, Physics))
+class JOLTBRIDGE_API UJoltSkeletalMeshComponent : public USkeletalMeshComponent, public IJoltPrimitiveComponentInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	UJoltSkeletalMeshComponent(const FObjectInitializer& ObjectInitializer);
+	virtual void InitializeComponent() override;
+	virtual void OnUnregister() override;
+	
+	virtual FJoltPhysicsBodySettings& GetJoltPhysicsBodySettings() override {return ShapeOptions;};
+	virtual const FJoltPhysicsBodySettings& GetJoltPhysicsBodySettings() const override { return ShapeOptions; };
+	virtual const FCollisionResponseContainer& GetDefaultResponseContainer() const override { return BodyInstance.GetResponseToChannels();}
+	
+protected:
+	
+	virtual bool UpdateOverlapsImpl(const TOverlapArrayView* PendingOverlaps = nullptr, bool bDoNotifies = true, const TOverlapArrayView* OverlapsAtEndLocation = nullptr) override;
+	
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category="Jolt Physics")
+	FJoltPhysicsBodySettings ShapeOptions;
+};
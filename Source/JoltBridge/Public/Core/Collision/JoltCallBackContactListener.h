@@ -55,6 +55,23 @@ struct FContactRemovedInfo
 	int32 BodyID2;
 };
 
+/**
+ * Per-body contact overrides, stored in jolt units and indexed by body index.
+ * Kept trivially copyable so the narrowphase can read it without locks or allocations.
+ */
+struct FJoltBodyContactOverride
+{
+	JPH::Float3 SurfaceVelocity = JPH::Float3(0.f, 0.f, 0.f);
+	float Friction = 0.f;
+	float Restitution = 0.f;
+	
+	uint8 bOverrideFriction : 1 = 0;
+	uint8 bOverrideRestitution : 1 = 0;
+	uint8 bOverrideSurfaceVelocity : 1 = 0;
+	
+	bool IsActive() const { return bOverrideFriction || bOverrideRestitution || bOverrideSurfaceVelocity; }
+};
+
 /**
  * 
  */
@@ -62,6 +79,8 @@ class JOLTBRIDGE_API FJoltCallBackContactListener : public JPH::ContactListener
 {
 
 public:
+	explicit FJoltCallBackContactListener(const int32 MaxBodies = 0);
+	
 	virtual JPH::ValidateResult OnContactValidate(const JPH::Body& inBody1, const JPH::Body& inBody2, JPH::RVec3Arg inBaseOffset, const JPH::CollideShapeResult& inCollisionResult) override;
 
 	virtual void OnContactAdded(const JPH::Body& inBody1, const JPH::Body& inBody2, const JPH::ContactManifold& inManifold, JPH::ContactSettings& ioSettings) override;
@@ -87,8 +106,28 @@ public:
 	}
 
 	TQueue<FContactAddedInfo, EQueueMode::Mpsc>* GetContactQueue() { return &AddedContactQueue; };
+	
+	/*
+	 * Contact overrides are written from the game thread between physics steps and only read during the step.
+	 * Never call these while the physics system is updating.
+	 */
+	void SetBodyContactOverride(const JPH::BodyID& BodyID, const FJoltBodyContactOverride& Override);
+	void ClearBodyContactOverride(const JPH::BodyID& BodyID);
+	void ClearAllBodyContactOverrides();
+	const FJoltBodyContactOverride* GetBodyContactOverride(const JPH::BodyID& BodyID) const;
 
 private:
+	
+	// Applies any registered per-body overrides to the contact settings. Called from the narrowphase.
+	void ApplyBodyContactOverrides(const JPH::Body& inBody1, const JPH::Body& inBody2, JPH::ContactSettings& ioSettings) const;
+	
+	// Flat table indexed by JPH::BodyID::GetIndex(), sized once to MaxBodies so lookups never allocate.
+	TArray<FJoltBodyContactOverride> BodyContactOverrides;
+	
+	// Number of bodies with an active override. Lets us skip the table entirely when nothing is registered.
+	int32 NumActiveContactOverrides = 0;
+	
+
 	TQueue<FContactAddedInfo, EQueueMode::Mpsc> AddedContactQueue = TQueue<FContactAddedInfo, EQueueMode::Mpsc>();
 	TQueue<FContactRemovedInfo, EQueueMode::Mpsc> RemovedContactQueue = TQueue<FContactRemovedInfo, EQueueMode::Mpsc>();
 };
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Collision responses of every body of a world, reduced to a few shared rows of 32 channel bits.
+ *	-A response profile is one distinct set of block / overlap / combined masks (see JoltHelpers::BuildResponseMasks).
+ *	 Bodies with the same responses share a profile ID, so a pair check only needs each body's channel and profile ID.
+ *	 Bodies using the responses of their channel collapse to at most one profile per channel, the 32x32 channel matrix.
+ *	-Profile 0 responds to every channel. Unknown bodies and profiles past MaxProfiles map to it.
+ *	-Rows are never changed once added and their storage is allocated once, so job threads can read while the game thread
+ *	 adds profiles. Adding and Reset are game thread only.
+ */
+class JOLTBRIDGE_API FJoltCollisionResponseTable
+{
+public:
+	static constexpr int32 MaxProfiles = 4096;
+	
+	FJoltCollisionResponseTable();
+	
+	uint16 FindOrAddProfile(const uint32 BlockMask, const uint32 OverlapMask, const uint32 CombinedMask);
+	
+	// Drops every profile but 0. IDs handed out before are invalid afterwards.
+	void Reset();
+	
+	int32 Num() const { return NumProfiles; }
+	
+	// A responds to B's channel and B responds to A's channel, same as JoltHelpers::IsAnyCollisionAllowed
+	FORCEINLINE bool CanCollide(const uint32 ChannelA, const uint16 ProfileA, const uint32 ChannelB, const uint16 ProfileB) const
+	{
+		return ((CombinedRows[ProfileA] >> (ChannelB & 31u)) & (CombinedRows[ProfileB] >> (ChannelA & 31u)) & 1u) != 0;
+	}
+	
+	FORCEINLINE bool IsBlocking(const uint32 ChannelA, const uint16 ProfileA, const uint32 ChannelB, const uint16 ProfileB) const
+	{
+		return ((BlockRows[ProfileA] >> (ChannelB & 31u)) & (BlockRows[ProfileB] >> (ChannelA & 31u)) & 1u) != 0;
+	}
+	
+	// Either side overlapping the other is enough, same as JoltHelpers::IsOverlappingCollisionAllowed
+	FORCEINLINE bool IsOverlapping(const uint32 ChannelA, const uint16 ProfileA, const uint32 ChannelB, const uint16 ProfileB) const
+	{
+		return (((OverlapRows[ProfileA] >> (ChannelB & 31u)) | (OverlapRows[ProfileB] >> (ChannelA & 31u))) & 1u) != 0;
+	}
+	
+private:
+	TUniquePtr<uint32[]> CombinedRows;
+	TUniquePtr<uint32[]> BlockRows;
+	TUniquePtr<uint32[]> OverlapRows;
+	TMap<TTuple<uint32, uint32, uint32>, uint16> ProfileIDs;
+	int32 NumProfiles = 0;
+	bool bWarnedFull = false;
+};
@@ -118,26 +118,99 @@ public:
 	}
 };
 
+// Body allow list for partial snapshots, keyed by body index.
+//	-Membership, adding and removing are O(1): a table indexed by BodyID::GetIndex() holds each body's position in a dense
+//	 list. A body removed from the world leaves a stale entry that a new body reusing its index replaces.
+//	-ClearBodyIDAllowList keeps all memory and only visits the allowed bodies, so a filter can be rebuilt every frame.
 class SaveStateFilter final : public JPH::StateRecorderFilter
 {
 public:
 	virtual bool ShouldSaveBody(const JPH::Body& inBody) const override
 	{
-		for (int i = 0; i < AllowedBodiesList.size(); i++)
+		return IsAllowed(inBody.GetID());
+	}
+
+	void AddToBodyIDAllowList(const JPH::BodyID& bodyID)
+	{
+		if (bodyID.IsInvalid()) return;
+		
+		const int32 Index = (int32)bodyID.GetIndex();
+		if (Index >= ListIndexByBody.Num())
 		{
-			if (AllowedBodiesList[i] == inBody.GetID())
+			const int32 OldNum = ListIndexByBody.Num();
+			ListIndexByBody.SetNum(FMath::RoundUpToPowerOfTwo(Index + 1), EAllowShrinking::No);
+			for (int32 i = OldNum; i < ListIndexByBody.Num(); ++i)
 			{
-				return true;
+				ListIndexByBody[i] = INDEX_NONE;
 			}
 		}
-		return false;
+		
+		int32& ListIndex = ListIndexByBody[Index];
+		if (ListIndex == INDEX_NONE)
+		{
+			ListIndex = AllowedBodiesList.Add(bodyID);
+		}
+		else
+		{
+			AllowedBodiesList[ListIndex] = bodyID;
+		}
+	}
+	
+	void AddToBodyIDAllowList(TConstArrayView<JPH::BodyID> bodyIDs)
+	{
+		AllowedBodiesList.Reserve(AllowedBodiesList.Num() + bodyIDs.Num());
+		for (const JPH::BodyID& BodyID : bodyIDs)
+		{
+			AddToBodyIDAllowList(BodyID);
+		}
 	}
 
-	void AddToBodyIDAllowList(const JPH::BodyID& bodyID)
+	void RemoveFromBodyIDAllowList(const JPH::BodyID& bodyID)
 	{
-		AllowedBodiesList.insert(AllowedBodiesList.begin(), bodyID);
+		if (!IsAllowed(bodyID)) return;
+		
+		const int32 ListIndex = ListIndexByBody[bodyID.GetIndex()];
+		ListIndexByBody[bodyID.GetIndex()] = INDEX_NONE;
+		AllowedBodiesList.RemoveAtSwap(ListIndex, 1, EAllowShrinking::No);
+		if (ListIndex < AllowedBodiesList.Num())
+		{
+			ListIndexByBody[AllowedBodiesList[ListIndex].GetIndex()] = ListIndex;
+		}
+	}
+	
+	void RemoveFromBodyIDAllowList(TConstArrayView<JPH::BodyID> bodyIDs)
+	{
+		for (const JPH::BodyID& BodyID : bodyIDs)
+		{
+			RemoveFromBodyIDAllowList(BodyID);
+		}
+	}
+
+	bool IsAllowed(const JPH::BodyID& bodyID) const
+	{
+		const uint32 Index = bodyID.GetIndex();
+		if (bodyID.IsInvalid() || Index >= (uint32)ListIndexByBody.Num()) return false;
+		
+		const int32 ListIndex = ListIndexByBody[Index];
+		return AllowedBodiesList.IsValidIndex(ListIndex) && AllowedBodiesList[ListIndex] == bodyID;
+	}
+
+	bool IsEmpty() const { return AllowedBodiesList.IsEmpty(); }
+	int32 Num() const { return AllowedBodiesList.Num(); }
+	TConstArrayView<JPH::BodyID> GetAllowedBodies() const { return AllowedBodiesList; }
+
+	void ClearBodyIDAllowList()
+	{
+		for (const JPH::BodyID& BodyID : AllowedBodiesList)
+		{
+			ListIndexByBody[BodyID.GetIndex()] = INDEX_NONE;
+		}
+		AllowedBodiesList.Reset();
 	}
 
 private:
-	JPH::Array<JPH::BodyID> AllowedBodiesList;
+	TArray<JPH::BodyID> AllowedBodiesList;
+	
+	// Position in AllowedBodiesList by BodyID::GetIndex(), INDEX_NONE when not allowed
+	TArray<int32> ListIndexByBody;
 };
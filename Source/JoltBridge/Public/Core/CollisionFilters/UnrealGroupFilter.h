@@ -4,27 +4,23 @@
 
 #include "CoreMinimal.h"
 #include "JoltBridgeMain.h"
+#include "Core/DataTypes/JoltUserDataArena.h"
 
 /**
- * 
+ * Group IDs are FJoltUserDataArena handles. The check reads the two bodies' dense hot entries and one bit of each of their
+ * response profile rows, no user data and no profiler scope.
  */
 class JOLTBRIDGE_API FUnrealGroupFilter final : public JPH::GroupFilter
 {
 public:
-	
+	explicit FUnrealGroupFilter(const FJoltUserDataArena* InUserDataArena) : UserDataArena(InUserDataArena) {}
 
 	bool CanCollide(const JPH::CollisionGroup& A, const JPH::CollisionGroup& B) const override
 	{
-		const FJoltUserData* UA = JoltHelpers::UnpackDataFromGroupIDs<FJoltUserData>(A.GetGroupID(), A.GetSubGroupID());
-		const FJoltUserData* UB = JoltHelpers::UnpackDataFromGroupIDs<FJoltUserData>(B.GetGroupID(), B.GetSubGroupID());
-
-		if (!UA || UA->Magic != FJoltUserData::MagicValue) return true;  // or false depending on your policy
-		if (!UB || UB->Magic != FJoltUserData::MagicValue) return true;
-		
-		
 		// Allow both Block and Overlap through to narrowphase.
-		return JoltHelpers::IsAnyCollisionAllowed(UA, UB);
+		return UserDataArena->CanCollide(A.GetGroupID(), B.GetGroupID());
 	}
 
-
+private:
+	const FJoltUserDataArena* UserDataArena = nullptr;
 };
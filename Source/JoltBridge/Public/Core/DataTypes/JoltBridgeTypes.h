@@ -267,12 +267,47 @@ struct FJoltPhysicsBodySettings
 	
 };
 
+/* Per body overrides applied to every contact the body takes part in, evaluated inside the Jolt contact listener.*/
+USTRUCT(BlueprintType)
+struct FJoltContactModifierSettings
+{
+	GENERATED_BODY()
+	
+	UPROPERTY(BlueprintReadWrite, EditAnywhere)
+	bool bOverrideFriction = false;
+	
+	UPROPERTY(BlueprintReadWrite, EditAnywhere)
+	bool bOverrideRestitution = false;
+	
+	UPROPERTY(BlueprintReadWrite, EditAnywhere)
+	bool bOverrideSurfaceVelocity = false;
+	
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta=(EditCondition="bOverrideFriction", EditConditionHides))
+	float Friction = 0.f;
+	
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta=(EditCondition="bOverrideRestitution", EditConditionHides))
+	float Restitution = 0.f;
+	
+	/* World space velocity (cm/s) of the body's surface, the other body is dragged along as if standing on a conveyor belt.*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta=(EditCondition="bOverrideSurfaceVelocity", EditConditionHides))
+	FVector SurfaceVelocity = FVector::ZeroVector;
+	
+	bool IsActive() const
+	{
+		return bOverrideFriction || bOverrideRestitution || bOverrideSurfaceVelocity;
+	}
+};
+
 
 struct FJoltUserData
 {
 	static constexpr uint32 MagicValue = 0xB011E7DA; // any constant you like
+	static constexpr uint32 InvalidHandle = ~0u;
 
 	uint32 Magic = MagicValue;
+	
+	// Slot in the FJoltUserDataArena this was allocated from, packed into the body's collision group
+	uint32 Handle = InvalidHandle;
 
 	// For hit construction/gameplay (not used by collision filtering)
 	USceneComponent* Component = nullptr;
@@ -300,3 +335,20 @@ struct FJoltUserData
 	uint32 OverlapMask = 0;      // bits for channels this overlaps (optional)c.)
 	uint32 CombinedMask = 0;      // bits for channels this overlaps (optional)c.)
 };
+
+// Collision policy of an FJoltUserData, kept densely by FJoltUserDataArena so the group filter reads 8 bytes per body
+// instead of chasing the full user data. The masks live in the FJoltCollisionResponseTable row ResponseProfile points at.
+struct FJoltUserDataHot
+{
+	uint16 ResponseProfile = 0;
+	uint8  ObjectChannel = 0;
+	uint8  bQueryEnabled : 1 = 0;
+	uint8  bPhysicsEnabled : 1 = 0;
+	uint8  bGenerateOverlapEvents : 1 = 0;
+	uint8  bGenerateHitEvents : 1 = 0;
+	
+	// Bumped every time the slot is freed, stale handles no longer match it
+	uint8  Generation = 0;
+	uint8  Pad[3] = {};
+};
+static_assert(sizeof(FJoltUserDataHot) == 8, "FJoltUserDataHot should stay 8 bytes, eight to a cache line");
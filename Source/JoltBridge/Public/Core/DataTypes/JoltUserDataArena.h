@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/DataTypes/JoltBridgeTypes.h"
+#include "Core/CollisionFilters/JoltCollisionResponseTable.h"
+
+/**
+ * Owns the FJoltUserData of every body of a world.
+ *	-User data lives in fixed size chunks, so pointers handed to bodies (Body::GetUserData) never move. Freed slots are reused.
+ *	-A handle is the slot index plus the generation of the slot in the top 8 bits. It is what goes in the body's
+ *	 collision group, the group filter resolves it with FindHot.
+ *	-The collision policy fields are mirrored in a dense hot array indexed by slot, the masks as a response profile of
+ *	 the arena's FJoltCollisionResponseTable. SyncHot copies them over and must be called once the user data is filled in,
+ *	 before the body that uses it is created.
+ * Alloc, Free and SyncHot are game thread only. The hot array is reserved up front so FindHot stays safe from Jolt's job
+ * threads; going past the reservation reallocates it and is only safe between steps.
+ */
+class JOLTBRIDGE_API FJoltUserDataArena
+{
+public:
+	static constexpr int32 ChunkSize = 256;
+	static constexpr uint32 GenerationShift = 24;
+	static constexpr uint32 IndexMask = (1u << GenerationShift) - 1;
+	
+	// Reserves the hot array for NumEntries slots, usually the max body count
+	void Reserve(const int32 NumEntries);
+	
+	FJoltUserData* Alloc();
+	void Free(const FJoltUserData* UserData);
+	
+	// Frees everything. Pointers handed out before become dangling, only call once the bodies using them are gone.
+	void Reset();
+	
+	void SyncHot(const FJoltUserData& UserData);
+	
+	FJoltUserData* Get(const uint32 Handle) const;
+	
+	FORCEINLINE const FJoltUserDataHot* FindHot(const uint32 Handle) const
+	{
+		const uint32 Index = Handle & IndexMask;
+		if (Index >= (uint32)Hot.Num()) return nullptr;
+		
+		const FJoltUserDataHot* Entry = Hot.GetData() + Index;
+		return Entry->Generation == (uint8)(Handle >> GenerationShift) ? Entry : nullptr;
+	}
+	
+	// Group filter check. Bodies the arena does not know collide with everything.
+	FORCEINLINE bool CanCollide(const uint32 HandleA, const uint32 HandleB) const
+	{
+		const FJoltUserDataHot* A = FindHot(HandleA);
+		const FJoltUserDataHot* B = FindHot(HandleB);
+		if (!A || !B) return true;
+		
+		return ResponseTable.CanCollide(A->ObjectChannel, A->ResponseProfile, B->ObjectChannel, B->ResponseProfile);
+	}
+	
+	const FJoltCollisionResponseTable& GetResponseTable() const { return ResponseTable; }
+	
+	int32 Num() const { return NumSlots - FreeSlots.Num(); }
+	
+private:
+	FJoltUserData& GetSlot(const uint32 Index) const { return Chunks[Index / ChunkSize][Index % ChunkSize]; }
+	
+	TArray<TUniquePtr<FJoltUserData[]>> Chunks;
+	TArray<FJoltUserDataHot> Hot;
+	FJoltCollisionResponseTable ResponseTable;
+	TArray<uint32> FreeSlots;
+	int32 NumSlots = 0;
+};
@@ -17,6 +17,47 @@
 #define JOLT_TO_WORLD_SCALE 100.f
 #define WORLD_TO_JOLT_SCALE 0.01f
 
+// Scale for JPH::Real positions. Large world builds (JPH_DOUBLE_PRECISION) keep positions in double all the way through,
+// single precision builds use the float scale so results stay bitwise identical to WORLD_TO_JOLT_SCALE.
+#ifdef JPH_DOUBLE_PRECISION
+#define WORLD_TO_JOLT_POSITION_SCALE 0.01
+#else
+#define WORLD_TO_JOLT_POSITION_SCALE WORLD_TO_JOLT_SCALE
+#endif
+
+// Profiler scopes of helpers called per body pair or per contact from Jolt's job threads, where the scope costs more than
+// the helper. Compiled out unless the module defines JOLT_TRACE_HOT_PATHS=1.
+#ifndef JOLT_TRACE_HOT_PATHS
+#define JOLT_TRACE_HOT_PATHS 0
+#endif
+
+#if JOLT_TRACE_HOT_PATHS
+#define JOLT_HOT_PATH_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(Name)
+#else
+#define JOLT_HOT_PATH_SCOPE(Name)
+#endif
+
+// Jolt space position and rotation packed as aligned 4-wide lanes, so bulk transfers between UE and Jolt load and
+// store whole SIMD registers. Filled and read by JoltHelpers::ToJoltTransforms / ToUnrealTransforms.
+// Position is a JPH::Real, so it widens to double in large world builds.
+struct alignas(16) FJoltPackedTransform
+{
+	JPH::Real Position[4] = { 0, 0, 0, 0 };			// Metres, W unused
+	float Rotation[4] = { 0.f, 0.f, 0.f, 1.f };	// Quaternion XYZW
+
+	JPH::RVec3 GetPosition() const { return JPH::RVec3(Position[0], Position[1], Position[2]); }
+	JPH::Quat GetRotation() const { return JPH::Quat(Rotation[0], Rotation[1], Rotation[2], Rotation[3]); }
+	
+	void Set(JPH::RVec3Arg InPosition, JPH::QuatArg InRotation)
+	{
+		Position[0] = InPosition.GetX();
+		Position[1] = InPosition.GetY();
+		Position[2] = InPosition.GetZ();
+		Position[3] = 0;
+		InRotation.GetXYZW().StoreFloat4(reinterpret_cast<JPH::Float4*>(Rotation));
+	}
+};
+
 class JoltHelpers
 {
 public:
@@ -81,7 +122,7 @@ public:
 
 	FORCEINLINE static JPH::RVec3 ToJoltPosition(const FVector& V, const FVector& WorldOrigin = FVector(0))
 	{
-		return JPH::RVec3(V.X - WorldOrigin.X, V.Z - WorldOrigin.Z, V.Y - WorldOrigin.Y) * WORLD_TO_JOLT_SCALE;
+		return JPH::RVec3(V.X - WorldOrigin.X, V.Z - WorldOrigin.Z, V.Y - WorldOrigin.Y) * WORLD_TO_JOLT_POSITION_SCALE;
 	}
 
 	FORCEINLINE static FQuat ToUnrealRotation(const JPH::Quat& Q)
@@ -140,10 +181,20 @@ public:
 		return RadPerSec * (180.f / PI);
 	}
 	
-	FORCEINLINE static FVector RadiansPerSecToDegreesPerSec(const JPH::RVec3& RadPerSec)
+	FORCEINLINE static FVector RadiansPerSecToDegreesPerSec(const JPH::Vec3& RadPerSec)
 	{
 		return ToUnrealVector3(RadPerSec * (180.f / PI));
 	}
+	
+	// Batch versions of the conversions above, In and Out must have the same length. Elements come out bitwise identical to
+	// ToJoltPosition + ToJoltRotation, ToJoltVector3 and ToUnrealVector3, and to ToUnrealPosition + ToUnrealRotation of the
+	// packed position and rotation. Against ToUnrealTransform only the translation matches bit for bit, its rotation is
+	// re-derived from a matrix. Only IEEE adds, multiplies, sign flips and float/double conversions are used, never fused
+	// multiply-adds or estimates, matching the JPH_CROSS_PLATFORM_DETERMINISTIC Jolt build. j.debug.BenchmarkConversions checks this.
+	JOLTBRIDGE_API static void ToJoltTransforms(TConstArrayView<FTransform> In, TArrayView<FJoltPackedTransform> Out, const FVector& WorldOrigin = FVector(0));
+	JOLTBRIDGE_API static void ToUnrealTransforms(TConstArrayView<FJoltPackedTransform> In, TArrayView<FTransform> Out, const FVector& WorldOrigin = FVector(0));
+	JOLTBRIDGE_API static void ToJoltVectors(TConstArrayView<FVector> In, TArrayView<JPH::Float3> Out);
+	JOLTBRIDGE_API static void ToUnrealVectors(TConstArrayView<JPH::Float3> In, TArrayView<FVector> Out);
 
 	FORCEINLINE static bool UEAssertFailed(const char* inExpression, const char* inMessage, const char* inFile, uint inLine)
 	{
@@ -234,7 +285,7 @@ public:
 	
 	static bool IsAnyCollisionAllowed(const FJoltUserData* A, const FJoltUserData* B)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::IsAnyCollisionAllowed);
+		JOLT_HOT_PATH_SCOPE(JoltHelpers::IsAnyCollisionAllowed);
 		
 		if (!A || !B) return false;
 		
@@ -255,7 +306,7 @@ public:
 	
 	static bool IsBlockingCollisionAllowed(const FJoltUserData* A, const FJoltUserData* B)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::IsBlockingCollisionAllowed);
+		JOLT_HOT_PATH_SCOPE(JoltHelpers::IsBlockingCollisionAllowed);
 		
 		if (!A || !B) return false;
 
@@ -276,7 +327,7 @@ public:
 	
 	static bool IsOverlappingCollisionAllowed(const JPH::Body* A, const JPH::Body* B)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::IsOverlappingCollisionAllowed);
+		JOLT_HOT_PATH_SCOPE(JoltHelpers::IsOverlappingCollisionAllowed);
 		
 		if (!A || !B) return false;
 		
@@ -288,7 +339,7 @@ public:
 	
 	static bool IsOverlappingCollisionAllowed(const FJoltUserData* A, const FJoltUserData* B)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::IsOverlappingCollisionAllowed);
+		JOLT_HOT_PATH_SCOPE(JoltHelpers::IsOverlappingCollisionAllowed);
 		
 		if (!A || !B) return false;
 		
@@ -346,7 +397,7 @@ public:
 	// Helper: safely get FJoltUserData from a Jolt object
 	static FORCEINLINE const FJoltUserData* GetUserData(const JPH::Body* Obj)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(JoltHelpers::GetUserData);
+		JOLT_HOT_PATH_SCOPE(JoltHelpers::GetUserData);
 		if (!Obj) return nullptr;
 		uint64 P = Obj->GetUserData();
 
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "JoltBridgeMain.h"
+
+/**
+ * Records which bodies a physics step touched, so post step work only visits those instead of every body in the world.
+ * After EndStep:
+ *	-Moved: bodies active at the end of the step, bodies that fell asleep during it (their last step moved them) and bodies
+ *	 reported through MarkMoved since the previous step.
+ *	-Woken / Slept: activation changes since the previous step, as seen by the BodyActivationListener.
+ * Each body appears at most once per list. After MarkAllMoved, AreAllMoved is set for one step and the moved list should not
+ * be relied on.
+ */
+class JOLTBRIDGE_API FJoltActiveBodyTracker final : public JPH::BodyActivationListener
+{
+public:
+	explicit FJoltActiveBodyTracker(const int32 MaxBodies = 0);
+	
+	// Called by Jolt from its job threads during a step, and from the game thread when bodies are (de)activated between steps
+	virtual void OnBodyActivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData) override;
+	virtual void OnBodyDeactivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData) override;
+	
+	// A body was moved or otherwise changed between steps without being activated, e.g. teleported while asleep
+	void MarkMoved(const JPH::BodyID& BodyID);
+	
+	// Any body may have changed: state restored, world shifted, bodies removed
+	void MarkAllMoved();
+	
+	// Builds the lists of the step that just ran. Game thread, after PhysicsSystem::Update.
+	void EndStep(const JPH::PhysicsSystem& System);
+	
+	TConstArrayView<JPH::BodyID> GetMovedBodies() const { return MovedBodies; }
+	TConstArrayView<JPH::BodyID> GetWokenBodies() const { return WokenBodies; }
+	TConstArrayView<JPH::BodyID> GetSleptBodies() const { return SleptBodies; }
+	
+	bool AreAllMoved() const { return bAllMoved; }
+	bool HasMoved(const JPH::BodyID& BodyID) const
+	{
+		return bAllMoved || (MovedBits.IsValidIndex(BodyID.GetIndex()) && MovedBits[BodyID.GetIndex()]);
+	}
+	
+	// Nothing moved, woke up or fell asleep during the last step, and nothing was marked since
+	bool IsQuiet() const { return !bAllMoved && MovedBodies.IsEmpty() && WokenBodies.IsEmpty() && SleptBodies.IsEmpty() && !HasPendingChanges(); }
+	bool HasPendingChanges() const { return bAllMovedPending || !PendingWoken.IsEmpty() || !PendingSlept.IsEmpty() || !PendingMoved.IsEmpty(); }
+	
+	// Steps seen so far, lets consumers tell whether a step ran since they last looked
+	uint32 GetStepCount() const { return StepCount; }
+	
+	void Reset();
+	
+private:
+	// Adds the body to List unless Bits already has it
+	static void AddUnique(TArray<JPH::BodyID>& List, TBitArray<>& Bits, const JPH::BodyID& BodyID);
+	
+	TQueue<JPH::BodyID, EQueueMode::Mpsc> PendingWoken;
+	TQueue<JPH::BodyID, EQueueMode::Mpsc> PendingSlept;
+	TQueue<JPH::BodyID, EQueueMode::Mpsc> PendingMoved;
+	bool bAllMovedPending = false;
+	
+	TArray<JPH::BodyID> MovedBodies;
+	TArray<JPH::BodyID> WokenBodies;
+	TArray<JPH::BodyID> SleptBodies;
+	bool bAllMoved = false;
+	
+	// Indexed by JPH::BodyID::GetIndex(), set for the bodies of the matching list. Cleared through the lists, never swept.
+	TBitArray<> MovedBits;
+	TBitArray<> WokenBits;
+	TBitArray<> SleptBits;
+	
+	uint32 StepCount = 0;
+};
@@ -10,7 +10,9 @@
 #include <functional>
 #include "Core/CollisionFilters/JoltFilters.h"
 #include "Core/DataTypes/JoltBridgeTypes.h"
+#include "Core/DataTypes/JoltUserDataArena.h"
 #include "GameFramework/Actor.h"
+#include "Tasks/Task.h"
 #include "JoltPhysicsWorldSubsystem.generated.h"
 
 class FUnrealGroupFilter;
@@ -38,16 +40,57 @@ struct FJoltPhysicsSnapshotSlot
 	// Raw snapshot bytes for Jolt::SaveState.
 	UPROPERTY()
 	TArray<uint8> Bytes;
+	
+	// Bytes only hold the bodies that passed a save filter. Cannot be replayed from, restoring it leaves every other body as is.
+	UPROPERTY()
+	bool bPartial = false;
+
+	// UE world origin the Jolt positions in Bytes are relative to. Restoring under another origin shifts them onto it.
+	UPROPERTY()
+	FIntVector Origin = FIntVector::ZeroValue;
 
 	void Reset()
 	{
 		Frame = INDEX_NONE;
+		Origin = FIntVector::ZeroValue;
 		Bytes.Reset();
+		bPartial = false;
 		SnapshotDataAsString = "";
 		
 	}
 };
 
+// Snapshot ring usage, see UJoltPhysicsWorldSubsystem::GetSnapshotMemoryStats. Also published under "stat JoltSnapshots".
+struct FJoltSnapshotMemoryStats
+{
+	int32 Capacity = 0;
+
+	// Slots holding a frame
+	int32 UsedSlots = 0;
+
+	// Bytes allocated by the slots and their snapshot data
+	int64 AllocatedBytes = 0;
+
+	// Running average size of one saved snapshot
+	int32 AverageSnapshotBytes = 0;
+
+	// Deepest rollback over the current and previous resize interval, in frames
+	int32 RequiredRollbackFrames = 0;
+};
+
+// What UJoltPhysicsWorldSubsystem::RestoreStateForFrame brought back
+enum class EJoltSnapshotRestoreResult : uint8
+{
+	// Nothing, the frame is out of the history
+	Failed,
+	
+	// Only the bodies tracked by the server snapshot policy, every other body is still on the current frame
+	Partial,
+	
+	// The whole world, from the frame's own snapshot or replayed from an earlier one
+	Full,
+};
+
 class FJoltDebugRenderer;
 class FRaycastCollector_AllHits;
 class FSweepCastCollector_AllHits;
@@ -57,10 +100,13 @@ class UJoltSettings;
 struct FJoltWorkerOptions;
 class FJoltWorker;
 class FJoltCallBackContactListener;
+class FJoltActiveBodyTracker;
 class UShapeComponent;
+class ULandscapeHeightfieldCollisionComponent;
 class FUnrealCollisionDispatcher;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPhysicsStep, const float&, DeltaTime);
 DECLARE_MULTICAST_DELEGATE(FOnModifyContacts);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSnapshotReplayStep, int32 /*CommandFrame*/);
 
 /**
  * 
@@ -114,6 +160,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Registration", DisplayName="Register Dynamic Rigid Body")
 	void RegisterJoltRigidBody(AActor* Target);
 	
+	/**
+	 * Removes and destroys every body registered for Target. Called automatically when a registered actor is destroyed.
+	 * @param Target	The actor previously passed to RegisterJoltRigidBody
+	 */
+	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Registration", DisplayName="Unregister Rigid Body")
+	void UnregisterJoltRigidBody(AActor* Target);
+	
+	// Removes and destroys the bodies of a single registered component, e.g. a skeletal mesh unregistered while its actor lives on
+	void UnregisterJoltComponent(const UPrimitiveComponent* Target);
+	
 	
 	
 	
@@ -165,6 +221,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "JoltBridge Physics|Objects")
 	float GetGravity(const UPrimitiveComponent* Target) const;
 	
+	/**
+	 * Overrides friction, restitution and/or surface velocity for every contact the body takes part in. Stays active until cleared.
+	 * Should be called between physics steps, OnModifyContacts is broadcast right before each step for exactly that purpose.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Objects")
+	void SetBodyContactModifier(const UPrimitiveComponent* Target, const FJoltContactModifierSettings& Settings);
+	
+	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Objects")
+	void ClearBodyContactModifier(const UPrimitiveComponent* Target);
+	
 
 	
 
@@ -207,6 +273,9 @@ public:
 	TArray<int32> SweepTraceMulti(const FCollisionShape& Shape, const FVector& Start, const FVector& End, const FQuat& Rotation, const TEnumAsByte<ECollisionChannel>& Channel, const TArray<AActor*>& ActorsToIgnore, TArray<FHitResult>& OutHits);
 	FVector GetVelocity(const JPH::BodyID& ID) const;
 	JPH::PhysicsSystem* GetPhysicsSystem() const {return MainPhysicsSystem;}
+	
+	// Bodies moved, woken and slept by the last StepPhysics
+	const FJoltActiveBodyTracker* GetActiveBodyTracker() const { return ActiveBodyTracker; }
 	void ClearContactCache() const;
 	void InvalidateContactCache() const;
 
@@ -231,6 +300,8 @@ private:
 	FJoltWorker* JoltWorker = nullptr;
 
 	FJoltCallBackContactListener* ContactListener = nullptr;
+	
+	FJoltActiveBodyTracker* ActiveBodyTracker = nullptr;
 
 	JPH::PhysicsSystem* MainPhysicsSystem = nullptr;
 
@@ -256,14 +327,45 @@ private:
 
 	TArray<const JPH::CapsuleShape*> CapsuleShapes;
 
-	TArray<const JPH::HeightFieldShapeSettings*> HeightFieldShapes;
+	// Built landscape heightfields by cache key. Kept until the world is torn down so a component streaming back in reuses its shape.
+	TMap<FString, JPH::ShapeRefC> HeightFieldShapes;
 
 	TArray<JPH::Body*> SavedBodies;
 
 	TMap<uint32, JPH::Body*> BodyIDBodyMap;
 	TMap<uint32, JPH::CharacterVirtual*> VirtualCharacterMap;
 
-	// JPH::Array<const JPH::Body*> HeightMapArray;
+	// Static heightfield body mirroring one landscape collision component
+	struct FJoltLandscapeBody
+	{
+		TWeakObjectPtr<ULandscapeHeightfieldCollisionComponent> Component;
+		TWeakObjectPtr<AActor> Proxy;
+		const ULevel* Level = nullptr;
+		JPH::BodyID BodyID;
+		FJoltUserData* UserData = nullptr;
+	};
+
+	TArray<FJoltLandscapeBody> LandscapeBodies;
+
+	// Bodies registered together for one level. They are created right away but only enter the broadphase once the batch has been
+	// prepared on a background task, see FinalizeLevelBodySets.
+	struct FJoltLevelBodySet
+	{
+		TArray<JPH::BodyID> BodyIDs;
+		TArray<JPH::BodyID> BodiesToActivate;
+		JPH::BodyInterface::AddState AddState = nullptr;
+		UE::Tasks::FTask PrepareTask;
+		bool bInBroadPhase = false;
+	};
+
+	TMap<const ULevel*, TUniquePtr<FJoltLevelBodySet>> LevelBodySets;
+
+	// While set, AddBodyToSimulation leaves new bodies out of the broadphase and records them here instead
+	FJoltLevelBodySet* PendingLevelBodySet = nullptr;
+
+	FDelegateHandle LevelAddedToWorldHandle;
+	FDelegateHandle LevelRemovedFromWorldHandle;
+	FDelegateHandle ActorDestroyedHandle;
 
 	// JPH::Array<const JPH::Body*> LandscapeSplines;
 
@@ -271,7 +373,23 @@ private:
 
 	TMap<EPhysicalSurface, TWeakObjectPtr<const UPhysicalMaterial>> SurfaceUEMaterialMap;
 
-	TMap<const JPH::BodyID*, FTransform> SkeletalMeshBodyIDLocalTransformMap;
+	// Kinematic compound body mirroring a skeletal mesh's physics asset, one sub-shape per primitive element
+	struct FJoltSkeletalBody
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Component;
+		JPH::BodyID BodyID;
+		JPH::Ref<JPH::MutableCompoundShape> Shape;
+		FVector Scale = FVector::OneVector;
+		TArray<int32> SubShapeBoneIndices;			// Bone driving each sub-shape
+		TArray<FName> SubShapeBoneNames;			// Reported as FHitResult::BoneName
+		TArray<FTransform> SubShapeLocalTransforms;	// Element transform relative to its bone
+		// Scratch handed to MutableCompoundShape::ModifyShapes, sized once when the compound is built
+		JPH::Array<JPH::Vec3> Positions;
+		JPH::Array<JPH::Quat> Rotations;
+	};
+
+	TArray<FJoltSkeletalBody> SkeletalBodies;
+	TMap<uint32, int32> SkeletalBodyIndexByBodyID;
 
 	struct ConvexHullShapeHolder
 	{
@@ -283,6 +401,17 @@ private:
 
 	TArray<ConvexHullShapeHolder> ConvexShapes;
 
+	struct TaperedCapsuleShapeHolder
+	{
+		float						TopRadius;
+		float						BottomRadius;
+		float						HalfHeight;
+		const JoltPhysicsMaterial*	Material;
+		JPH::ShapeRefC				Shape;
+	};
+
+	TArray<TaperedCapsuleShapeHolder> TaperedCapsuleShapes;
+
 #ifdef JPH_DEBUG_RENDERER
 	FJoltDebugRenderer* JoltDebugRendererImpl = nullptr;
 
@@ -302,6 +431,9 @@ public:
 	const JPH::SphereShape* GetSphereCollisionShape(float Radius, const JoltPhysicsMaterial* material = nullptr);
 
 	const JPH::CapsuleShape* GetCapsuleCollisionShape(float Radius, float Height, const JoltPhysicsMaterial* material = nullptr);
+	
+	// TopRadius sits at the +Z end like FKTaperedCapsuleElem::Radius0. Falls back to a capsule of the larger radius when Jolt rejects the proportions.
+	const JPH::Shape* GetTaperedCapsuleCollisionShape(float TopRadius, float BottomRadius, float Height, const JoltPhysicsMaterial* material = nullptr);
 
 	const JPH::ConvexHullShape* GetConvexHullCollisionShape(UBodySetup* BodySetup, int ConvexIndex, const FVector& Scale, const JoltPhysicsMaterial* material = nullptr);
 
@@ -322,7 +454,22 @@ private:
 	 * "jolt-static" tag should be added for static objects (from UE editor)
 	 * "jolt-dynamic" tag should be added for dynamic objects (from UE editor)
 	 */
-	void AddAllJoltActors(const UWorld* World);
+	void AddAllJoltActors(const UWorld* World, const ULevel* Level = nullptr);
+	
+	// Registers every Jolt actor and landscape of a streamed in level as one body set, prepared for the broadphase off the game thread
+	void AddLevelBodies(const UWorld* World, const ULevel* Level);
+	
+	// Removes and destroys every body owned by Level in one batch, including bodies of a set that never reached the broadphase
+	void RemoveLevelBodies(const ULevel* Level);
+	
+	// Removes, destroys and forgets the given bodies, and pulls them out of any body set still waiting for the broadphase
+	void DestroyJoltBodies(const TSet<uint32>& BodyIDs);
+	
+	// Adds every body set whose preparation finished to the broadphase. Called at the start of each step, never waits.
+	void FinalizeLevelBodySets();
+	
+	// Waits for a pending set's preparation and hands its bodies back to Jolt without adding them
+	void AbortLevelBodySet(FJoltLevelBodySet& Set) const;
 
 	void ExtractPhysicsGeometry(const AActor* Actor, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor);
 	
@@ -332,6 +479,36 @@ private:
 
 	void ExtractPhysicsGeometry(UShapeComponent* Sc, const FTransform& InvActorXform, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor);
 
+	void ExtractPhysicsGeometry(USkeletalMeshComponent* Skel, const FTransform& InvActorXform, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor);
+	
+	// Pushes the animated pose of every registered physics asset compound into Jolt, called right before each step
+	void UpdateSkeletalBodies();
+	
+	// The simulation half of StepPhysics: pending level bodies, skeletal poses, the Jolt step itself, moved body tracking and
+	// transform write back
+	void AdvancePhysics();
+	
+	// Contact modification and the Jolt step only. Snapshot replay steps with this, so past frames don't pick up bodies added
+	// since, the current animation pose or component write back, and the gameplay step and contact events are not broadcast again.
+	void StepJoltWorld();
+	
+	// Adds a heightfield body for every landscape collision component in Level, or in every loaded level when Level is null
+	void AddLandscapeBodies(const UWorld* World, const ULevel* Level);
+	
+	void AddLandscapeBody(ULandscapeHeightfieldCollisionComponent* Component);
+	
+	// Forgets the heightfield bodies of Level, and of any component destroyed since it was added. Their ids are added to OutBodyIDs.
+	void RemoveLandscapeBodies(const ULevel* Level, TSet<uint32>& OutBodyIDs);
+	
+	// Returns the heightfield for Component, from memory, the cooked cache on disk, or built from the landscape collision data
+	JPH::ShapeRefC GetHeightFieldShape(const ULandscapeHeightfieldCollisionComponent* Component);
+	
+	JPH::ShapeRefC BuildHeightFieldShape(const ULandscapeHeightfieldCollisionComponent* Component, const JPH::PhysicsMaterialList& Materials) const;
+	
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	void OnActorDestroyed(AActor* Actor);
+
 	void ExtractPhysicsGeometry(UPrimitiveComponent* PrimitiveComponent, const FTransform& XformSoFar, UBodySetup* BodySetup, PhysicsGeometryCallback CB, FUnrealShapeDescriptor& ShapeDescriptor);
 	
 	const JPH::Shape* ProcessShapeElement(const UShapeComponent* ShapeComponent);
@@ -382,6 +559,8 @@ public:
 	JPH::Body* GetRigidBody(const FHitResult& Hit) const;
 	JPH::Body* GetRigidBody(const UPrimitiveComponent* Target) const;
 	const FJoltUserData* GetUserData(const UPrimitiveComponent* Target) const;
+	// Bone owning the hit sub-shape if BodyID is a physics asset compound, NAME_None otherwise
+	FName GetHitBoneName(const JPH::BodyID& BodyID, const JPH::SubShapeID& SubShapeID) const;
 	static const FJoltUserData* GetUserData(const uint64& UserDataPtr);
 	const UJoltSettings* GetJoltSettings() const {return JoltSettings;};
 	
@@ -400,22 +579,115 @@ private:
 	bool BroadcastPendingRemovedContactEvents();
 	
 	FUnrealGroupFilter* UEGroupFilter = nullptr;
-	TArray<TUniquePtr<FJoltUserData>> UserDataStore;
+	FJoltUserDataArena UserDataArena;
 	
 	FCollisionResponseContainer DefaultCollisionResponseContainer;
 	
 	FJoltUserData* AllocUserData()
 	{
-		TUniquePtr<FJoltUserData> Ptr = MakeUnique<FJoltUserData>();
-		FJoltUserData* Raw = Ptr.Get();
-		UserDataStore.Add(MoveTemp(Ptr));
-		return Raw;
+		return UserDataArena.Alloc();
 	}
 	
 	
 #pragma endregion 
 	
 	
+#pragma region LARGE WORLD
+public:
+	
+	/**
+	 * Asks UE to move the world origin near NewOrigin (snapped to UJoltSettings::OriginRebaseGridSize). The Jolt world follows in
+	 * OnPostWorldOriginOffset at the start of the next world tick, i.e. between two physics steps, so peers that request the same
+	 * origin for the same frame end up with identical state. Does nothing unless UJoltSettings::bEnableOriginRebasing is set.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Large World")
+	void RequestOriginRebase(const FIntVector& NewOrigin);
+	
+	// UE world origin the Jolt coordinates are currently relative to
+	FIntVector GetJoltWorldOrigin() const { return JoltWorldOrigin; }
+	
+private:
+	void OnPostWorldOriginOffset(UWorld* InWorld, FIntVector SrcOrigin, FIntVector DstOrigin);
+	
+	// Moves every body and virtual character by -Offset (UE units), without waking anything up
+	void ShiftJoltWorld(const FIntVector& Offset);
+	
+	FIntVector JoltWorldOrigin = FIntVector::ZeroValue;
+	
+	FDelegateHandle WorldOriginOffsetHandle;
+	
+#pragma endregion
+	
+	
+#pragma region TRANSFORM WRITE BACK
+public:
+	
+	/**
+	 * Moves Component along with a Jolt body after every StepPhysics, see WriteBackTransforms. Component keeps its own scale.
+	 * Replaces any write back already registered for Component. Only movable components can follow a body.
+	 * @param BodyToComponent	Component transform relative to the body
+	 * @param bCenterOfMass		Follow the body's center of mass instead of its position
+	 */
+	void AddTransformWriteBack(USceneComponent* Component, const JPH::BodyID& BodyID, const FTransform& BodyToComponent, bool bCenterOfMass = false);
+	
+	// Same as above for the body of BodyComponent, keeping the offset Component has to it right now
+	bool AddTransformWriteBack(USceneComponent* Component, const UPrimitiveComponent* BodyComponent, bool bCenterOfMass = false);
+	
+	void RemoveTransformWriteBack(const USceneComponent* Component);
+	
+	// Body transform and velocities read for Component by the last write back, in the units of GetPhysicsState. False if Component
+	// has no write back or its body was not found.
+	bool GetWriteBackState(const USceneComponent* Component, FTransform& OutBodyTransform, FVector& OutVelocity, FVector& OutAngularVelocity) const;
+	
+	/*
+	 * Reads every body with a write back in one locked pass and moves the components of those that changed since the last pass.
+	 * Components are moved parents first, without sweeps or a physics update: children follow through UpdateComponentToWorld and
+	 * render transforms go out with the end of frame updates. Overlaps are refreshed once all components are in place.
+	 * Runs at the end of every StepPhysics, only reading the bodies the active body tracker reports as moved. Call it after moving
+	 * bodies outside a step to bring the components along right away.
+	 */
+	void WriteBackTransforms(bool bMovedBodiesOnly = false);
+	
+	int32 GetNumTransformWriteBacks() const { return WriteBackIndexByComponent.Num(); }
+	
+private:
+	// Drops write backs of destroyed components and orders the rest by attachment depth
+	void SortTransformWriteBacks();
+	
+	struct FJoltTransformWriteBack
+	{
+		TWeakObjectPtr<USceneComponent> Component;
+		FTransform BodyToComponent;		// Without scale
+		bool bCenterOfMass = false;
+		bool bBodyFound = false;
+		
+		// Body state from the last pass, UE units
+		FTransform BodyTransform;
+		FVector LinearVelocity = FVector::ZeroVector;
+		FVector AngularVelocity = FVector::ZeroVector;
+	};
+	
+	TArray<FJoltTransformWriteBack> WriteBacks;
+	
+	// Parallel to WriteBacks. The ids are handed to the multi body lock as is, the last read transforms are compared bitwise
+	// to skip bodies that did not move.
+	TArray<JPH::BodyID> WriteBackBodyIDs;
+	TArray<FJoltPackedTransform> WriteBackLastRead;
+	
+	TMap<TObjectKey<USceneComponent>, int32> WriteBackIndexByComponent;
+	bool bWriteBackOrderDirty = false;
+	
+	// Scratch for the bodies read and the bodies that moved during a pass
+	TArray<int32> ReadWriteBacks;
+	TArray<JPH::BodyID> ReadBodyIDs;
+	TArray<int32> MovedWriteBacks;
+	TArray<FJoltPackedTransform> MovedPackedTransforms;
+	TArray<FTransform> MovedTransforms;
+	TArray<UPrimitiveComponent*> WriteBackOverlapUpdates;
+	
+#pragma endregion
+	
+	
 #pragma region SNAPSHOT HISTORY
 public:
 	
@@ -426,15 +698,52 @@ public:
 	// This overwrites the ring slot for that frame index.
 	void SaveStateForFrame(int32 CommandFrame, const JPH::StateRecorderFilter* SaveFilter = nullptr);
 
-	// Restore snapshot for a specific command frame. Returns false if the snapshot is missing/stale.
-	bool RestoreStateForFrame(int32 CommandFrame);
+	// Restore snapshot for a specific command frame. Frames without a full snapshot are rebuilt by replaying from the nearest
+	// full one before them, see MaxSnapshotReplayFrames. When neither is possible, a partial snapshot of the frame still brings
+	// the tracked bodies back and the result is Partial.
+	EJoltSnapshotRestoreResult RestoreStateForFrame(int32 CommandFrame);
+	
+	// Whether RestoreStateForFrame would bring the whole frame back, directly or by replay
+	bool CanRestoreStateForFrame(int32 CommandFrame) const;
 	
 	bool RestoreStateFromBytes(TArrayView<const uint8> SnapshotBytes, const JPH::StateRecorderFilter* RestoreFilter);
+	
+	// Snapshot of a subset of the bodies (plus the virtual characters), e.g. the pawns or a region. Restoring it leaves every
+	// other body as it is. Restore with the same filter it was saved with.
+	bool SaveFilteredState(const SaveStateFilter& Filter, TArray<uint8>& OutBytes) const;
+	bool RestoreFilteredState(TArrayView<const uint8> SnapshotBytes, const SaveStateFilter& Filter);
+	
+	// Add the bodies of a subset to Filter. Clear the filter first to rebuild it, it keeps its memory.
+	void GatherPawnBodies(SaveStateFilter& Filter) const;
+	void GatherBodiesInBox(const FBox& Box, SaveStateFilter& Filter, bool bMovingOnly = true) const;
 
 	// Optional utilities
 	bool HasStateForFrame(int32 CommandFrame) const;
 	int32 GetSnapshotHistoryCapacity() const { return SnapshotHistory.Num(); }
 	
+	// How many frames behind the latest saved one may still be restored, e.g. RTT plus unacknowledged frames from the network
+	// prediction client, or the lag compensation window on the server. Grows the ring at the next resize decision when
+	// bAdaptiveSnapshotHistory is on.
+	void ReportRollbackWindow(int32 NumFrames);
+	
+	FJoltSnapshotMemoryStats GetSnapshotMemoryStats() const;
+	
+	// Server snapshot policy (UJoltSettings::ServerSnapshotPolicy). Tracked bodies are recorded on every frame, whatever the policy.
+	// Authoritative movers track their own body, so a replay puts them back where they were on every frame it rebuilds.
+	void AddSnapshotTrackedBody(const JPH::BodyID& BodyID);
+	void AddSnapshotTrackedBody(const UPrimitiveComponent* Target);
+	void RemoveSnapshotTrackedBody(const JPH::BodyID& BodyID);
+	void RemoveSnapshotTrackedBody(const UPrimitiveComponent* Target);
+	void ClearSnapshotTrackedBodies();
+	
+	// Records full snapshots on the next NumFrames saves, e.g. while a rewind for a pending hit validation may come in. Nothing in
+	// the plugin calls it, with the OnDemand policy the game decides when full frames are worth keeping.
+	void RequestServerSnapshots(int32 NumFrames);
+	
+	// Broadcast before each physics step replayed to rebuild a frame, with the frame being rebuilt. Lets systems that drive
+	// untracked bodies from outside the physics state (e.g. animation) re-apply what they did on that frame.
+	FOnSnapshotReplayStep OnSnapshotReplayStep;
+	
 	bool GetDataStreamForCommandFrame(const int32 CommandFrame, FString& DataStream) const;
 	
 	bool GetLastPhysicsState(const int32& CommandFrame, TArray<uint8>& OutBytes) const;
@@ -446,12 +755,37 @@ public:
 private:
 	// Convert frame -> slot index
 	int32 FrameToSlotIndex(int32 CommandFrame) const;
+	
+	// Restores a slot's bytes as they were saved, in the coordinates of Slot.Origin
+	bool RestoreSnapshotSlot(const FJoltPhysicsSnapshotSlot& Slot);
+	
+	// Latest frame at or before CommandFrame with a full snapshot, within MaxSnapshotReplayFrames. INDEX_NONE if there is none.
+	int32 FindReplayKeyframe(int32 CommandFrame) const;
+	
+	// Restores KeyFrame and steps the physics up to CommandFrame, applying the partial snapshots found on the way. Components are
+	// written back by the next live step.
+	bool ReplayStateForFrame(int32 KeyFrame, int32 CommandFrame);
+	
+	// Whether a dedicated server records this frame in full, partially (tracked bodies only) or not at all
+	enum class EServerSnapshotMode : uint8 { None, Partial, Full };
+	EServerSnapshotMode GetServerSnapshotMode(int32 CommandFrame) const;
 
 	// Ensures SnapshotHistory is allocated and capacity sane.
 	void EnsureSnapshotHistoryReady();
 
 	// Round up to power-of-two (min 1)
 	static int32 RoundUpToPowerOfTwo(int32 Value);
+	
+	// Capacity fitting the rollback depth seen over the last two intervals, within the configured limits and memory budget
+	int32 ComputeAdaptiveSnapshotCapacity() const;
+	
+	// Reallocates the ring, keeping every saved frame that still has a slot at the new size (the newest on collisions)
+	void ResizeSnapshotHistory(int32 NewCapacity);
+	
+	// Runs after each save: tracks snapshot sizes and resizes the ring once per SnapshotHistoryResizeInterval
+	void UpdateAdaptiveSnapshotHistory(int32 SavedBytes);
+	
+	void UpdateSnapshotMemoryStats() const;
 
 private:
 	// Circular buffer of snapshots.
@@ -464,6 +798,24 @@ private:
 	UPROPERTY(transient)
 	int32 SnapshotHistoryCapacity = 256;
 	
+	// Adaptive sizing state
+	int32 LatestSavedFrame = INDEX_NONE;
+	int32 RollbackDepthThisInterval = 0;
+	int32 RollbackDepthLastInterval = 0;
+	int32 SavesSinceResizeCheck = 0;
+	double AverageSnapshotBytes = 0.0;
+	
+	// Bytes allocated by SnapshotHistory slot data, kept up to date on every save
+	int64 SnapshotBytesAllocated = 0;
+	
+	// Server snapshot policy state
+	SaveStateFilter SnapshotTrackedBodies;
+	int32 PendingServerSnapshotFrames = 0;
+	
+	// Frame of the last save and the active body tracker's step count at the time, see UJoltSettings::bReuseQuietFrameSnapshots
+	int32 LastSaveFrame = INDEX_NONE;
+	uint32 LastSaveStepCount = 0;
+	
 	
 	
 #pragma endregion
@@ -6,6 +6,21 @@
 #include "UObject/Object.h"
 #include "JoltBridgeCoreSettings.generated.h"
 
+// Which frames a dedicated server records physics snapshots for, see UJoltSettings::ServerSnapshotPolicy
+UENUM()
+enum class EJoltServerSnapshotPolicy : uint8
+{
+	// A full snapshot every frame
+	EveryFrame,
+	
+	// A full snapshot every ServerSnapshotInterval frames. Frames in between record the tracked bodies only and are rebuilt by replay.
+	Interval,
+	
+	// Full snapshots only while UJoltPhysicsWorldSubsystem::RequestServerSnapshots is pending, the tracked bodies otherwise.
+	// The game must request them, nothing in the plugin does.
+	OnDemand,
+};
+
 /**
  * 
  */
@@ -145,6 +160,94 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, Category="Jolt|Rollback")
 	bool bStoreSnapshotsOnServer = true;
+	
+	/*
+	 * How much of the server's snapshot cost to pay when bStoreSnapshotsOnServer is on. Outside of EveryFrame, bodies registered through
+	 * UJoltPhysicsWorldSubsystem::AddSnapshotTrackedBody (e.g. lag compensated hit validation targets) are recorded every frame, and
+	 * restoring a frame without a full snapshot replays the physics from the nearest full one before it. Mover bodies are tracked
+	 * automatically on the authority.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bStoreSnapshotsOnServer"))
+	EJoltServerSnapshotPolicy ServerSnapshotPolicy = EJoltServerSnapshotPolicy::EveryFrame;
+	
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bStoreSnapshotsOnServer && ServerSnapshotPolicy == EJoltServerSnapshotPolicy::Interval", ClampMin=2))
+	int32 ServerSnapshotInterval = 6;
+	
+	// Longest replay a restore may run to rebuild a frame that has no full snapshot. Restores needing more fail like a missing frame.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(ClampMin=0))
+	int32 MaxSnapshotReplayFrames = 30;
+	
+	/*
+	 * When no body moved, woke up or fell asleep during the step since the previous frame's snapshot, copy that snapshot instead of
+	 * saving the world again. Bodies changed between steps must be reported to the active body tracker, which the subsystem does for
+	 * its own setters: leave this off if other code teleports sleeping bodies through the body interface without activating them.
+	 * Never used while virtual characters exist.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback")
+	bool bReuseQuietFrameSnapshots = false;
+
+	/*
+	 * Resize the snapshot ring to the rollback distance actually needed instead of keeping SnapshotHistoryCapacity slots.
+	 * The distance is the deepest restore seen, and what network prediction reports every tick: RTT and unacknowledged frames
+	 * on clients, the maximum lag compensation rewind on servers.
+	 * SnapshotHistoryCapacity is then only the starting size.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback")
+	bool bAdaptiveSnapshotHistory = true;
+
+	// Frames kept on top of the deepest rollback seen, to absorb RTT spikes before the ring grows.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bAdaptiveSnapshotHistory", ClampMin=0))
+	int32 SnapshotHistorySlackFrames = 16;
+
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bAdaptiveSnapshotHistory", ClampMin=8))
+	int32 MinSnapshotHistoryCapacity = 32;
+
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bAdaptiveSnapshotHistory", ClampMin=8))
+	int32 MaxSnapshotHistoryCapacity = 1024;
+
+	// Upper bound for the bytes held by the ring, based on the average snapshot size. Takes precedence over the rollback distance,
+	// but never goes below MinSnapshotHistoryCapacity. 0 for no budget.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bAdaptiveSnapshotHistory", ClampMin=0))
+	float SnapshotMemoryBudgetMB = 64.f;
+
+	// Saved frames between two resize decisions. The deepest rollback of the last two intervals sets the size, so the ring
+	// shrinks back between one and two intervals after rollbacks get shallower.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Rollback", meta=(EditCondition="bAdaptiveSnapshotHistory", ClampMin=1))
+	int32 SnapshotHistoryResizeInterval = 300;
+
+	// --- Landscape ---
+	// Build a static heightfield body for every landscape collision component, added and removed as landscape proxies stream in and out.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Landscape")
+	bool bRegisterLandscapeCollision = true;
+	
+	/*
+	 * Built heightfield shapes are written here and loaded on later runs instead of being rebuilt from the landscape.
+	 * Relative to the project directory, leave empty to always rebuild. Add the folder to "Additional Non-Asset Directories To Package"
+	 * to ship the cooked heightfields with the game.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Landscape", meta=(EditCondition="bRegisterLandscapeCollision"))
+	FString HeightFieldCacheDirectory = TEXT("Saved/JoltData/HeightFields");
+	
+	// Samples per side of a heightfield block, in [2, 8]. Bigger blocks use less memory but give looser bounds to collision queries.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Landscape", meta=(EditCondition="bRegisterLandscapeCollision", ClampMin=2, ClampMax=8))
+	int32 HeightFieldBlockSize = 4;
+
+	// Shift the Jolt world along with UE's world origin (UWorld::SetNewWorldOrigin, world composition rebasing). Snapshots taken
+	// under an earlier origin are moved onto the current one when restored. Pairs with the large world build of the Jolt library,
+	// see JoltPhysics.Build bDoublePrecision.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Large World")
+	bool bEnableOriginRebasing = false;
+
+	// Origins requested through UJoltPhysicsWorldSubsystem::RequestOriginRebase snap to multiples of this, in cm. A power of two
+	// number of metres keeps every shift exactly representable in Jolt coordinates.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Large World", meta=(EditCondition="bEnableOriginRebasing", ClampMin=100))
+	int32 OriginRebaseGridSize = 102400;
+
+	// --- Transforms ---
+	// Move the components of dynamic bodies registered through UJoltPhysicsWorldSubsystem::RegisterJoltRigidBody along with their
+	// bodies after every physics step, see UJoltPhysicsWorldSubsystem::WriteBackTransforms.
+	UPROPERTY(Config, EditAnywhere, Category="Jolt|Transforms")
+	bool bWriteBackRigidBodyTransforms = true;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
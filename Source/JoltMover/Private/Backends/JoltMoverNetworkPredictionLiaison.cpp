@@ -35,6 +35,7 @@ public:
 
 	static const TCHAR* GetName() { return TEXT("JoltMoverActor"); }
 	static constexpr int32 GetSortPriority() { return (int32)EJoltNetworkPredictionSortPriority::PreKinematicMovers; }
+	static constexpr bool SupportsParallelTick() { return true; }
 };
 
 JNP_MODEL_REGISTER(FJoltMoverActorModelDef);
@@ -223,6 +224,23 @@ void UJoltMoverNetworkPredictionLiaisonComponent::SimulationTick(const FJoltNetS
     *SimOutput.Aux.Get() = EndData.AuxState;
 }
 
+bool UJoltMoverNetworkPredictionLiaisonComponent::CanSimulationTickInParallel() const
+{
+	return MoverComp && MoverComp->CanSimulationTickInParallel();
+}
+
+void UJoltMoverNetworkPredictionLiaisonComponent::BeginParallelSimulationTick()
+{
+	check(MoverComp);
+	MoverComp->BeginParallelSimulationTick();
+}
+
+void UJoltMoverNetworkPredictionLiaisonComponent::CommitParallelSimulationTick()
+{
+	check(MoverComp);
+	MoverComp->CommitParallelSimulationTick();
+}
+
 void UJoltMoverNetworkPredictionLiaisonComponent::PostPhysicsTick(const FJoltNetSimTimeStep& TimeStep, const TJoltNetSimInput<KinematicMoverStateTypes>& SimInput, const TJoltNetSimOutput<KinematicMoverStateTypes>& SimOutput)
 {
 	check(MoverComp);
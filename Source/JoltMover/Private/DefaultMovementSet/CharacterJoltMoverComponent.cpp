@@ -110,7 +110,7 @@ bool UCharacterJoltMoverComponent::IsSlopeSliding() const
 	{
 		FJoltFloorCheckResult HitResult;
 		const UJoltMoverBlackboard* MoverBlackboard = GetSimBlackboard();
-		if (MoverBlackboard && MoverBlackboard->TryGet(CommonBlackboard::LastFloorResult, HitResult))
+		if (MoverBlackboard && MoverBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, HitResult))
 		{
 			return HitResult.bBlockingHit && !HitResult.bWalkableFloor;
 		}
@@ -242,7 +242,7 @@ void UCharacterJoltMoverComponent::RestoreFrame(const FJoltMoverSyncState* SyncS
 			{
 				VirtualCharacter->SetLinearVelocity(JoltHelpers::ToJoltVector3(WorldVelocity));
 				VirtualCharacter->SetRotation(JoltHelpers::ToJoltRotation(Transform.GetRotation()));
-				VirtualCharacter->SetPosition(JoltHelpers::ToJoltVector3(Transform.GetTranslation()));
+				VirtualCharacter->SetPosition(JoltHelpers::ToJoltPosition(Transform.GetTranslation()));
 			}
 		
 		}
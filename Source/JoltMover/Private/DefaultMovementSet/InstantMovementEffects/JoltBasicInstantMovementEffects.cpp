@@ -68,8 +68,8 @@ bool FJoltTeleportEffect::ApplyMovementEffect(FJoltApplyMovementEffectParams& Ap
 		// TODO: instead of invalidating it, consider checking for a floor. Possibly a dynamic base?
 		if (UJoltMoverBlackboard* SimBlackboard = ApplyEffectParams.MoverComp->GetSimBlackboard_Mutable())
 		{
-			SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);
-			SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+			SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);
+			SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 		}
 
 		ApplyEffectParams.OutputEvents.Add(MakeShared<FJoltTeleportSucceededEventData>(ApplyEffectParams.TimeStep->BaseSimTimeMs, PreviousLocation, PreviousRotation, TargetLocation, FQuat(FinalTargetRotation)));
@@ -171,8 +171,8 @@ bool FAsyncTeleportEffect::ApplyMovementEffect(FJoltApplyMovementEffectParams& A
 			// TODO: instead of invalidating it, consider checking for a floor. Possibly a dynamic base?
 			if (UJoltMoverBlackboard* SimBlackboard = ApplyEffectParams.MoverComp->GetSimBlackboard_Mutable())
 			{
-				SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);
-				SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+				SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);
+				SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 			}
 
 			return true;
@@ -236,7 +236,7 @@ bool FJumpImpulseEffect::ApplyMovementEffect(FJoltApplyMovementEffectParams& App
 		FJoltRelativeBaseInfo MovementBaseInfo;
 		if (const UJoltMoverBlackboard* SimBlackboard = ApplyEffectParams.MoverComp->GetSimBlackboard())
 		{
-			SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+			SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 		}
 
 		const FVector FinalVelocity = StartingNonUpwardsVelocity + ImpulseVelocity;
@@ -303,7 +303,7 @@ bool FJoltApplyVelocityEffect::ApplyMovementEffect(FJoltApplyMovementEffectParam
 	FJoltRelativeBaseInfo MovementBaseInfo;
 	if (const UJoltMoverBlackboard* SimBlackboard = ApplyEffectParams.MoverComp->GetSimBlackboard())
 	{
-		SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+		SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 	}
 
 	FVector Velocity = VelocityToApply;
@@ -37,7 +37,7 @@ bool FJoltLayeredMove_MultiJump::GenerateMove(const FJoltMoverTickStartData& Sta
 	OutProposedMove.MixMode = MixMode;
 
 	FJoltFloorCheckResult FloorHitResult;
-	bool bValidBlackboard = SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, OUT FloorHitResult);
+	bool bValidBlackboard = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, OUT FloorHitResult);
 
 	if (FMath::IsNearlyEqual(StartSimTimeMs, TimeStep.BaseSimTimeMs))
 	{
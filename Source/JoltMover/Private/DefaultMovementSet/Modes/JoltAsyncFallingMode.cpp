@@ -107,7 +107,7 @@ void UJoltAsyncFallingMode::GenerateMove_Implementation(const FJoltMoverTickStar
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 	FJoltFloorCheckResult LastFloorResult;
 	// limit our moveinput based on the floor we're on
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult))
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult))
 	{
 		if (LastFloorResult.HitResult.IsValidBlockingHit() && LastFloorResult.HitResult.Normal.Dot(UpDirection) > UE::JoltMoverUtils::VERTICAL_SLOPE_NORMAL_MAX_DOT && !LastFloorResult.IsWalkableFloor())
 		{
@@ -174,8 +174,8 @@ void UJoltAsyncFallingMode::SimulationTick_Implementation(const FJoltSimulationT
 	
 	UJoltMoverBlackboard* SimBlackboard = MoverComponent->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);	// falling = no valid floor
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);	// falling = no valid floor
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.MoveDirectionIntent = (ProposedMove.bHasDirIntent ? ProposedMove.DirectionIntent : FVector::ZeroVector);
 
@@ -233,7 +233,7 @@ void UJoltAsyncFallingMode::SimulationTick_Implementation(const FJoltSimulationT
 
 		
 		LandingFloor.HitResult = SweepHit;
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, LandingFloor);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, LandingFloor);
 		
 		FJoltMoverOnImpactParams ImpactParams(DefaultModeNames::Falling, SweepHit, MoveDelta);
 		MoverComponent->HandleImpact(ImpactParams);
@@ -308,7 +308,7 @@ void UJoltAsyncFallingMode::ProcessLanded(const FJoltFloorCheckResult& FloorResu
 		// Transfer to LandingMovementMode (usually walking), and cache any floor / movement base info
 		NextMovementMode = CommonLegacySettings->GroundMovementModeName;
 
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 		if (UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 		{
@@ -354,7 +354,7 @@ void UJoltAsyncFallingMode::CaptureFinalState(const FJoltUpdatedMotionState* Sta
 
 	if (MovementBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
 												  FinalRotation,
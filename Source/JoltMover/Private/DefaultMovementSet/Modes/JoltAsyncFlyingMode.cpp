@@ -91,8 +91,8 @@ void UJoltAsyncFlyingMode::SimulationTick_Implementation(const FJoltSimulationTi
 	MoveRecord.SetDeltaSeconds(DeltaSeconds);
 
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
-	SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);	// flying = no valid floor
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);	// flying = no valid floor
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.MoveDirectionIntent = (ProposedMove.bHasDirIntent ? ProposedMove.DirectionIntent : FVector::ZeroVector);
 
@@ -18,6 +18,7 @@
 #include "NavigationSystem.h"
 #include "AI/Navigation/PathFollowingAgentInterface.h"
 #include "MoveLibrary/JoltNavMovementUtils.h"
+#include "MoveLibrary/JoltNavQueryBatcher.h"
 #include "NavMesh/RecastNavMesh.h"
 #include "VisualLogger/VisualLogger.h"
 
@@ -76,7 +77,7 @@ void UJoltAsyncNavWalkingMode::GenerateMove_Implementation(const FJoltMoverTickS
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
 	// Try to use the floor as the basis for the intended move direction (i.e. try to walk along slopes, rather than into them)
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
 	{
 		MovementNormal = LastFloorResult.HitResult.ImpactNormal;
 	}
@@ -203,6 +204,12 @@ void UJoltAsyncNavWalkingMode::SimulationTick_Implementation(const FJoltSimulati
 	{
 		NavDataInterface = GetNavData();
 	}
+
+	UJoltMoverNavQueryBatcher* NavQueryBatcher = UJoltMoverNavQueryBatcher::Get(MoverComp);
+	if (NavQueryBatcher)
+	{
+		NavQueryBatcher->BeginSimTick(Params.TimeStep.BaseSimTimeMs);
+	}
 	
 	bool bSameNavLocation = false;
 	if (CachedNavLocation.HasNodeRef())
@@ -276,7 +283,8 @@ void UJoltAsyncNavWalkingMode::SimulationTick_Implementation(const FJoltSimulati
 
 				if (bHasValidCachedNavLocation)
 				{
-					bFoundPointOnNavMesh = NavDataInterface->FindMoveAlongSurface(StartingNavFloorLocation, TargetFeetLocation, OUT DestNavLocation);
+					bFoundPointOnNavMesh = NavQueryBatcher ? NavQueryBatcher->FindMoveAlongSurface(NavDataInterface.Get(), StartingNavFloorLocation, TargetFeetLocation, OUT DestNavLocation)
+						: NavDataInterface->FindMoveAlongSurface(StartingNavFloorLocation, TargetFeetLocation, OUT DestNavLocation);
 
 					if (bFoundPointOnNavMesh)
 					{
@@ -342,7 +350,7 @@ void UJoltAsyncNavWalkingMode::SimulationTick_Implementation(const FJoltSimulati
 			if (UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable())
 			{
 				const FJoltFloorCheckResult EmptyFloorCheckResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, EmptyFloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, EmptyFloorCheckResult);
 			}
 		}
 
@@ -369,6 +377,11 @@ void UJoltAsyncNavWalkingMode::SimulationTick_Implementation(const FJoltSimulati
 			// not moving, but let's allow the full rotation
 			RotationInProgress = TargetRotation;
 		}
+
+		if (NavQueryBatcher)
+		{
+			PrefetchNextNavQuery(*NavQueryBatcher, Params.TimeStep, NavMoverComponent->GetFeetLocationAt(LocationInProgress), OrigMoveDelta);
+		}
 	}
 	else
 	{
@@ -391,7 +404,45 @@ bool UJoltAsyncNavWalkingMode::FindNavFloor(const FVector& TestLocation, FNavLoc
 	const float SearchRadius = AgentProps.AgentRadius * 2.0f;
 	const float SearchHeight = AgentProps.AgentHeight * AgentProps.NavWalkingSearchHeightScale;
 
-	return NavData->ProjectPoint(TestLocation, OutNavFloorLocation, FVector(SearchRadius, SearchRadius, SearchHeight));
+	const FVector SearchExtent(SearchRadius, SearchRadius, SearchHeight);
+
+	if (UJoltMoverNavQueryBatcher* NavQueryBatcher = UJoltMoverNavQueryBatcher::Get(NavMoverComponent.Get()))
+	{
+		return NavQueryBatcher->ProjectPoint(NavData, TestLocation, SearchExtent, OutNavFloorLocation);
+	}
+
+	return NavData->ProjectPoint(TestLocation, OutNavFloorLocation, SearchExtent);
+}
+
+void UJoltAsyncNavWalkingMode::PrefetchNextNavQuery(UJoltMoverNavQueryBatcher& NavQueryBatcher, const FJoltMoverTimeStep& TimeStep, const FVector& NextFeetLocation, const FVector& MoveDelta) const
+{
+	// Projected walking re-bases each query on the underlying geometry, so the next query can't be known ahead of time
+	if (bProjectNavMeshWalking || MoveDelta.IsNearlyZero() || !NavDataInterface.IsValid() || !NavMoverComponent.IsValid())
+	{
+		return;
+	}
+
+	// Assume next tick starts where this one ended and keeps the same velocity. If not, the prefetched result simply goes unused.
+	const double NextSimTimeMs = TimeStep.BaseSimTimeMs + TimeStep.StepMs;
+	const FVector NextDest = NextFeetLocation + MoveDelta;
+
+	const IPathFollowingAgentInterface* PathFollowingAgent = NavMoverComponent->GetPathFollowingAgent();
+	const bool bIsOnNavLink = PathFollowingAgent && PathFollowingAgent->IsFollowingNavLink();
+
+	if (bSlideAlongNavMeshEdge && !bIsOnNavLink)
+	{
+		if (CachedNavLocation.HasNodeRef())
+		{
+			NavQueryBatcher.PrefetchMoveAlongSurface(NextSimTimeMs, NavDataInterface.Get(), CachedNavLocation, NextDest);
+		}
+	}
+	else
+	{
+		const FNavAgentProperties& AgentProps = NavMoverComponent->GetNavAgentPropertiesRef();
+		const float SearchRadius = AgentProps.AgentRadius * 2.0f;
+		const float SearchHeight = AgentProps.AgentHeight * AgentProps.NavWalkingSearchHeightScale;
+		NavQueryBatcher.PrefetchProjectPoint(NextSimTimeMs, NavDataInterface.Get(), NextDest, FVector(SearchRadius, SearchRadius, SearchHeight));
+	}
 }
 
 UObject* UJoltAsyncNavWalkingMode::GetTurnGenerator()
@@ -419,7 +470,7 @@ void UJoltAsyncNavWalkingMode::Activate()
 	{
 		if (UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable())
 		{
-			SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);
+			SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);
 		}
 	}
 
@@ -541,7 +592,7 @@ FVector UJoltAsyncNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeconds,
 
 	FJoltFloorCheckResult CachedFloorCheckResult;
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
-	bool bHasValidFloorResult = SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, CachedFloorCheckResult);
+	bool bHasValidFloorResult = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, CachedFloorCheckResult);
 	FHitResult CachedProjectedNavMeshHitResult = CachedFloorCheckResult.HitResult;
 
 	// We can skip this trace if we are checking at the same location as the last trace (ie, we haven't moved).
@@ -566,7 +617,7 @@ FVector UJoltAsyncNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeconds,
 			{
 				CachedProjectedNavMeshHitResult.Reset();
 				const FJoltFloorCheckResult EmptyFloorCheckResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, EmptyFloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, EmptyFloorCheckResult);
 			}
 			else
 			{
@@ -579,7 +630,7 @@ FVector UJoltAsyncNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeconds,
 				FloorCheckResult.LineDist = FMath::Abs((CurrentFeetLocation - CachedProjectedNavMeshHitResult.ImpactPoint).Dot(UpDirection));
 				FloorCheckResult.FloorDist = FloorCheckResult.LineDist; // This is usually set from a sweep trace but it doesn't really hurt setting it. 
 				FloorCheckResult.HitResult = CachedProjectedNavMeshHitResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorCheckResult);
 			}
 		}
 		else
@@ -667,7 +718,7 @@ void UJoltAsyncNavWalkingMode::CaptureOutputState(const FJoltUpdatedMotionState&
 
 	// If we're on a dynamic base and we're not trying to move, keep using the same relative actor location. This prevents slow relative 
 	//  drifting that can occur from repeated floor sampling as the base moves through the world.
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.SetTransforms_WorldSpace(FinalLocation,
 		FinalRotation,
@@ -46,7 +46,7 @@ void UJoltAsyncWalkingMode::GenerateMove_Implementation(const FJoltMoverTickStar
 	FVector UpDirection = MoverComp->GetUpDirection();
 
 	// Try to use the floor as the basis for the intended move direction (i.e. try to walk along slopes, rather than into them)
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
 	{
 		MovementNormal = LastFloorResult.HitResult.ImpactNormal;
 	}
@@ -150,7 +150,7 @@ void UJoltAsyncWalkingMode::SimulationTick_Implementation(const FJoltSimulationT
 	FVector UpDirection = MoverComp->GetUpDirection();
 	
 	// If we don't have cached floor information, we need to search for it again
-	if (!SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, CurrentFloor))
+	if (!SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, CurrentFloor))
 	{
 		UJoltFloorQueryUtils::FindFloor(Params.MovingComps, CommonLegacySettings->FloorSweepDistance, CommonLegacySettings->MaxWalkSlopeCosine, CommonLegacySettings->bUseFlatBaseForFloorChecks, StartLocation, CurrentFloor);
 	}
@@ -371,7 +371,7 @@ void UJoltAsyncWalkingMode::CaptureFinalState(const FVector FinalLocation, const
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, PriorBaseInfo);
+	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, PriorBaseInfo);
 
 	FJoltRelativeBaseInfo CurrentBaseInfo = UpdateFloorAndBaseInfo(FloorResult);
 
@@ -386,7 +386,7 @@ void UJoltAsyncWalkingMode::CaptureFinalState(const FVector FinalLocation, const
 	
 	if (CurrentBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, CurrentBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, CurrentBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
                                                   FinalRotation,
@@ -396,7 +396,7 @@ void UJoltAsyncWalkingMode::CaptureFinalState(const FVector FinalLocation, const
 	}
 	else
 	{
-		SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
                                                   FinalRotation,
@@ -414,7 +414,7 @@ FJoltRelativeBaseInfo UJoltAsyncWalkingMode::UpdateFloorAndBaseInfo(const FJoltF
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+	SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 	if (FloorResult.IsWalkableFloor() && UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 	{
@@ -101,7 +101,7 @@ void UJoltKinematicFallingMode::GenerateMove_Implementation(const FJoltMoverTick
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 	FJoltFloorCheckResult LastFloorResult;
 	// limit our moveinput based on the floor we're on
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult))
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult))
 	{
 		if (LastFloorResult.HitResult.IsValidBlockingHit() && LastFloorResult.HitResult.Normal.Dot(UpDirection) > UE::JoltMoverUtils::VERTICAL_SLOPE_NORMAL_MAX_DOT && !LastFloorResult.IsWalkableFloor())
 		{
@@ -168,8 +168,8 @@ void UJoltKinematicFallingMode::SimulationTick_Implementation(const FJoltSimulat
 	
 	UJoltMoverBlackboard* SimBlackboard = MoverComponent->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);	// falling = no valid floor
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);	// falling = no valid floor
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.MoveDirectionIntent = (ProposedMove.bHasDirIntent ? ProposedMove.DirectionIntent : FVector::ZeroVector);
 
@@ -230,7 +230,7 @@ void UJoltKinematicFallingMode::SimulationTick_Implementation(const FJoltSimulat
 		}
 		
 		LandingFloor.HitResult = Hit;
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, LandingFloor);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, LandingFloor);
 		
 		FJoltMoverOnImpactParams ImpactParams(DefaultModeNames::Falling, Hit, MoveDelta);
 		MoverComponent->HandleImpact(ImpactParams);
@@ -297,7 +297,7 @@ void UJoltKinematicFallingMode::ProcessLanded(const FJoltFloorCheckResult& Floor
 		// Transfer to LandingMovementMode (usually walking), and cache any floor / movement base info
 		NextMovementMode = CommonLegacySettings->GroundMovementModeName;
 
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 		if (UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 		{
@@ -346,7 +346,7 @@ void UJoltKinematicFallingMode::CaptureFinalState(USceneComponent* UpdatedCompon
 
 	if (MovementBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
 												  UpdatedComponent->GetComponentRotation(),
@@ -14,6 +14,7 @@
 #include "MoveLibrary/JoltGroundMovementUtils.h"
 #include "MoveLibrary/JoltModularMovement.h"
 #include "MoveLibrary/JoltMovementUtils.h"
+#include "MoveLibrary/JoltNavQueryBatcher.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltKinematicNavWalkingMode)
 
@@ -51,7 +52,7 @@ void UJoltKinematicNavWalkingMode::GenerateMove_Implementation(const FJoltMoverT
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
 	// Try to use the floor as the basis for the intended move direction (i.e. try to walk along slopes, rather than into them)
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
 	{
 		MovementNormal = LastFloorResult.HitResult.ImpactNormal;
 	}
@@ -178,6 +179,12 @@ void UJoltKinematicNavWalkingMode::SimulationTick_Implementation(const FJoltSimu
 	{
 		NavDataInterface = GetNavData();
 	}
+
+	UJoltMoverNavQueryBatcher* NavQueryBatcher = UJoltMoverNavQueryBatcher::Get(MoverComp);
+	if (NavQueryBatcher)
+	{
+		NavQueryBatcher->BeginSimTick(Params.TimeStep.BaseSimTimeMs);
+	}
 	
 	bool bSameNavLocation = false;
 	if (CachedNavLocation.NodeRef != INVALID_NAVNODEREF)
@@ -251,7 +258,8 @@ void UJoltKinematicNavWalkingMode::SimulationTick_Implementation(const FJoltSimu
 
 				if (bHasValidCachedNavLocation)
 				{
-					bFoundPointOnNavMesh = NavDataInterface->FindMoveAlongSurface(StartingNavFloorLocation, AdjustedDest, OUT DestNavLocation);
+					bFoundPointOnNavMesh = NavQueryBatcher ? NavQueryBatcher->FindMoveAlongSurface(NavDataInterface.Get(), StartingNavFloorLocation, AdjustedDest, OUT DestNavLocation)
+						: NavDataInterface->FindMoveAlongSurface(StartingNavFloorLocation, AdjustedDest, OUT DestNavLocation);
 
 					if (bFoundPointOnNavMesh)
 					{
@@ -318,7 +326,7 @@ void UJoltKinematicNavWalkingMode::SimulationTick_Implementation(const FJoltSimu
 			if (UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable())
 			{
 				const FJoltFloorCheckResult EmptyFloorCheckResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, EmptyFloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, EmptyFloorCheckResult);
 			}	
 		}
 
@@ -329,6 +337,11 @@ void UJoltKinematicNavWalkingMode::SimulationTick_Implementation(const FJoltSimu
 			FHitResult MoveHitResult;
 			UJoltMovementUtils::TrySafeMoveUpdatedComponent(Params.MovingComps, AdjustedDelta, TargetOrientQuat, bSweepWhileNavWalking, MoveHitResult, ETeleportType::None, MoveRecord);
 		}
+
+		if (NavQueryBatcher)
+		{
+			PrefetchNextNavQuery(*NavQueryBatcher, Params.TimeStep, NavMoverComponent->GetFeetLocation(), OrigMoveDelta);
+		}
 	}
 	else
 	{
@@ -352,7 +365,45 @@ bool UJoltKinematicNavWalkingMode::FindNavFloor(const FVector& TestLocation, FNa
 	const float SearchRadius = AgentProps.AgentRadius * 2.0f;
 	const float SearchHeight = AgentProps.AgentHeight * AgentProps.NavWalkingSearchHeightScale;
 
-	return NavData->ProjectPoint(TestLocation, OutNavFloorLocation, FVector(SearchRadius, SearchRadius, SearchHeight));
+	const FVector SearchExtent(SearchRadius, SearchRadius, SearchHeight);
+
+	if (UJoltMoverNavQueryBatcher* NavQueryBatcher = UJoltMoverNavQueryBatcher::Get(NavMoverComponent))
+	{
+		return NavQueryBatcher->ProjectPoint(NavData, TestLocation, SearchExtent, OutNavFloorLocation);
+	}
+
+	return NavData->ProjectPoint(TestLocation, OutNavFloorLocation, SearchExtent);
+}
+
+void UJoltKinematicNavWalkingMode::PrefetchNextNavQuery(UJoltMoverNavQueryBatcher& NavQueryBatcher, const FJoltMoverTimeStep& TimeStep, const FVector& NextFeetLocation, const FVector& MoveDelta) const
+{
+	// Projected walking re-bases each query on the underlying geometry, so the next query can't be known ahead of time
+	if (bProjectNavMeshWalking || MoveDelta.IsNearlyZero() || !NavDataInterface.IsValid() || NavMoverComponent == nullptr)
+	{
+		return;
+	}
+
+	// Assume next tick starts where this one ended and keeps the same velocity. If not, the prefetched result simply goes unused.
+	const double NextSimTimeMs = TimeStep.BaseSimTimeMs + TimeStep.StepMs;
+	const FVector NextDest = NextFeetLocation + MoveDelta;
+
+	const IPathFollowingAgentInterface* PathFollowingAgent = NavMoverComponent->GetPathFollowingAgent();
+	const bool bIsOnNavLink = PathFollowingAgent && PathFollowingAgent->IsFollowingNavLink();
+
+	if (bSlideAlongNavMeshEdge && !bIsOnNavLink)
+	{
+		if (CachedNavLocation.HasNodeRef())
+		{
+			NavQueryBatcher.PrefetchMoveAlongSurface(NextSimTimeMs, NavDataInterface.Get(), CachedNavLocation, NextDest);
+		}
+	}
+	else
+	{
+		const FNavAgentProperties& AgentProps = NavMoverComponent->GetNavAgentPropertiesRef();
+		const float SearchRadius = AgentProps.AgentRadius * 2.0f;
+		const float SearchHeight = AgentProps.AgentHeight * AgentProps.NavWalkingSearchHeightScale;
+		NavQueryBatcher.PrefetchProjectPoint(NextSimTimeMs, NavDataInterface.Get(), NextDest, FVector(SearchRadius, SearchRadius, SearchHeight));
+	}
 }
 
 UObject* UJoltKinematicNavWalkingMode::GetTurnGenerator()
@@ -392,7 +443,7 @@ void UJoltKinematicNavWalkingMode::SetCollisionForNavWalking(bool bEnable)
 					if (UJoltMoverBlackboard* SimBlackboard = MoverComponent->GetSimBlackboard_Mutable())
 					{
 						const FJoltFloorCheckResult EmptyFloorCheckResult;
-						SimBlackboard->Set(CommonBlackboard::LastFloorResult, EmptyFloorCheckResult);
+						SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, EmptyFloorCheckResult);
 					}
 
 					// Stagger timed updates so many different characters spawned at the same time don't update on the same frame.
@@ -525,7 +576,7 @@ FVector UJoltKinematicNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeco
 
 	FJoltFloorCheckResult CachedFloorCheckResult;
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
-	bool bHasValidFloorResult = SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, CachedFloorCheckResult);
+	bool bHasValidFloorResult = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, CachedFloorCheckResult);
 	FHitResult CachedProjectedNavMeshHitResult = CachedFloorCheckResult.HitResult;
 	
 	// We can skip this trace if we are checking at the same location as the last trace (ie, we haven't moved).
@@ -549,7 +600,7 @@ FVector UJoltKinematicNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeco
 			{
 				CachedProjectedNavMeshHitResult.Reset();
 				const FJoltFloorCheckResult EmptyFloorCheckResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, EmptyFloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, EmptyFloorCheckResult);
 			}
 			else
 			{
@@ -562,7 +613,7 @@ FVector UJoltKinematicNavWalkingMode::ProjectLocationFromNavMesh(float DeltaSeco
 				FloorCheckResult.LineDist = FMath::Abs((CurrentFeetLocation - CachedProjectedNavMeshHitResult.ImpactPoint).Dot(UpDirection));
 				FloorCheckResult.FloorDist = FloorCheckResult.LineDist; // This is usually set from a sweep trace but it doesn't really hurt setting it. 
 				FloorCheckResult.HitResult = HitResult;
-				SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorCheckResult);
+				SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorCheckResult);
 			}
 		}
 		else
@@ -645,7 +696,7 @@ void UJoltKinematicNavWalkingMode::CaptureFinalState(USceneComponent* UpdatedCom
 {
 	UJoltMoverBlackboard* SimBlackboard = GetMoverComponent()->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.SetTransforms_WorldSpace(UpdatedComponent->GetComponentLocation(),
 		UpdatedComponent->GetComponentRotation(),
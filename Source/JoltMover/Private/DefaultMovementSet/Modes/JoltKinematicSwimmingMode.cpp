@@ -37,7 +37,7 @@ void UJoltKinematicSwimmingMode::GenerateMove_Implementation(const FJoltMoverTic
 
 	if (SimBlackboard)
 	{
-		SimBlackboard->TryGet(CommonBlackboard::LastWaterResult, LastWaterResult);
+		SimBlackboard->TryGet(CommonBlackboard::Keys::LastWaterResult, LastWaterResult);
 	}
 	
 	FVector Velocity = StartingSyncState->GetVelocity_WorldSpace();
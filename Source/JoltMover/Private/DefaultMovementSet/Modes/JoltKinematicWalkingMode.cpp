@@ -40,7 +40,7 @@ void UJoltKinematicWalkingMode::GenerateMove_Implementation(const FJoltMoverTick
 	FVector UpDirection = MoverComp->GetUpDirection();
 
 	// Try to use the floor as the basis for the intended move direction (i.e. try to walk along slopes, rather than into them)
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
 	{
 		MovementNormal = LastFloorResult.HitResult.ImpactNormal;
 	}
@@ -142,7 +142,7 @@ void UJoltKinematicWalkingMode::SimulationTick_Implementation(const FJoltSimulat
 	FJoltMovingComponentSet MovingComponents(MoverComp);
 	
 	// If we don't have cached floor information, we need to search for it again
-	if (!SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, CurrentFloor))
+	if (!SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, CurrentFloor))
 	{
 		UJoltFloorQueryUtils::FindFloor(MovingComponents, CommonLegacySettings->FloorSweepDistance, CommonLegacySettings->MaxWalkSlopeCosine, CommonLegacySettings->bUseFlatBaseForFloorChecks, UpdatedComponent->GetComponentLocation(), CurrentFloor);
 	}
@@ -328,7 +328,7 @@ void UJoltKinematicWalkingMode::CaptureFinalState(USceneComponent* UpdatedCompon
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, PriorBaseInfo);
+	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, PriorBaseInfo);
 
 	FJoltRelativeBaseInfo CurrentBaseInfo = UpdateFloorAndBaseInfo(FloorResult);
 
@@ -345,7 +345,7 @@ void UJoltKinematicWalkingMode::CaptureFinalState(USceneComponent* UpdatedCompon
 	
 	if (CurrentBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, CurrentBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, CurrentBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( UpdatedComponent->GetComponentLocation(),
 												  UpdatedComponent->GetComponentRotation(),
@@ -356,7 +356,7 @@ void UJoltKinematicWalkingMode::CaptureFinalState(USceneComponent* UpdatedCompon
 	}
 	else
 	{
-		SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 		OutputSyncState.SetTransforms_WorldSpace( UpdatedComponent->GetComponentLocation(),
 												  UpdatedComponent->GetComponentRotation(),
@@ -376,7 +376,7 @@ FJoltRelativeBaseInfo UJoltKinematicWalkingMode::UpdateFloorAndBaseInfo(const FJ
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+	SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 	if (FloorResult.IsWalkableFloor() && UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 	{
@@ -109,7 +109,7 @@ void UJoltPhysicsFallingMode::GenerateMove_Implementation(const FJoltMoverTickSt
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 	FJoltFloorCheckResult LastFloorResult;
 	// limit our moveinput based on the floor we're on
-	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult))
+	if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult))
 	{
 		if (LastFloorResult.HitResult.IsValidBlockingHit() && LastFloorResult.HitResult.Normal.Dot(UpDirection) > UE::JoltMoverUtils::VERTICAL_SLOPE_NORMAL_MAX_DOT && !LastFloorResult.IsWalkableFloor())
 		{
@@ -176,8 +176,8 @@ void UJoltPhysicsFallingMode::SimulationTick_Implementation(const FJoltSimulatio
 	
 	UJoltMoverBlackboard* SimBlackboard = MoverComponent->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);	// falling = no valid floor
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFloorResult);	// falling = no valid floor
+	SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 	OutputSyncState.MoveDirectionIntent = (ProposedMove.bHasDirIntent ? ProposedMove.DirectionIntent : FVector::ZeroVector);
 
@@ -235,7 +235,7 @@ void UJoltPhysicsFallingMode::SimulationTick_Implementation(const FJoltSimulatio
 
 		
 		LandingFloor.HitResult = SweepHit;
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, LandingFloor);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, LandingFloor);
 		
 		FJoltMoverOnImpactParams ImpactParams(DefaultModeNames::Falling, SweepHit, MoveDelta);
 		MoverComponent->HandleImpact(ImpactParams);
@@ -310,7 +310,7 @@ void UJoltPhysicsFallingMode::ProcessLanded(const FJoltFloorCheckResult& FloorRe
 		// Transfer to LandingMovementMode (usually walking), and cache any floor / movement base info
 		NextMovementMode = CommonLegacySettings->GroundMovementModeName;
 
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 		if (UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 		{
@@ -360,7 +360,7 @@ void UJoltPhysicsFallingMode::CaptureFinalState(const FJoltUpdatedMotionState* S
 
 	if (MovementBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
 												  FinalRotation,
@@ -58,4 +58,26 @@ void UJoltPhysicsMovementMode::OverrideAcceleration(const float Value)
 void UJoltPhysicsMovementMode::ClearAccelerationOverride()
 {
 	AccelerationOverride.Reset();
-}
\ No newline at end of file
+}
+
+FJoltContactModifierSettings UJoltPhysicsMovementMode::GetContactModifierSettings() const
+{
+	FJoltContactModifierSettings Settings;
+	
+	switch (FrictionOverrideMode)
+	{
+	case EJoltMoverFrictionOverrideMode::DoNotOverride:
+		break;
+	case EJoltMoverFrictionOverrideMode::AlwaysOverrideToZero:
+		Settings.bOverrideFriction = true;
+		break;
+	case EJoltMoverFrictionOverrideMode::OverrideToZeroWhenMoving:
+		{
+			constexpr float MinInput = 0.1f;
+			Settings.bOverrideFriction = GetMoverComponent<UJoltMoverComponent>()->GetMovementIntent().SizeSquared() > MinInput * MinInput;
+			break;
+		}
+	}
+	
+	return Settings;
+}
@@ -45,7 +45,7 @@ void UJoltPhysicsWalkingMode::GenerateMove_Implementation(const FJoltMoverTickSt
 	// Try to use the floor as the basis for the intended move direction (i.e. try to walk along slopes, rather than into them)
 	/*if (!TimeStep.bIsResimulating)
 	{
-		if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
+		if (SimBlackboard && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, LastFloorResult) && LastFloorResult.IsWalkableFloor())
 		{
 			MovementNormal = LastFloorResult.HitResult.ImpactNormal;
 		}
@@ -177,7 +177,7 @@ void UJoltPhysicsWalkingMode::SimulationTick_Implementation(const FJoltSimulatio
 	FVector UpDirection = MoverComp->GetUpDirection();
 	
 	// If we don't have cached floor information, we need to search for it again
-	/*if (!SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, CurrentFloor))
+	/*if (!SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, CurrentFloor))
 	{
 		
 	}*/
@@ -400,7 +400,7 @@ void UJoltPhysicsWalkingMode::CaptureFinalState(const FVector FinalLocation, con
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	/*UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, PriorBaseInfo);
+	const bool bHasPriorBaseInfo = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, PriorBaseInfo);
 
 	FJoltRelativeBaseInfo CurrentBaseInfo = UpdateFloorAndBaseInfo(FloorResult);*/
 
@@ -415,7 +415,7 @@ void UJoltPhysicsWalkingMode::CaptureFinalState(const FVector FinalLocation, con
 	
 	if (CurrentBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, CurrentBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, CurrentBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
                                                   FinalRotation,
@@ -425,7 +425,7 @@ void UJoltPhysicsWalkingMode::CaptureFinalState(const FVector FinalLocation, con
 	}
 	else
 	{
-		SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
 
 		
 	}*/
@@ -448,7 +448,7 @@ FJoltRelativeBaseInfo UJoltPhysicsWalkingMode::UpdateFloorAndBaseInfo(const FJol
 	const UJoltMoverComponent* MoverComp = GetMoverComponent();
 	UJoltMoverBlackboard* SimBlackboard = MoverComp->GetSimBlackboard_Mutable();
 
-	SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+	SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 	if (FloorResult.IsWalkableFloor() && UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 	{
@@ -177,7 +177,7 @@ void UJoltSimplePhysicsFallingMode::ProcessLanded(const FJoltFloorCheckResult& F
 		// Transfer to LandingMovementMode (usually walking), and cache any floor / movement base info
 		NextMovementMode = CommonLegacySettings->GroundMovementModeName;
 
-		SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFloorResult, FloorResult);
 
 		if (UJoltBasedMovementUtils::IsADynamicBase(FloorResult.HitResult.GetComponent()))
 		{
@@ -223,7 +223,7 @@ void UJoltSimplePhysicsFallingMode::CaptureFinalState(const FJoltUpdatedMotionSt
 
 	if (MovementBaseInfo.HasRelativeInfo())
 	{
-		SimBlackboard->Set(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo);
+		SimBlackboard->Set(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo);
 
 		OutputSyncState.SetTransforms_WorldSpace( FinalLocation,
 												  FinalRotation,
@@ -146,7 +146,7 @@ FBasedPosition UNavJoltMoverComponent::GetFeetLocationBased() const
 		if (const UJoltMoverBlackboard* Blackboard = MoverComponent->GetSimBlackboard())
 		{
 			FJoltRelativeBaseInfo MovementBaseInfo;
-			if (Blackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, MovementBaseInfo)) 
+			if (Blackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, MovementBaseInfo)) 
 			{
 				BasedPosition.Base = MovementBaseInfo.MovementBase->GetOwner();
 				BasedPosition.Position = MovementBaseInfo.Location;
@@ -143,7 +143,7 @@ void FJoltLayeredMoveGroup::CancelMovesByTag(FGameplayTag Tag, bool bRequireExac
 
 }
 
-TArray<TSharedPtr<FJoltLayeredMoveBase>> FJoltLayeredMoveGroup::GenerateActiveMoves(const FJoltMoverTimeStep& TimeStep, const UJoltMoverComponent* MoverComp, UJoltMoverBlackboard* SimBlackboard)
+const TArray<TSharedPtr<FJoltLayeredMoveBase>>& FJoltLayeredMoveGroup::GenerateActiveMoves(const FJoltMoverTimeStep& TimeStep, const UJoltMoverComponent* MoverComp, UJoltMoverBlackboard* SimBlackboard)
 {
 	const double SimStartTimeMs		= TimeStep.BaseSimTimeMs;
 	const double SimTimeAfterTickMs	= SimStartTimeMs + TimeStep.StepMs;
@@ -153,7 +153,7 @@ TArray<TSharedPtr<FJoltLayeredMoveBase>> FJoltLayeredMoveGroup::GenerateActiveMo
 	return ActiveLayeredMoves;
 }
 
-TArray<TSharedPtr<FJoltLayeredMoveBase>> FJoltLayeredMoveGroup::GenerateActiveMoves_Async(const FJoltMoverTimeStep& TimeStep, UJoltMoverBlackboard* SimBlackboard)
+const TArray<TSharedPtr<FJoltLayeredMoveBase>>& FJoltLayeredMoveGroup::GenerateActiveMoves_Async(const FJoltMoverTimeStep& TimeStep, UJoltMoverBlackboard* SimBlackboard)
 {
 	const double SimStartTimeMs		= TimeStep.BaseSimTimeMs;
 	const double SimTimeAfterTickMs	= SimStartTimeMs + TimeStep.StepMs;
@@ -173,66 +173,13 @@ void FJoltLayeredMoveGroup::NetSerialize(FArchive& Ar, uint8 MaxNumMovesToSerial
 }
 
 
-static void CopyLayeredMoveArray(TArray<TSharedPtr<FJoltLayeredMoveBase>>& Dest, const TArray<TSharedPtr<FJoltLayeredMoveBase>>& Src)
-{
-	bool bCanCopyInPlace = (UE::JoltMover::DisableDataCopyInPlace == 0 && Dest.Num() == Src.Num());
-	if (bCanCopyInPlace)
-	{
-		// If copy in place is enabled and the arrays are the same size, copy by index
-		for (int32 i = 0; i < Dest.Num(); ++i)
-		{
-			if (FJoltLayeredMoveBase* SrcData = Src[i].Get())
-			{
-				FJoltLayeredMoveBase* DestData = Dest[i].Get();
-				UScriptStruct* SourceStruct = SrcData->GetScriptStruct();
-
-				if (DestData && SourceStruct == DestData->GetScriptStruct())
-				{
-					// Same type so copy in place
-					SourceStruct->CopyScriptStruct(DestData, SrcData, 1);
-				}
-				else
-				{
-					// Different type so replace the shared ptr with a clone
-					Dest[i] = TSharedPtr<FJoltLayeredMoveBase>(SrcData->Clone());
-				}
-			}
-			else
-			{
-				// Found invalid source, fall back to full copy
-				bCanCopyInPlace = false;
-				break;
-			}
-		}
-	}
-	
-	if (!bCanCopyInPlace)
-	{
-		// Deep copy active moves
-		Dest.Empty(Src.Num());
-		for (int i = 0; i < Src.Num(); ++i)
-		{
-			if (Src[i].IsValid())
-			{
-				FJoltLayeredMoveBase* CopyOfSourcePtr = Src[i]->Clone();
-				Dest.Add(TSharedPtr<FJoltLayeredMoveBase>(CopyOfSourcePtr));
-			}
-			else
-			{
-				UE_LOG(LogJoltMover, Warning, TEXT("CopyLayeredMoveArray trying to copy invalid Other Layered Move"));
-			}
-		}
-	}
-}
-
-
 FJoltLayeredMoveGroup& FJoltLayeredMoveGroup::operator=(const FJoltLayeredMoveGroup& Other)
 {
 	// Perform deep copy of this Group
 	if (this != &Other)
 	{
-		CopyLayeredMoveArray(ActiveLayeredMoves, Other.ActiveLayeredMoves);
-		CopyLayeredMoveArray(QueuedLayeredMoves, Other.QueuedLayeredMoves);
+		LayeredMovePool.CopyArray(ActiveLayeredMoves, Other.ActiveLayeredMoves);
+		LayeredMovePool.CopyArray(QueuedLayeredMoves, Other.QueuedLayeredMoves);
 
 		TagCancellationRequests = Other.TagCancellationRequests;
 	}
@@ -343,6 +290,8 @@ void FJoltLayeredMoveGroup::AddStructReferencedObjects(FReferenceCollector& Coll
 			LayeredMove->AddReferencedObjects(Collector);
 		}
 	}
+
+	LayeredMovePool.AddReferencedObjects(Collector);
 }
 
 FString FJoltLayeredMoveGroup::ToSimpleString() const
@@ -417,7 +366,7 @@ void FJoltLayeredMoveGroup::FlushMoveArrays(const UJoltMoverComponent* MoverComp
 				});
 		}
 
-		TagCancellationRequests.Empty();
+		TagCancellationRequests.Reset();
 	}
 
 	
@@ -463,7 +412,7 @@ void FJoltLayeredMoveGroup::FlushMoveArrays(const UJoltMoverComponent* MoverComp
 		}
 	}
 
-	QueuedLayeredMoves.Empty();
+	QueuedLayeredMoves.Reset();
 }
 
 void FJoltLayeredMoveGroup::GatherResidualVelocitySettings(const TSharedPtr<FJoltLayeredMoveBase>& Move, bool& bResidualVelocityOverridden, bool& bClampVelocityOverridden)
@@ -649,5 +598,6 @@ void FJoltLayeredMoveGroup::Reset()
 	QueuedLayeredMoves.Empty();
 	ActiveLayeredMoves.Empty();
 	TagCancellationRequests.Empty();
+	LayeredMovePool.Empty();
 }
 
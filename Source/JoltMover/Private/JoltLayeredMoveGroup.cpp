@@ -18,18 +18,18 @@ FJoltLayeredMoveInstanceGroup& FJoltLayeredMoveInstanceGroup::operator=(const FJ
 {
 	if (this != &Other)
 	{
-		const auto DeepCopyMovesFunc = [](const TArray<TSharedPtr<FJoltLayeredMoveInstance>>& From, TArray<TSharedPtr<FJoltLayeredMoveInstance>>& To)
+		// Instances are shared between copies, so this only refreshes the pointer arrays. Reset keeps the existing
+		// allocations so repeatedly copying this group (e.g. into rollback history) does not reallocate.
+		const auto CopyMovesFunc = [](const TArray<TSharedPtr<FJoltLayeredMoveInstance>>& From, TArray<TSharedPtr<FJoltLayeredMoveInstance>>& To)
 		{
-			To.Empty(From.Num());
-			for (const TSharedPtr<FJoltLayeredMoveInstance>& Move : From)
-			{
-				To.Add(Move);
-			}
+			To.Reset(From.Num());
+			To.Append(From);
 		};
-		DeepCopyMovesFunc(Other.ActiveMoves, ActiveMoves);
-		DeepCopyMovesFunc(Other.QueuedMoves, QueuedMoves);
+		CopyMovesFunc(Other.ActiveMoves, ActiveMoves);
+		CopyMovesFunc(Other.QueuedMoves, QueuedMoves);
 
-		TagCancellationRequests = Other.TagCancellationRequests;
+		TagCancellationRequests.Reset(Other.TagCancellationRequests.Num());
+		TagCancellationRequests.Append(Other.TagCancellationRequests);
 	}
 
 	return *this;
@@ -300,7 +300,7 @@ void FJoltLayeredMoveInstanceGroup::FlushMoveArrays(const FJoltMoverTimeStep& Ti
 				});
 		}
 
-		TagCancellationRequests.Empty();
+		TagCancellationRequests.Reset();
 	}
 
 	{
@@ -337,7 +337,7 @@ void FJoltLayeredMoveInstanceGroup::FlushMoveArrays(const FJoltMoverTimeStep& Ti
 		}
 	}
 	
-	QueuedMoves.Empty();
+	QueuedMoves.Reset();
 }
 
 void FJoltLayeredMoveInstanceGroup::ProcessFinishedMove(const FJoltLayeredMoveInstance& Move, bool& bResidualVelocityOverridden, bool& bClampVelocityOverridden)
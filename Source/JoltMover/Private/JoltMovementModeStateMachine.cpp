@@ -248,9 +248,9 @@ void UJoltMovementModeStateMachine::OnSimulationTick(USceneComponent* UpdatedCom
 
 		FJoltMovementModifierGroup& CurrentModifiers = OutputState.SyncState.MovementModifiers;
 		FlushModifierCancellationsToGroup(CurrentModifiers);
-		TArray<TSharedPtr<FJoltMovementModifierBase>> ActiveModifiers = CurrentModifiers.GenerateActiveModifiers(MoverComp, SubTimeStep, WorkingSubstepStartData.SyncState, WorkingSubstepStartData.AuxState);
+		const TArray<TSharedPtr<FJoltMovementModifierBase>>& ActiveModifiers = CurrentModifiers.GenerateActiveModifiers(MoverComp, SubTimeStep, WorkingSubstepStartData.SyncState, WorkingSubstepStartData.AuxState);
 
-		for (TSharedPtr<FJoltMovementModifierBase> Modifier : ActiveModifiers)
+		for (const TSharedPtr<FJoltMovementModifierBase>& Modifier : ActiveModifiers)
 		{
 			Modifier->OnPreMovement(MoverComp, SubTimeStep);
 		}
@@ -264,14 +264,14 @@ void UJoltMovementModeStateMachine::OnSimulationTick(USceneComponent* UpdatedCom
 		bool bHasLayeredMoveContributions = false;
 		MoverComp->MovementMixer->ResetMixerState();
 		
-		TArray<TSharedPtr<FJoltLayeredMoveBase>> ActiveMoves = CurrentLayeredMoves.GenerateActiveMoves(SubTimeStep, MoverComp, SimBlackboard);
+		const TArray<TSharedPtr<FJoltLayeredMoveBase>>& ActiveMoves = CurrentLayeredMoves.GenerateActiveMoves(SubTimeStep, MoverComp, SimBlackboard);
 		CurrentActiveLayeredMoves.FlushMoveArrays(SubTimeStep, SimBlackboard);
 		bHasLayeredMoveContributions = CurrentActiveLayeredMoves.GenerateMixedMove(WorkingSubstepStartData, SubTimeStep, *MoverComp->MovementMixer, SimBlackboard, CombinedLayeredMove);
 
 		// Tick and accumulate all active moves
 		// Gather all proposed moves and distill this into a cumulative movement report. May include separate additive vs override moves.
 		// TODO: may want to sort by priority or other factors
-		for (TSharedPtr<FJoltLayeredMoveBase>& ActiveMove : ActiveMoves)
+		for (const TSharedPtr<FJoltLayeredMoveBase>& ActiveMove : ActiveMoves)
 		{
 			FJoltProposedMove MoveStep;
 			MoveStep.MixMode = ActiveMove->MixMode;	// Initialize using the move's mixmode, but allow it to be changed in GenerateMove
@@ -429,7 +429,7 @@ void UJoltMovementModeStateMachine::OnSimulationTick(USceneComponent* UpdatedCom
 		AdvanceToNextMode();
 		OutputState.SyncState.MovementMode = CurrentModeName;
 
-		for (TSharedPtr<FJoltMovementModifierBase> Modifier : ActiveModifiers)
+		for (const TSharedPtr<FJoltMovementModifierBase>& Modifier : ActiveModifiers)
 		{
 			Modifier->OnPostMovement(MoverComp, SubTimeStep, OutputState.SyncState, OutputState.AuxState);
 		}
@@ -159,79 +159,25 @@ void FJoltMovementModifierGroup::CancelModifiersByTag(FGameplayTag Tag, bool bRe
 }
 
 
-TArray<TSharedPtr<FJoltMovementModifierBase>> FJoltMovementModifierGroup::GenerateActiveModifiers(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState)
+const TArray<TSharedPtr<FJoltMovementModifierBase>>& FJoltMovementModifierGroup::GenerateActiveModifiers(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState)
 {
 	FlushModifierArrays(MoverComp, TimeStep, SyncState, AuxState);
 	return ActiveModifiers;
 }
 
-TArray<TSharedPtr<FJoltMovementModifierBase>> FJoltMovementModifierGroup::GenerateActiveModifiers_Async(const FJoltMovementModifierParams_Async& Params)
+const TArray<TSharedPtr<FJoltMovementModifierBase>>& FJoltMovementModifierGroup::GenerateActiveModifiers_Async(const FJoltMovementModifierParams_Async& Params)
 {
 	FlushModifierArrays_Async(Params);
 	return ActiveModifiers;
 }
 
-static void CopyModifierArray(TArray<TSharedPtr<FJoltMovementModifierBase>>& Dest, const TArray<TSharedPtr<FJoltMovementModifierBase>>& Src)
-{
-	bool bCanCopyInPlace = (UE::JoltMover::DisableDataCopyInPlace == 0 && Dest.Num() == Src.Num());
-	if (bCanCopyInPlace)
-	{
-		// If copy in place is enabled and the arrays are the same size, copy by index
-		for (int32 i = 0; i < Dest.Num(); ++i)
-		{
-			if (FJoltMovementModifierBase* SrcData = Src[i].Get())
-			{
-				FJoltMovementModifierBase* DestData = Dest[i].Get();
-				UScriptStruct* SourceStruct = SrcData->GetScriptStruct();
-
-				if (DestData && SourceStruct == DestData->GetScriptStruct())
-				{
-					// Same type so copy in place
-					SourceStruct->CopyScriptStruct(DestData, SrcData, 1);
-				}
-				else
-				{
-					// Different type so replace the shared ptr with a clone
-					Dest[i] = TSharedPtr<FJoltMovementModifierBase>(SrcData->Clone());
-				}
-			}
-			else
-			{
-				// Found invalid source, fall back to full copy
-				bCanCopyInPlace = false;
-				break;
-			}
-		}
-	}
-
-	if (!bCanCopyInPlace)
-	{
-		// Deep copy active modifiers
-		Dest.Empty(Src.Num());
-		for (int i = 0; i < Src.Num(); ++i)
-		{
-			if (Src[i].IsValid())
-			{
-				FJoltMovementModifierBase* CopyOfSourcePtr = Src[i]->Clone();
-				Dest.Add(TSharedPtr<FJoltMovementModifierBase>(CopyOfSourcePtr));
-			}
-			else
-			{
-				UE_LOG(LogJoltMover, Warning, TEXT("CopyModifierArray trying to copy invalid Other Modifier"));
-			}
-		}
-	}
-
-}
-
-
 FJoltMovementModifierGroup& FJoltMovementModifierGroup::operator=(const FJoltMovementModifierGroup& Other)
 {
 	// Perform deep copy of this Group
 	if (this != &Other)
 	{
-		CopyModifierArray(ActiveModifiers, Other.ActiveModifiers);
-		CopyModifierArray(QueuedModifiers, Other.QueuedModifiers);
+		ModifierPool.CopyArray(ActiveModifiers, Other.ActiveModifiers);
+		ModifierPool.CopyArray(QueuedModifiers, Other.QueuedModifiers);
 	}
 
 	return *this;
@@ -332,6 +278,8 @@ void FJoltMovementModifierGroup::AddStructReferencedObjects(FReferenceCollector&
 			Modifier->AddReferencedObjects(Collector);
 		}
 	}
+
+	ModifierPool.AddReferencedObjects(Collector);
 }
 
 FString FJoltMovementModifierGroup::ToSimpleString() const
@@ -352,7 +300,7 @@ TArray<TSharedPtr<FJoltMovementModifierBase>>::TConstIterator FJoltMovementModif
 void FJoltMovementModifierGroup::FlushModifierArrays(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState)
 {
 	// Remove any finished moves
-	ActiveModifiers.RemoveAll([MoverComp, TimeStep, SyncState, AuxState, this]
+	ActiveModifiers.RemoveAll([MoverComp, &TimeStep, &SyncState, &AuxState]
 		(const TSharedPtr<FJoltMovementModifierBase>& Modifier)
 		{
 			if (Modifier.IsValid())
@@ -396,7 +344,7 @@ void FJoltMovementModifierGroup::FlushModifierArrays(UJoltMoverComponent* MoverC
 		}
 	}
 
-	QueuedModifiers.Empty();
+	QueuedModifiers.Reset();
 }
 
 void FJoltMovementModifierGroup::FlushModifierArrays_Async(const FJoltMovementModifierParams_Async& Params)
@@ -404,7 +352,7 @@ void FJoltMovementModifierGroup::FlushModifierArrays_Async(const FJoltMovementMo
 	check(Params.TimeStep);
 
 	// Remove any finished moves
-	ActiveModifiers.RemoveAll([Params, this]
+	ActiveModifiers.RemoveAll([&Params]
 	(const TSharedPtr<FJoltMovementModifierBase>& Modifier)
 		{
 			if (Modifier.IsValid())
@@ -448,7 +396,7 @@ void FJoltMovementModifierGroup::FlushModifierArrays_Async(const FJoltMovementMo
 		}
 	}
 
-	QueuedModifiers.Empty();
+	QueuedModifiers.Reset();
 }
 
 struct FJoltMovementModifierDeleter
@@ -549,6 +497,7 @@ void FJoltMovementModifierGroup::Reset()
 {
 	QueuedModifiers.Empty();
 	ActiveModifiers.Empty();
+	ModifierPool.Empty();
 }
 
 bool FJoltMovementModifierGroup::ShouldReconcile(const FJoltMovementModifierGroup& Other) const
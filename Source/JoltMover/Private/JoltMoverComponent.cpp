@@ -25,6 +25,10 @@
 #include "UObject/ObjectSaveContext.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "MotionWarpingComponent.h"
+#include "Core/Singletons/JoltPhysicsWorldSubsystem.h"
+#include "DefaultMovementSet/Modes/Physics/JoltPhysicsMovementMode.h"
+#include "DefaultMovementSet/Modes/Physics/JoltPhysicsFallingMode.h"
+#include "DefaultMovementSet/Modes/Physics/JoltSimplePhysicsFallingMode.h"
 
 #if WITH_EDITOR
 #include "Misc/DataValidation.h"
@@ -55,6 +59,12 @@ namespace JoltMoverComponentCVars
 
 } // end JoltMoverComponentCVars
 
+namespace JoltMoverComponentPrediction
+{
+	// Mover whose gravity reads as zero on this thread, set while predicting a trajectory with bDisableGravity
+	static thread_local const UJoltMoverComponent* ZeroGravityMoverComp = nullptr;
+}
+
 
 
 namespace JoltMoverComponentConstants
@@ -262,44 +272,25 @@ void UJoltMoverComponent::PostLoad()
 
 void UJoltMoverComponent::OnModifyContacts()
 {
-	/*UPrimitiveComponent* UpdatedPrim = GetUpdatedComponent<UPrimitiveComponent>();
-	if (!UpdatedPrim) return;
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverComponent::OnModifyContacts);
+	
 	UJoltPhysicsWorldSubsystem* Subsystem = GetWorld()->GetSubsystem<UJoltPhysicsWorldSubsystem>();
-	if (!Subsystem) return;
+	if (!Subsystem || !JoltPhysicsComponent) return;
+	
+	// Friction is overridden on the mover's body only, the contact listener combines it with whatever it touches so other local bodies keep their own friction.
+	const UJoltPhysicsMovementMode* M = GetActiveMode<UJoltPhysicsMovementMode>();
+	const FJoltContactModifierSettings Settings = M ? M->GetContactModifierSettings() : FJoltContactModifierSettings();
 	
-	if (const UJoltPhysicsMovementMode* M = Cast<UJoltPhysicsMovementMode>(GetMovementMode()))
+	if (Settings.IsActive())
 	{
-		for (const FJoltHitEvent& E : Subsystem->GetAllHitEvents())
-		{
-			if (!E.SelfComp.Get() || E.SelfComp.Get() != UpdatedPrim || !E.OtherComp.Get()) continue;
-			
-			JPH::Body* SelfRb = Subsystem->GetCollisionBody(E.SelfComp.Get());
-			JPH::Body* OtherRb = Subsystem->GetCollisionBody(E.OtherComp.Get());
-			if (!SelfRb || !OtherRb) continue;	
-			
-			bool bOverrideToZero = false;
-		
-			switch (M->GetFrictionOverrideMode()) 
-			{
-			case EJoltMoverFrictionOverrideMode::DoNotOverride:
-				break;
-			case EJoltMoverFrictionOverrideMode::AlwaysOverrideToZero:
-				bOverrideToZero = true;
-				break;
-			case EJoltMoverFrictionOverrideMode::OverrideToZeroWhenMoving:
-				constexpr float MinInput = 0.1f;
-				bOverrideToZero = GetMovementIntent().SizeSquared() > MinInput* MinInput;
-				break;
-			}
-		
-			if (bOverrideToZero)
-			{
-				// Turn off friction for the contacting bodies?? But won't this affect other local bodies in our sim?
-				SelfRb->setFriction(0);
-				OtherRb->setFriction(0);
-			}
-		}
-	}*/
+		Subsystem->SetBodyContactModifier(JoltPhysicsComponent, Settings);
+		bHasActiveContactModifier = true;
+	}
+	else if (bHasActiveContactModifier)
+	{
+		Subsystem->ClearBodyContactModifier(JoltPhysicsComponent);
+		bHasActiveContactModifier = false;
+	}
 }
 
 void UJoltMoverComponent::BeginPlay()
@@ -393,10 +384,35 @@ void UJoltMoverComponent::BeginPlay()
 			PrimaryVisualComponent->SetUsingAbsoluteScale(true);
 		}
 	}
+	
+	if (UJoltPhysicsWorldSubsystem* S = GetWorld()->GetSubsystem<UJoltPhysicsWorldSubsystem>())
+	{
+		ModifyContactsHandle = S->OnModifyContacts.AddUObject(this, &UJoltMoverComponent::OnModifyContacts);
+		
+		// Movers drive their body from outside the physics state, a replayed frame can only get it right from the body's own record
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			S->AddSnapshotTrackedBody(JoltPhysicsComponent);
+		}
+	}
 }
 
 void UJoltMoverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UJoltPhysicsWorldSubsystem* S = GetWorld()->GetSubsystem<UJoltPhysicsWorldSubsystem>())
+	{
+		S->OnModifyContacts.Remove(ModifyContactsHandle);
+		if (bHasActiveContactModifier)
+		{
+			S->ClearBodyContactModifier(JoltPhysicsComponent);
+		}
+		S->RemoveTransformWriteBack(TransformWriteBackComponent.Get());
+		S->RemoveSnapshotTrackedBody(JoltPhysicsComponent);
+	}
+	ModifyContactsHandle.Reset();
+	bHasActiveContactModifier = false;
+	TransformWriteBackComponent.Reset();
+	
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -440,7 +456,12 @@ void UJoltMoverComponent::RewindStateBackToPreviousFrame(const int32 FrameDelta)
 
 	if (UJoltPhysicsWorldSubsystem* S = GetWorld()->GetSubsystem<UJoltPhysicsWorldSubsystem>())
 	{
-		S->RestoreStateForFrame(DesiredFrame);
+		const EJoltSnapshotRestoreResult Result = S->RestoreStateForFrame(DesiredFrame);
+		if (Result != EJoltSnapshotRestoreResult::Full)
+		{
+			UE_LOG(LogJoltMover, Warning, TEXT("%s could not rewind the whole physics world to frame %d, %s."), *GetNameSafe(GetOwner()), DesiredFrame,
+				Result == EJoltSnapshotRestoreResult::Partial ? TEXT("only the tracked bodies were restored") : TEXT("the frame is no longer in the history"));
+		}
 	}
 }
 
@@ -857,6 +878,16 @@ void UJoltMoverComponent::SimulationTick(const FJoltMoverTimeStep& InTimeStep, c
 	{
 		const FJoltUpdatedMotionState* OutState = SimOutput.SyncState.Collection.FindDataByType<FJoltUpdatedMotionState>();
 		if(!OutState) return;
+
+		if (bInParallelSimulationTick)
+		{
+			DeferredPhysicsWrite.LinearVelocity = OutState->GetVelocity_WorldSpace_Quantized();
+			DeferredPhysicsWrite.AngularVelocity = JoltHelpers::DegreesPerSecToRadiansPerSec(OutState->GetAngularVelocityDegrees_WorldSpace_Quantized());
+			DeferredPhysicsWrite.Orientation = OutState->GetOrientation_WorldSpace_Quantized();
+			DeferredPhysicsWrite.Position = OutState->GetLocation_WorldSpace_Quantized();
+			DeferredPhysicsWrite.bPending = true;
+			return;
+		}
 		
 		SetLinearVelocity(OutState->GetVelocity_WorldSpace_Quantized());
 		SetAngularVelocity(JoltHelpers::DegreesPerSecToRadiansPerSec(OutState->GetAngularVelocityDegrees_WorldSpace_Quantized()));
@@ -867,6 +898,70 @@ void UJoltMoverComponent::SimulationTick(const FJoltMoverTimeStep& InTimeStep, c
 	
 }
 
+bool UJoltMoverComponent::CanSimulationTickInParallel() const
+{
+	// Based movement rescheduling edits tick prerequisites, which is only safe on the game thread
+	if (!bAllowParallelSimulationTick || bSupportsKinematicBasedMovement || !ModeFSM)
+	{
+		return false;
+	}
+	
+	// Blueprint handlers are free to touch any actor, and every one of these is broadcast from inside the simulation tick
+	if (OnPreSimulationTick.IsBound() || OnPreMovement.IsBound() || OnPostMovement.IsBound() || OnPostSimulationTick.IsBound()
+		|| OnMovementModeChanged.IsBound() || OnMovementTransitionTriggered.IsBound() || OnPostSimulationRollback.IsBound())
+	{
+		return false;
+	}
+	
+	// Pending layered move registrations create their logic objects with NewObject, which is game thread only
+	if (!MovesPendingRegistration.IsEmpty())
+	{
+		return false;
+	}
+	
+	// Any registered mode may become active through a transition mid tick. Only physics modes leave the updated component alone,
+	// the others move it through TrySafeMoveUpdatedComponent, which sweeps, fires overlaps and updates attached children.
+	for (const TPair<FName, TObjectPtr<UJoltBaseMovementMode>>& Element : MovementModes)
+	{
+		if (Element.Value && !Element.Value->IsA<UJoltPhysicsMovementMode>())
+		{
+			return false;
+		}
+		
+		// Falling modes broadcast OnLanded from their tick
+		const UJoltPhysicsFallingMode* PhysicsFallingMode = Cast<UJoltPhysicsFallingMode>(Element.Value);
+		const UJoltSimplePhysicsFallingMode* SimplePhysicsFallingMode = Cast<UJoltSimplePhysicsFallingMode>(Element.Value);
+		if ((PhysicsFallingMode && PhysicsFallingMode->OnLanded.IsBound()) || (SimplePhysicsFallingMode && SimplePhysicsFallingMode->OnLanded.IsBound()))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UJoltMoverComponent::BeginParallelSimulationTick()
+{
+	bInParallelSimulationTick = true;
+	DeferredPhysicsWrite.bPending = false;
+}
+
+void UJoltMoverComponent::CommitParallelSimulationTick()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverComponent::CommitParallelSimulationTick);
+	bInParallelSimulationTick = false;
+
+	if (!DeferredPhysicsWrite.bPending)
+	{
+		return;
+	}
+
+	DeferredPhysicsWrite.bPending = false;
+	SetLinearVelocity(DeferredPhysicsWrite.LinearVelocity);
+	SetAngularVelocity(DeferredPhysicsWrite.AngularVelocity);
+	SetTargetOrientation(DeferredPhysicsWrite.Orientation);
+	SetTargetPosition(DeferredPhysicsWrite.Position);
+}
+
 void UJoltMoverComponent::PostPhysicsTick(const FJoltMoverTimeStep& TimeStep, FJoltMoverTickEndData& SimOutput)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverComponent::PostPhysicsTick);
@@ -875,15 +970,32 @@ void UJoltMoverComponent::PostPhysicsTick(const FJoltMoverTimeStep& TimeStep, FJ
 		if (!JoltPhysicsComponent && !UpdatedCompAsPrimitive) return;
 		FJoltUpdatedMotionState& FinalState = SimOutput.SyncState.Collection.FindOrAddMutableDataByType<FJoltUpdatedMotionState>();
 		
-		FTransform T;
-		FVector V, A, F;
-		Subsystem->GetPhysicsState(JoltPhysicsComponent ? JoltPhysicsComponent : UpdatedCompAsPrimitive, T, V, A, F);
-		
+		UPrimitiveComponent* BodyComponent = JoltPhysicsComponent ? JoltPhysicsComponent : UpdatedCompAsPrimitive;
 		USceneComponent* U = GetJoltPhysicsBodyComponent();
 		
 		if (!U) return;
 		
-		
+		// The subsystem moves U with the rest of the batch right after each step and keeps what it read. Until U is part of it
+		// (first tick, or a new physics component) the body is read and U moved here.
+		FTransform T;
+		FVector V, A;
+		if (TransformWriteBackComponent.Get() != U || !Subsystem->GetWriteBackState(U, T, V, A))
+		{
+			FVector F;
+			Subsystem->GetPhysicsState(BodyComponent, T, V, A, F);
+			U->SetWorldTransform(FTransform(T.GetRotation(), T.GetLocation(), UpdatedComponent->GetComponentTransform().GetScale3D()));
+			
+			if (TransformWriteBackComponent.Get() != U)
+			{
+				Subsystem->RemoveTransformWriteBack(TransformWriteBackComponent.Get());
+				const int32 ShapeId = Subsystem->FindShapeId(BodyComponent);
+				if (ShapeId != INDEX_NONE)
+				{
+					Subsystem->AddTransformWriteBack(U, JPH::BodyID(ShapeId), FTransform::Identity, /*bCenterOfMass*/true);
+					TransformWriteBackComponent = U;
+				}
+			}
+		}
 		
 		// The state's properties are usually worldspace already, but may need to be adjusted to match the current movement base
 		const FVector WorldLocation = T.GetLocation();
@@ -891,10 +1003,6 @@ void UJoltMoverComponent::PostPhysicsTick(const FJoltMoverTimeStep& TimeStep, FJ
 		
 		FTransform Transform(WorldOrientation, WorldLocation, UpdatedComponent->GetComponentTransform().GetScale3D());
 		
-		const FTransform NewTransform = U->GetComponentTransform().GetRelativeTransform(UpdatedComponent->GetComponentTransform()).Inverse() * Transform;
-		
-		U->SetWorldTransform(Transform);
-		
 		/*const FString MyRole = GetOwnerRole() == ROLE_Authority ? "Server" : "Client"; 
 		UE_LOG(LogJoltMover, Warning, TEXT("[MSL] NetMode = %s : Transform = %s"), *MyRole, *T.ToHumanReadableString());
 		UE_LOG(LogJoltMover, Warning, TEXT("[MSL] NetMode = %s : LinearVelocity = %s"), *MyRole, *V.ToCompactString());
@@ -1391,8 +1499,8 @@ void UJoltMoverComponent::UpdateBasedMovementScheduling(const FJoltMoverTickEndD
 		BasedMovementTickFunction.SetTickFunctionEnable(false);
 		MovementBaseDependency = nullptr;
 
-		SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
-		SimBlackboard->Invalidate(CommonBlackboard::LastAppliedDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastAppliedDynamicMovementBase);
 	}
 }
 
@@ -2510,6 +2618,11 @@ void UJoltMoverComponent::SetGravityOverride(bool bOverrideGravity, FVector NewG
 
 FVector UJoltMoverComponent::GetGravityAcceleration() const
 {
+	if (JoltMoverComponentPrediction::ZeroGravityMoverComp == this)
+	{
+		return FVector::ZeroVector;
+	}
+
 	if (bHasGravityOverride)
 	{
 		return GravityAccelOverride;
@@ -2596,128 +2709,113 @@ TArray<FJoltTrajectorySampleInfo> UJoltMoverComponent::GetFutureTrajectory(float
 
 TArray<FJoltTrajectorySampleInfo> UJoltMoverComponent::GetPredictedTrajectory(FJoltMoverPredictTrajectoryParams PredictionParams)
 {
-	if (ModeFSM)
-	{
-		FJoltMoverTickStartData StepState;
-
-		// Use the last-known input if none are specified.
-		if (PredictionParams.OptionalInputCmds.IsEmpty())
-		{
-			StepState.InputCmd = GetLastInputCmd();
-		}
+	FJoltMoverTickStartData StepState;
+	TArray<FJoltTrajectorySampleInfo> OutSamples;
+	PredictTrajectory(PredictionParams, StepState, OutSamples);
+	return OutSamples;
+}
 
-		// Use preferred starting sync/aux state. Fall back to last-known state if not set.
-		if (PredictionParams.OptionalStartSyncState.IsSet())
-		{
-			StepState.SyncState = PredictionParams.OptionalStartSyncState.GetValue();
-		}
-		else
-		{
-			StepState.SyncState = MoverSyncStateDoubleBuffer.GetReadable();
-		}
+void UJoltMoverComponent::PredictTrajectory(const FJoltMoverPredictTrajectoryParams& PredictionParams, FJoltMoverTickStartData& StepState, TArray<FJoltTrajectorySampleInfo>& OutSamples) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverComponent::PredictTrajectory);
 
-		if (PredictionParams.OptionalStartAuxState.IsSet())
-		{
-			StepState.AuxState = PredictionParams.OptionalStartAuxState.GetValue();
-		}
-		else
-		{
-			StepState.AuxState = CachedLastAuxState;
-		}
+	const UJoltBaseMovementMode* CurrentMovementMode = ModeFSM ? GetMovementMode() : nullptr;
+	if (!CurrentMovementMode)
+	{
+		OutSamples.Reset(PredictionParams.NumPredictionSamples);
+		OutSamples.AddDefaulted(PredictionParams.NumPredictionSamples);
+		return;
+	}
 
+	// Use the last-known input if none are specified.
+	if (PredictionParams.OptionalInputCmds.IsEmpty())
+	{
+		StepState.InputCmd = GetLastInputCmd();
+	}
 
-		FJoltMoverTimeStep FutureTimeStep;
-		FutureTimeStep.StepMs = (PredictionParams.SecondsPerSample * 1000.f);
-		FutureTimeStep.BaseSimTimeMs = CachedLastSimTickTimeStep.BaseSimTimeMs;
-		FutureTimeStep.ServerFrame = 0;
+	// Use preferred starting sync/aux state. Fall back to last-known state if not set.
+	StepState.SyncState = PredictionParams.OptionalStartSyncState.IsSet() ? PredictionParams.OptionalStartSyncState.GetValue() : MoverSyncStateDoubleBuffer.GetReadable();
+	StepState.AuxState = PredictionParams.OptionalStartAuxState.IsSet() ? PredictionParams.OptionalStartAuxState.GetValue() : CachedLastAuxState;
 
-		if (const UJoltBaseMovementMode* CurrentMovementMode = GetMovementMode())
-		{
-			if (FJoltUpdatedMotionState* StepSyncState = StepState.SyncState.Collection.FindMutableDataByType<FJoltUpdatedMotionState>())
-			{
-				const bool bOrigHasGravityOverride = bHasGravityOverride;
-				const FVector OrigGravityAccelOverride = GravityAccelOverride;
+	FJoltUpdatedMotionState* StepSyncState = StepState.SyncState.Collection.FindMutableDataByType<FJoltUpdatedMotionState>();
+	if (!StepSyncState)
+	{
+		OutSamples.Reset(PredictionParams.NumPredictionSamples);
+		OutSamples.AddDefaulted(PredictionParams.NumPredictionSamples);
+		return;
+	}
 
-				if (PredictionParams.bDisableGravity)
-				{
-					SetGravityOverride(true, FVector::ZeroVector);
-				}
+	FJoltMoverTimeStep FutureTimeStep;
+	FutureTimeStep.StepMs = (PredictionParams.SecondsPerSample * 1000.f);
+	FutureTimeStep.BaseSimTimeMs = CachedLastSimTickTimeStep.BaseSimTimeMs;
+	FutureTimeStep.ServerFrame = 0;
 
-				TArray<FJoltTrajectorySampleInfo> OutSamples;
-				OutSamples.SetNumUninitialized(PredictionParams.NumPredictionSamples);
+	// Gravity is suppressed for this thread only, rather than by toggling the component's gravity override
+	TGuardValue<const UJoltMoverComponent*> ZeroGravityGuard(JoltMoverComponentPrediction::ZeroGravityMoverComp, PredictionParams.bDisableGravity ? this : JoltMoverComponentPrediction::ZeroGravityMoverComp);
 
-				FVector PriorLocation = StepSyncState->GetLocation_WorldSpace();
-				FRotator PriorOrientation = StepSyncState->GetOrientation_WorldSpace();
-				FVector PriorVelocity = StepSyncState->GetVelocity_WorldSpace();
+	OutSamples.SetNumUninitialized(PredictionParams.NumPredictionSamples, EAllowShrinking::No);
 
-				for (int32 i = 0; i < PredictionParams.NumPredictionSamples; ++i)
-				{
-					// If no further inputs are specified, the previous input cmd will continue to be used
-					if (i < PredictionParams.OptionalInputCmds.Num())
-					{
-						StepState.InputCmd = PredictionParams.OptionalInputCmds[i];
-					}
+	FRotator PriorOrientation = StepSyncState->GetOrientation_WorldSpace();
+	FVector PriorVelocity = StepSyncState->GetVelocity_WorldSpace();
 
-					// Capture sample from current step state
-					FJoltTrajectorySampleInfo& Sample = OutSamples[i];
+	for (int32 i = 0; i < PredictionParams.NumPredictionSamples; ++i)
+	{
+		// If no further inputs are specified, the previous input cmd will continue to be used
+		if (i < PredictionParams.OptionalInputCmds.Num())
+		{
+			StepState.InputCmd = PredictionParams.OptionalInputCmds[i];
+		}
 
-					Sample.Transform.SetTranslationAndScale3D(StepSyncState->GetLocation_WorldSpace(), FVector::OneVector);
-					Sample.Transform.SetRotation(StepSyncState->GetOrientation_WorldSpace().Quaternion());
-					Sample.LinearVelocity = StepSyncState->GetVelocity_WorldSpace();
-					Sample.InstantaneousAcceleration = (StepSyncState->GetVelocity_WorldSpace() - PriorVelocity) / PredictionParams.SecondsPerSample;
-					Sample.AngularVelocity = (StepSyncState->GetOrientation_WorldSpace() - PriorOrientation) * (1.f / PredictionParams.SecondsPerSample);
+		// Capture sample from current step state
+		FJoltTrajectorySampleInfo& Sample = OutSamples[i];
 
-					Sample.SimTimeMs = FutureTimeStep.BaseSimTimeMs;
+		Sample.Transform.SetTranslationAndScale3D(StepSyncState->GetLocation_WorldSpace(), FVector::OneVector);
+		Sample.Transform.SetRotation(StepSyncState->GetOrientation_WorldSpace().Quaternion());
+		Sample.LinearVelocity = StepSyncState->GetVelocity_WorldSpace();
+		Sample.InstantaneousAcceleration = (StepSyncState->GetVelocity_WorldSpace() - PriorVelocity) / PredictionParams.SecondsPerSample;
+		Sample.AngularVelocity = (StepSyncState->GetOrientation_WorldSpace() - PriorOrientation) * (1.f / PredictionParams.SecondsPerSample);
 
-					// Cache prior values
-					PriorLocation = StepSyncState->GetLocation_WorldSpace();
-					PriorOrientation = StepSyncState->GetOrientation_WorldSpace();
-					PriorVelocity = StepSyncState->GetVelocity_WorldSpace();
+		Sample.SimTimeMs = FutureTimeStep.BaseSimTimeMs;
 
-					// Generate next move from current step state
-					FJoltProposedMove StepMove;
-					CurrentMovementMode->GenerateMove(StepState, FutureTimeStep, StepMove);
+		// Cache prior values
+		PriorOrientation = StepSyncState->GetOrientation_WorldSpace();
+		PriorVelocity = StepSyncState->GetVelocity_WorldSpace();
 
-					// Advance state based on move
-					StepSyncState->SetTransforms_WorldSpace(StepSyncState->GetLocation_WorldSpace() + (StepMove.LinearVelocity * PredictionParams.SecondsPerSample),
-						UJoltMovementUtils::ApplyAngularVelocityToRotator(StepSyncState->GetOrientation_WorldSpace(),StepMove.AngularVelocityDegrees, PredictionParams.SecondsPerSample),
-						StepMove.LinearVelocity,
-						StepMove.AngularVelocityDegrees,
-						StepSyncState->GetMovementBase(),
-						StepSyncState->GetMovementBaseBoneName());
+		// Generate next move from current step state
+		FJoltProposedMove StepMove;
+		CurrentMovementMode->GenerateMove(StepState, FutureTimeStep, StepMove);
 
-					FutureTimeStep.BaseSimTimeMs += FutureTimeStep.StepMs;
-					++FutureTimeStep.ServerFrame;
-				}
+		// Advance state based on move
+		StepSyncState->SetTransforms_WorldSpace(StepSyncState->GetLocation_WorldSpace() + (StepMove.LinearVelocity * PredictionParams.SecondsPerSample),
+			UJoltMovementUtils::ApplyAngularVelocityToRotator(StepSyncState->GetOrientation_WorldSpace(),StepMove.AngularVelocityDegrees, PredictionParams.SecondsPerSample),
+			StepMove.LinearVelocity,
+			StepMove.AngularVelocityDegrees,
+			StepSyncState->GetMovementBase(),
+			StepSyncState->GetMovementBaseBoneName());
 
-				// Put sample locations at visual root location if requested
-				if (PredictionParams.bUseVisualComponentRoot)
-				{
-					if (const USceneComponent* VisualComp = GetPrimaryVisualComponent())
-					{
-						const FVector VisualCompOffset = VisualComp->GetRelativeLocation();
-						const FTransform VisualCompRelativeTransform = VisualComp->GetRelativeTransform();
+		FutureTimeStep.BaseSimTimeMs += FutureTimeStep.StepMs;
+		++FutureTimeStep.ServerFrame;
+	}
 
-						for (int32 i=0; i < PredictionParams.NumPredictionSamples; ++i)
-						{
-							OutSamples[i].Transform = VisualCompRelativeTransform * OutSamples[i].Transform;
-						}
-					}
-				}
-				
-				if (PredictionParams.bDisableGravity)
-				{
-					SetGravityOverride(bOrigHasGravityOverride, OrigGravityAccelOverride);
-				}
+	// Put sample locations at visual root location if requested
+	if (PredictionParams.bUseVisualComponentRoot)
+	{
+		if (const USceneComponent* VisualComp = GetPrimaryVisualComponent())
+		{
+			const FTransform VisualCompRelativeTransform = VisualComp->GetRelativeTransform();
 
-				return OutSamples;
+			for (int32 i=0; i < PredictionParams.NumPredictionSamples; ++i)
+			{
+				OutSamples[i].Transform = VisualCompRelativeTransform * OutSamples[i].Transform;
 			}
 		}
 	}
+}
 
-	TArray<FJoltTrajectorySampleInfo> BlankDefaultSamples;
-	BlankDefaultSamples.AddDefaulted(PredictionParams.NumPredictionSamples);
-	return BlankDefaultSamples;
+bool UJoltMoverComponent::CanPredictTrajectoryInParallel() const
+{
+	const UJoltBaseMovementMode* CurrentMovementMode = ModeFSM ? GetMovementMode() : nullptr;
+	return CurrentMovementMode && CurrentMovementMode->GetClass()->HasAnyClassFlags(CLASS_Native);
 }
 
 
@@ -2764,7 +2862,7 @@ const FJoltMoverSyncState& UJoltMoverComponent::GetSyncState() const
 bool UJoltMoverComponent::TryGetFloorCheckHitResult(FHitResult& OutHitResult) const
 {
 	FJoltFloorCheckResult FloorCheck;
-	if (SimBlackboard != nullptr && SimBlackboard->TryGet(CommonBlackboard::LastFloorResult, FloorCheck))
+	if (SimBlackboard != nullptr && SimBlackboard->TryGet(CommonBlackboard::Keys::LastFloorResult, FloorCheck))
 	{
 		OutHitResult = FloorCheck.HitResult;
 		return true;
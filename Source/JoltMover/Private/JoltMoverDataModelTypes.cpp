@@ -5,6 +5,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "MoveLibrary/JoltBasedMovementUtils.h"
 #include "JoltMoverLog.h"
+#include "JoltNetworkPredictionRelevancy.h"
 
 
 
@@ -172,11 +173,32 @@ bool FJoltUpdatedMotionState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool&
 {
 	Super::NetSerialize(Ar, Map, bOutSuccess);
 
-	SerializePackedVector<100, 30>(Location, Ar);
-	SerializeFixedVector<2, 8>(MoveDirectionIntent, Ar);
-	SerializePackedVector<10, 16>(Velocity, Ar);
-	SerializePackedVector<10, 16>(AngularVelocityDegrees, Ar);
-	Orientation.SerializeCompressedShort(Ar);
+	// Far away simulated proxies may be sent coarser, see FJoltSimProxyRelevancy. Both ends see the same precision.
+	const EJoltNetPrecision Precision = JoltNetPrecision::Get();
+	switch (Precision)
+	{
+	case EJoltNetPrecision::Full:
+		SerializePackedVector<100, 30>(Location, Ar);
+		SerializeFixedVector<2, 8>(MoveDirectionIntent, Ar);
+		SerializePackedVector<10, 16>(Velocity, Ar);
+		SerializePackedVector<10, 16>(AngularVelocityDegrees, Ar);
+		Orientation.SerializeCompressedShort(Ar);
+		break;
+	case EJoltNetPrecision::Medium:
+		SerializePackedVector<10, 27>(Location, Ar);
+		SerializeFixedVector<2, 8>(MoveDirectionIntent, Ar);
+		SerializePackedVector<1, 16>(Velocity, Ar);
+		SerializePackedVector<1, 16>(AngularVelocityDegrees, Ar);
+		Orientation.SerializeCompressedShort(Ar);
+		break;
+	default:
+		SerializePackedVector<1, 24>(Location, Ar);
+		SerializeFixedVector<2, 6>(MoveDirectionIntent, Ar);
+		SerializePackedVector<1, 16>(Velocity, Ar);
+		SerializePackedVector<1, 12>(AngularVelocityDegrees, Ar);
+		Orientation.SerializeCompressed(Ar);
+		break;
+	}
 	
 
 	// Optional movement base
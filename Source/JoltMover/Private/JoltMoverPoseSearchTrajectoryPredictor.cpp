@@ -4,6 +4,8 @@
  #include "Animation/TrajectoryTypes.h"
  #include "JoltMoverComponent.h"
  #include "MoveLibrary/JoltMovementUtils.h"
+ #include "JoltMoverTrajectorySubsystem.h"
+ #include "Engine/World.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltMoverPoseSearchTrajectoryPredictor)
  
@@ -33,7 +35,16 @@ void UJoltMoverTrajectoryPredictor::Predict(UJoltMoverComponent& MoverComponent,
 	PredictParams.bDisableGravity = true;
 
 	// IMPORTANT! The first sample returned is actually the current state
-	TArray<FJoltTrajectorySampleInfo> MoverPredictionSamples = MoverComponent.GetPredictedTrajectory(PredictParams);
+	// Go through the trajectory subsystem when possible, so every animated mover is predicted in one parallel batch per frame
+	TArray<FJoltTrajectorySampleInfo> MoverPredictionSamples;
+	if (UJoltMoverTrajectorySubsystem* TrajectorySubsystem = UWorld::GetSubsystem<UJoltMoverTrajectorySubsystem>(MoverComponent.GetWorld()))
+	{
+		TrajectorySubsystem->GetPredictedTrajectory(MoverComponent, PredictParams, MoverPredictionSamples);
+	}
+	else
+	{
+		MoverPredictionSamples = MoverComponent.GetPredictedTrajectory(PredictParams);
+	}
 
 	if (InOutTrajectory.Samples.Num() < (NumHistorySamples + NumPredictionSamples))
 	{
@@ -8,6 +8,15 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltMoverSimulationTypes)
 
+namespace CommonBlackboard::Keys
+{
+	const FJoltMoverBlackboardKey LastFloorResult(CommonBlackboard::LastFloorResult);
+	const FJoltMoverBlackboardKey LastWaterResult(CommonBlackboard::LastWaterResult);
+	const FJoltMoverBlackboardKey LastFoundDynamicMovementBase(CommonBlackboard::LastFoundDynamicMovementBase);
+	const FJoltMoverBlackboardKey LastAppliedDynamicMovementBase(CommonBlackboard::LastAppliedDynamicMovementBase);
+	const FJoltMoverBlackboardKey TimeSinceSupported(CommonBlackboard::TimeSinceSupported);
+}
+
 UScriptStruct* FJoltMoverSimulationEventData::GetScriptStruct() const
 {
 	checkf(false, TEXT("%hs is being called erroneously. This must be overridden in derived types!"), __FUNCTION__);
@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JoltMoverTrajectorySubsystem.h"
+#include "JoltMoverComponent.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(JoltMoverTrajectorySubsystem)
+
+namespace UE::JoltMover::Trajectory
+{
+	static int32 EnableFrameCache = 1;
+	FAutoConsoleVariableRef CVarEnableFrameCache(
+		TEXT("jolt.mover.trajectory.EnableFrameCache"),
+		EnableFrameCache,
+		TEXT("If != 0, trajectories requested through UJoltMoverTrajectorySubsystem are cached for the rest of the frame and re-predicted in one batch next frame."));
+
+	static int32 EnableParallel = 1;
+	FAutoConsoleVariableRef CVarEnableParallel(
+		TEXT("jolt.mover.trajectory.Parallel"),
+		EnableParallel,
+		TEXT("If != 0, batched trajectory predictions for movers with native movement modes run across task threads."));
+
+	static int32 ParallelMinBatchSize = 4;
+	FAutoConsoleVariableRef CVarParallelMinBatchSize(
+		TEXT("jolt.mover.trajectory.Parallel.MinBatchSize"),
+		ParallelMinBatchSize,
+		TEXT("Minimum number of trajectories each task predicts when running in parallel."));
+
+	// Movers that haven't asked for a trajectory within this many frames are dropped from the batch
+	static constexpr uint64 MaxIdleFrames = 2;
+}
+
+void UJoltMoverTrajectorySubsystem::PredictTrajectories(TConstArrayView<FJoltMoverTrajectoryRequest> Requests, TArray<TArray<FJoltTrajectorySampleInfo>>& OutTrajectories)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverTrajectorySubsystem::PredictTrajectories);
+
+	FScopeLock Lock(&BatchLock);
+
+	RequestEntries.SetNum(Requests.Num(), EAllowShrinking::No);
+	ParallelEntries.Reset(Requests.Num());
+	for (int32 i = 0; i < Requests.Num(); ++i)
+	{
+		FCachedTrajectory& Entry = RequestEntries[i];
+		Entry.MoverComp = Requests[i].MoverComp;
+		Entry.Params = Requests[i].Params;
+		ParallelEntries.Add(&Entry);
+	}
+
+	PredictBatch(ParallelEntries);
+
+	OutTrajectories.SetNum(Requests.Num(), EAllowShrinking::No);
+	for (int32 i = 0; i < Requests.Num(); ++i)
+	{
+		Swap(OutTrajectories[i], RequestEntries[i].Samples);
+	}
+}
+
+void UJoltMoverTrajectorySubsystem::GetPredictedTrajectory(const UJoltMoverComponent& MoverComp, const FJoltMoverPredictTrajectoryParams& Params, TArray<FJoltTrajectorySampleInfo>& OutSamples)
+{
+	if (!UE::JoltMover::Trajectory::EnableFrameCache || !IsCacheable(Params))
+	{
+		FJoltMoverTickStartData StepState;
+		MoverComp.PredictTrajectory(Params, StepState, OutSamples);
+		return;
+	}
+
+	const uint64 FrameNumber = GFrameCounter;
+	const TObjectKey<UJoltMoverComponent> MoverKey(&MoverComp);
+
+	bool bRefreshCache = false;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (LastRefreshFrame != FrameNumber)
+		{
+			LastRefreshFrame = FrameNumber;
+			bRefreshCache = true;
+		}
+	}
+
+	if (bRefreshCache)
+	{
+		FScopeLock Lock(&BatchLock);
+		RefreshCache(FrameNumber);
+	}
+
+	{
+		FScopeLock Lock(&CacheLock);
+
+		FCachedTrajectory& Entry = Cache.FindOrAdd(MoverKey);
+		Entry.LastRequestedFrame = FrameNumber;
+
+		if (Entry.PredictedFrame == FrameNumber && HasSameSettings(Entry.Params, Params))
+		{
+			OutSamples = Entry.Samples;
+			return;
+		}
+	}
+
+	// First request for this mover, or a different sampling setup than last time. Predict it alone, the next frame's batch picks it up.
+	FJoltMoverTickStartData StepState;
+	MoverComp.PredictTrajectory(Params, StepState, OutSamples);
+
+	FScopeLock Lock(&CacheLock);
+
+	FCachedTrajectory& Entry = Cache.FindOrAdd(MoverKey);
+	if (Entry.PredictedFrame == FrameNumber && HasSameSettings(Entry.Params, Params))
+	{
+		// Another caller got there first, keep its samples so everyone sees the same trajectory this frame
+		OutSamples = Entry.Samples;
+		return;
+	}
+
+	Entry.MoverComp = &MoverComp;
+	Entry.Params = Params;
+	Entry.Samples = OutSamples;
+	Entry.PredictedFrame = FrameNumber;
+	Entry.LastRequestedFrame = FrameNumber;
+}
+
+void UJoltMoverTrajectorySubsystem::Deinitialize()
+{
+	{
+		FScopeLock BatchScopeLock(&BatchLock);
+		FScopeLock CacheScopeLock(&CacheLock);
+		Cache.Empty();
+		WorkerScratchStates.Empty();
+		ParallelEntries.Empty();
+		RequestEntries.Empty();
+		RefreshKeys.Empty();
+	}
+
+	Super::Deinitialize();
+}
+
+void UJoltMoverTrajectorySubsystem::RefreshCache(uint64 FrameNumber)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverTrajectorySubsystem::RefreshCache);
+
+	// Copy out what to predict, so the batch runs without holding CacheLock. Entries keep their sample arrays across batches.
+	int32 NumEntries = 0;
+	{
+		FScopeLock Lock(&CacheLock);
+
+		RefreshKeys.Reset(Cache.Num());
+		for (auto It = Cache.CreateIterator(); It; ++It)
+		{
+			FCachedTrajectory& Entry = It.Value();
+			if (!Entry.MoverComp.IsValid() || FrameNumber - Entry.LastRequestedFrame > UE::JoltMover::Trajectory::MaxIdleFrames)
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			if (RequestEntries.Num() <= NumEntries)
+			{
+				RequestEntries.AddDefaulted();
+			}
+			FCachedTrajectory& BatchEntry = RequestEntries[NumEntries++];
+			BatchEntry.MoverComp = Entry.MoverComp;
+			BatchEntry.Params = Entry.Params;
+			RefreshKeys.Add(It.Key());
+		}
+	}
+
+	RequestEntries.SetNum(NumEntries, EAllowShrinking::No);
+	ParallelEntries.Reset(NumEntries);
+	for (FCachedTrajectory& BatchEntry : RequestEntries)
+	{
+		ParallelEntries.Add(&BatchEntry);
+	}
+
+	PredictBatch(ParallelEntries);
+
+	FScopeLock Lock(&CacheLock);
+
+	for (int32 i = 0; i < NumEntries; ++i)
+	{
+		// Skip movers that were predicted alone while the batch ran, or whose settings changed since
+		FCachedTrajectory* Entry = Cache.Find(RefreshKeys[i]);
+		if (Entry && Entry->PredictedFrame != FrameNumber && HasSameSettings(Entry->Params, RequestEntries[i].Params))
+		{
+			Swap(Entry->Samples, RequestEntries[i].Samples);
+			Entry->PredictedFrame = FrameNumber;
+		}
+	}
+}
+
+void UJoltMoverTrajectorySubsystem::PredictBatch(TArrayView<FCachedTrajectory*> Entries)
+{
+	// Partition so that movers whose mode can only run on this thread are at the back
+	int32 NumParallel = 0;
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const UJoltMoverComponent* MoverComp = Entries[i]->MoverComp.Get();
+		if (MoverComp && MoverComp->CanPredictTrajectoryInParallel())
+		{
+			Swap(Entries[i], Entries[NumParallel++]);
+		}
+	}
+
+	const bool bParallel = UE::JoltMover::Trajectory::EnableParallel != 0;
+	const int32 MinBatchSize = FMath::Max(1, UE::JoltMover::Trajectory::ParallelMinBatchSize);
+	const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	WorkerScratchStates.SetNum(FMath::Max(1, ParallelForImpl::GetNumberOfThreadTasks(NumParallel, MinBatchSize, Flags)), EAllowShrinking::No);
+
+	ParallelForWithExistingTaskContext(TArrayView<FJoltMoverTickStartData>(WorkerScratchStates), NumParallel, MinBatchSize,
+		[&Entries](FJoltMoverTickStartData& ScratchState, int32 Index)
+		{
+			FCachedTrajectory& Entry = *Entries[Index];
+			Entry.MoverComp->PredictTrajectory(Entry.Params, ScratchState, Entry.Samples);
+		},
+		Flags);
+
+	for (int32 i = NumParallel; i < Entries.Num(); ++i)
+	{
+		FCachedTrajectory& Entry = *Entries[i];
+		if (const UJoltMoverComponent* MoverComp = Entry.MoverComp.Get())
+		{
+			MoverComp->PredictTrajectory(Entry.Params, WorkerScratchStates[0], Entry.Samples);
+		}
+		else
+		{
+			Entry.Samples.Reset(Entry.Params.NumPredictionSamples);
+			Entry.Samples.AddDefaulted(Entry.Params.NumPredictionSamples);
+		}
+	}
+}
+
+bool UJoltMoverTrajectorySubsystem::IsCacheable(const FJoltMoverPredictTrajectoryParams& Params)
+{
+	return !Params.OptionalStartSyncState.IsSet() && !Params.OptionalStartAuxState.IsSet() && Params.OptionalInputCmds.IsEmpty();
+}
+
+bool UJoltMoverTrajectorySubsystem::HasSameSettings(const FJoltMoverPredictTrajectoryParams& A, const FJoltMoverPredictTrajectoryParams& B)
+{
+	return A.NumPredictionSamples == B.NumPredictionSamples
+		&& A.SecondsPerSample == B.SecondsPerSample
+		&& A.bUseVisualComponentRoot == B.bUseVisualComponentRoot
+		&& A.bDisableGravity == B.bDisableGravity;
+}
@@ -342,8 +342,8 @@ void UJoltBasedMovementUtils::UpdateSimpleBasedMovement(UJoltMoverComponent* Tar
 	FJoltRelativeBaseInfo LastAppliedBaseInfo;	// Last-applied is the one that our based movement is up to date with, likely set in the last sim frame
 	FJoltRelativeBaseInfo CurrentBaseInfo;		// Current info is the current snapshot of the current base, with up-to-date transform that may be different than last-found.
 
-	const bool bHasLastFoundInfo = SimBlackboard->TryGet(CommonBlackboard::LastFoundDynamicMovementBase, LastFoundBaseInfo);
-	const bool bHasLastAppliedInfo = SimBlackboard->TryGet(CommonBlackboard::LastAppliedDynamicMovementBase, LastAppliedBaseInfo);
+	const bool bHasLastFoundInfo = SimBlackboard->TryGet(CommonBlackboard::Keys::LastFoundDynamicMovementBase, LastFoundBaseInfo);
+	const bool bHasLastAppliedInfo = SimBlackboard->TryGet(CommonBlackboard::Keys::LastAppliedDynamicMovementBase, LastAppliedBaseInfo);
 	if (bHasLastFoundInfo)
 	{
 		if (!bHasLastAppliedInfo || !LastFoundBaseInfo.UsesSameBase(LastAppliedBaseInfo))
@@ -354,8 +354,8 @@ void UJoltBasedMovementUtils::UpdateSimpleBasedMovement(UJoltMoverComponent* Tar
 		if (!ensureMsgf(LastFoundBaseInfo.HasRelativeInfo() && LastFoundBaseInfo.UsesSameBase(LastAppliedBaseInfo),
 				TEXT("Attempting to update based movement with a missing or mismatched base. This may indicate a logic problem with detecting bases.")))
 		{ 
-			SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
-			SimBlackboard->Invalidate(CommonBlackboard::LastAppliedDynamicMovementBase);
+			SimBlackboard->Invalidate(CommonBlackboard::Keys::LastFoundDynamicMovementBase);
+			SimBlackboard->Invalidate(CommonBlackboard::Keys::LastAppliedDynamicMovementBase);
 			return;
 		}
 
@@ -499,14 +499,14 @@ void UJoltBasedMovementUtils::UpdateSimpleBasedMovement(UJoltMoverComponent* Tar
 				}
 			}
 
-			SimBlackboard->Set(CommonBlackboard::LastAppliedDynamicMovementBase, CurrentBaseInfo);
+			SimBlackboard->Set(CommonBlackboard::Keys::LastAppliedDynamicMovementBase, CurrentBaseInfo);
 			bDidGetUpToDate = true;
 		}
 	}
 
 	if (!bDidGetUpToDate)
 	{
-		SimBlackboard->Invalidate(CommonBlackboard::LastAppliedDynamicMovementBase);
+		SimBlackboard->Invalidate(CommonBlackboard::Keys::LastAppliedDynamicMovementBase);
 	}
 }
 
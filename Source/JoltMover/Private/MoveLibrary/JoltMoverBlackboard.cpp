@@ -7,10 +7,57 @@
 
 
 
-void UJoltMoverBlackboard::Invalidate(FName ObjName)
+namespace JoltMoverBlackboardPrivate
 {
-	UE::TWriteScopeLock Lock(ObjectsMapLock);
-	ObjectsByName.Remove(ObjName);
+	// Process-wide FName -> dense index registry shared by all blackboards
+	struct FKeyRegistry
+	{
+		FTransactionallySafeRWLock Lock;
+		TMap<FName, int32> IndexByName;
+	};
+
+	static FKeyRegistry& GetKeyRegistry()
+	{
+		static FKeyRegistry Registry;
+		return Registry;
+	}
+}
+
+FJoltMoverBlackboardKey::FJoltMoverBlackboardKey(FName InName)
+	: Name(InName)
+{
+	JoltMoverBlackboardPrivate::FKeyRegistry& Registry = JoltMoverBlackboardPrivate::GetKeyRegistry();
+
+	{
+		UE::TReadScopeLock Lock(Registry.Lock);
+		if (const int32* ExistingIndex = Registry.IndexByName.Find(InName))
+		{
+			Index = *ExistingIndex;
+			return;
+		}
+	}
+
+	UE::TWriteScopeLock Lock(Registry.Lock);
+	Index = Registry.IndexByName.FindOrAdd(InName, Registry.IndexByName.Num());
+}
+
+FJoltMoverBlackboardKey FJoltMoverBlackboardKey::Find(FName InName)
+{
+	JoltMoverBlackboardPrivate::FKeyRegistry& Registry = JoltMoverBlackboardPrivate::GetKeyRegistry();
+
+	UE::TReadScopeLock Lock(Registry.Lock);
+	const int32* ExistingIndex = Registry.IndexByName.Find(InName);
+	return FJoltMoverBlackboardKey(InName, ExistingIndex ? *ExistingIndex : INDEX_NONE);
+}
+
+
+void UJoltMoverBlackboard::Invalidate(const FJoltMoverBlackboardKey& ObjKey)
+{
+	UE::TWriteScopeLock Lock(ObjectsLock);
+	if (Slots.IsValidIndex(ObjKey.GetIndex()))
+	{
+		Slots[ObjKey.GetIndex()].bIsSet = false;
+	}
 }
 
 void UJoltMoverBlackboard::Invalidate(EJoltInvalidationReason Reason)
@@ -20,8 +67,11 @@ void UJoltMoverBlackboard::Invalidate(EJoltInvalidationReason Reason)
 		default:
 		case EJoltInvalidationReason::FullReset:
 		{
-			UE::TWriteScopeLock Lock(ObjectsMapLock);
-			ObjectsByName.Empty();
+			UE::TWriteScopeLock Lock(ObjectsLock);
+			for (BlackboardSlot& Slot : Slots)
+			{
+				Slot.bIsSet = false;
+			}
 		}
 		break;
 
@@ -31,6 +81,9 @@ void UJoltMoverBlackboard::Invalidate(EJoltInvalidationReason Reason)
 
 void UJoltMoverBlackboard::BeginDestroy()
 {
-	InvalidateAll();
+	{
+		UE::TWriteScopeLock Lock(ObjectsLock);
+		Slots.Empty();
+	}
 	Super::BeginDestroy();
 }
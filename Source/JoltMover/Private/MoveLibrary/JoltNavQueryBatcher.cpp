@@ -0,0 +1,291 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MoveLibrary/JoltNavQueryBatcher.h"
+#include "AI/Navigation/NavigationDataInterface.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(JoltNavQueryBatcher)
+
+namespace UE::JoltMover::NavQueryBatcher
+{
+	static int32 Enable = 1;
+	FAutoConsoleVariableRef CVarEnable(
+		TEXT("jolt.mover.nav.BatchQueries"),
+		Enable,
+		TEXT("If != 0, nav walking modes prefetch next tick's navmesh queries and run them as one parallel batch sorted by navmesh tile."));
+
+	static int32 ParallelMinBatchSize = 8;
+	FAutoConsoleVariableRef CVarParallelMinBatchSize(
+		TEXT("jolt.mover.nav.BatchQueries.MinBatchSize"),
+		ParallelMinBatchSize,
+		TEXT("Minimum number of prefetched navmesh queries each task runs. Batches smaller than this run on the calling thread."));
+
+	static float Tolerance = 0.f;
+	FAutoConsoleVariableRef CVarTolerance(
+		TEXT("jolt.mover.nav.BatchQueries.Tolerance"),
+		Tolerance,
+		TEXT("Grid size, in cm, on which a query's locations are matched against the prefetched ones. 0 (default) only reuses results of the identical query. ")
+		TEXT("Anything else can return results computed from different inputs, which makes networked nav movement depend on batch timing."));
+}
+
+TRACE_DECLARE_INT_COUNTER(JoltMoverNavQueriesIssued, TEXT("JoltMover/Nav/QueriesIssued"));
+TRACE_DECLARE_INT_COUNTER(JoltMoverNavQueriesPrefetched, TEXT("JoltMover/Nav/QueriesPrefetched"));
+TRACE_DECLARE_INT_COUNTER(JoltMoverNavCacheHits, TEXT("JoltMover/Nav/CacheHits"));
+
+UJoltMoverNavQueryBatcher::FQueryKey::FQueryKey(const FQuery& Query)
+	: NavData(Query.NavData)
+	, Type(Query.Type)
+	, StartNodeRef(Query.StartNodeRef)
+	, Start(Query.Start.GridSnap(FMath::Max(UE::JoltMover::NavQueryBatcher::Tolerance, 0.f)))
+	, TargetOrExtent(Query.TargetOrExtent.GridSnap(FMath::Max(UE::JoltMover::NavQueryBatcher::Tolerance, 0.f)))
+{
+}
+
+UJoltMoverNavQueryBatcher* UJoltMoverNavQueryBatcher::Get(const UObject* WorldContextObject)
+{
+	if (!UE::JoltMover::NavQueryBatcher::Enable || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UJoltMoverNavQueryBatcher>() : nullptr;
+}
+
+void UJoltMoverNavQueryBatcher::BeginSimTick(double SimTimeMs)
+{
+	RunPendingQueries(SimTimeMs);
+}
+
+bool UJoltMoverNavQueryBatcher::ProjectPoint(const INavigationDataInterface* NavData, const FVector& Location, const FVector& Extent, FNavLocation& OutLocation)
+{
+	FQuery Query;
+	Query.NavData = NavData;
+	Query.Type = EQueryType::ProjectPoint;
+	Query.Start = Location;
+	Query.TargetOrExtent = Extent;
+
+	return FindOrRunQuery(Query, OutLocation);
+}
+
+bool UJoltMoverNavQueryBatcher::FindMoveAlongSurface(const INavigationDataInterface* NavData, const FNavLocation& StartLocation, const FVector& TargetLocation, FNavLocation& OutLocation)
+{
+	FQuery Query;
+	Query.NavData = NavData;
+	Query.Type = EQueryType::MoveAlongSurface;
+	Query.StartNodeRef = StartLocation.NodeRef;
+	Query.Start = StartLocation.Location;
+	Query.TargetOrExtent = TargetLocation;
+
+	return FindOrRunQuery(Query, OutLocation);
+}
+
+void UJoltMoverNavQueryBatcher::PrefetchProjectPoint(double SimTimeMs, const INavigationDataInterface* NavData, const FVector& Location, const FVector& Extent)
+{
+	FQuery Query;
+	Query.NavData = NavData;
+	Query.Type = EQueryType::ProjectPoint;
+	Query.Start = Location;
+	Query.TargetOrExtent = Extent;
+
+	Prefetch(SimTimeMs, Query);
+}
+
+void UJoltMoverNavQueryBatcher::PrefetchMoveAlongSurface(double SimTimeMs, const INavigationDataInterface* NavData, const FNavLocation& StartLocation, const FVector& TargetLocation)
+{
+	FQuery Query;
+	Query.NavData = NavData;
+	Query.Type = EQueryType::MoveAlongSurface;
+	Query.StartNodeRef = StartLocation.NodeRef;
+	Query.Start = StartLocation.Location;
+	Query.TargetOrExtent = TargetLocation;
+
+	Prefetch(SimTimeMs, Query);
+}
+
+FJoltNavQueryStats UJoltMoverNavQueryBatcher::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+void UJoltMoverNavQueryBatcher::ResetStats()
+{
+	FScopeLock ScopeLock(&Lock);
+	Stats = FJoltNavQueryStats();
+}
+
+void UJoltMoverNavQueryBatcher::Deinitialize()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingQueries.Empty();
+		Results.Empty();
+	}
+
+	Super::Deinitialize();
+}
+
+void UJoltMoverNavQueryBatcher::Prefetch(double SimTimeMs, const FQuery& Query)
+{
+	if (Query.NavData == nullptr)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	FPendingQuery& Pending = PendingQueries.AddDefaulted_GetRef();
+	Pending.Query = Query;
+	Pending.Key = FQueryKey(Query);
+	Pending.SimTimeMs = SimTimeMs;
+}
+
+bool UJoltMoverNavQueryBatcher::FindOrRunQuery(const FQuery& Query, FNavLocation& OutLocation)
+{
+	if (Query.NavData == nullptr)
+	{
+		return false;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (FQueryResult* Result = Results.Find(FQueryKey(Query)))
+		{
+			OutLocation = Result->Location;
+			Result->bUsed = true;
+
+			++Stats.CacheHits;
+			TRACE_COUNTER_INCREMENT(JoltMoverNavCacheHits);
+			return Result->bSuccess;
+		}
+
+		++Stats.QueriesIssued;
+		TRACE_COUNTER_INCREMENT(JoltMoverNavQueriesIssued);
+	}
+
+	return RunQuery(Query, OutLocation);
+}
+
+void UJoltMoverNavQueryBatcher::RunPendingQueries(double SimTimeMs)
+{
+	TArray<FPendingQuery> Batch;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (SimTimeMs == CurrentSimTimeMs)
+		{
+			return;
+		}
+
+		for (const TPair<FQueryKey, FQueryResult>& Pair : Results)
+		{
+			Stats.PrefetchesUnused += Pair.Value.bUsed ? 0 : 1;
+		}
+		Results.Reset();
+		CurrentSimTimeMs = SimTimeMs;
+
+		// Pull out everything queued for this tick. Anything queued for an earlier time is stale (e.g. after a rollback) and is dropped.
+		for (int32 i = PendingQueries.Num() - 1; i >= 0; --i)
+		{
+			if (PendingQueries[i].SimTimeMs <= SimTimeMs)
+			{
+				if (PendingQueries[i].SimTimeMs == SimTimeMs)
+				{
+					Batch.Add(PendingQueries[i]);
+				}
+				PendingQueries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			}
+		}
+	}
+
+	if (Batch.IsEmpty())
+	{
+		return;
+	}
+
+	// The batch runs unlocked. Queries made for this tick until it is published miss and run directly, they never wait on it.
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJoltMoverNavQueryBatcher::RunPendingQueries);
+
+	for (FPendingQuery& Pending : Batch)
+	{
+		Pending.TileSortKey = ComputeTileSortKey(Pending.Query);
+	}
+
+	// Group by navmesh and tile, so each task's contiguous range touches as few tiles as possible
+	Batch.Sort([](const FPendingQuery& A, const FPendingQuery& B)
+		{
+			if (A.Query.NavData != B.Query.NavData)
+			{
+				return A.Query.NavData < B.Query.NavData;
+			}
+			return A.TileSortKey < B.TileSortKey;
+		});
+
+	const int32 MinBatchSize = FMath::Max(1, UE::JoltMover::NavQueryBatcher::ParallelMinBatchSize);
+	ParallelFor(TEXT("JoltMover.NavQueryBatch"), Batch.Num(), MinBatchSize, [&Batch](int32 Index)
+		{
+			FPendingQuery& Pending = Batch[Index];
+			Pending.Result.bSuccess = RunQuery(Pending.Query, Pending.Result.Location);
+		},
+		Batch.Num() < MinBatchSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	FScopeLock ScopeLock(&Lock);
+
+	// A later tick started while the batch ran, its results are of no use anymore
+	if (SimTimeMs != CurrentSimTimeMs)
+	{
+		return;
+	}
+
+	Results.Reserve(Batch.Num());
+	for (const FPendingQuery& Pending : Batch)
+	{
+		Results.Add(Pending.Key, Pending.Result);
+	}
+
+	Stats.QueriesPrefetched += Batch.Num();
+	TRACE_COUNTER_ADD(JoltMoverNavQueriesPrefetched, Batch.Num());
+}
+
+bool UJoltMoverNavQueryBatcher::RunQuery(const FQuery& Query, FNavLocation& OutLocation)
+{
+	if (Query.NavData == nullptr)
+	{
+		return false;
+	}
+
+	if (Query.Type == EQueryType::ProjectPoint)
+	{
+		return Query.NavData->ProjectPoint(Query.Start, OutLocation, Query.TargetOrExtent);
+	}
+
+	return Query.NavData->FindMoveAlongSurface(FNavLocation(Query.Start, Query.StartNodeRef), Query.TargetOrExtent, OutLocation);
+}
+
+uint64 UJoltMoverNavQueryBatcher::ComputeTileSortKey(const FQuery& Query)
+{
+	const ARecastNavMesh* RecastNavMesh = Cast<const ARecastNavMesh>(Query.NavData);
+	if (RecastNavMesh == nullptr)
+	{
+		return 0;
+	}
+
+	uint32 PolyIndex = 0;
+	uint32 TileIndex = 0;
+	if (Query.StartNodeRef != INVALID_NAVNODEREF && RecastNavMesh->GetPolyTileIndex(Query.StartNodeRef, PolyIndex, TileIndex))
+	{
+		return TileIndex;
+	}
+
+	// No poly yet, fall back to the tile grid coordinates under the query location. Kept above the tile index range so the two never mix.
+	int32 TileX = 0;
+	int32 TileY = 0;
+	RecastNavMesh->GetNavMeshTileXY(Query.Start, TileX, TileY);
+	return (1ull << 63) | ((uint64)(uint32)TileX << 32) | (uint32)TileY;
+}
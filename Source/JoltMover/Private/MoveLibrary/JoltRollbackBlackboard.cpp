@@ -4,6 +4,7 @@
 #include "MoveLibrary/JoltRollbackBlackboard.h"
 #include "JoltMoverTypes.h"
 #include "GenericPlatform/GenericPlatformMath.h"
+#include "JoltNetworkPredictionUtil.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltRollbackBlackboard)
 
@@ -23,6 +24,14 @@ uint32 UJoltRollbackBlackboard::BlackboardEntryBase::ComputeBufferSize(EJoltBlac
 			BufferSize = FMath::Max(BufferSize, FixedBufferSize);
 			break;
 
+		case EJoltBlackboardSizingPolicy::FixedBackendBufferSize:
+			BufferSize = FMath::Max(BufferSize, (uint32)UE_NP::NumFramesStorage);
+			break;
+
+		case EJoltBlackboardSizingPolicy::SingleEntry:
+			// One slot being read externally, one being written by the in-progress simulation
+			break;
+
 		default:	//TODO: warn about an unhandled policy type
 			break;
 	}
@@ -30,12 +39,13 @@ uint32 UJoltRollbackBlackboard::BlackboardEntryBase::ComputeBufferSize(EJoltBlac
 	return BufferSize;
 }
 
-UJoltRollbackBlackboard::BlackboardEntryBase::BlackboardEntryBase(const EntrySettings& InSettings, uint32 BufferSize)
+UJoltRollbackBlackboard::BlackboardEntryBase::BlackboardEntryBase(const EntrySettings& InSettings, uint32 InBufferSize)
 	: Settings(InSettings)
-	, Timestamps(BufferSize, EntryTimeStamp())
+	, BufferSize(FMath::Max(InBufferSize, 1u))
 	, ExternalIdx(0)
 	, InternalIdx(0)
 {
+	Timestamps.Init(EntryTimeStamp(), BufferSize);
 }
 
 void UJoltRollbackBlackboard::BlackboardEntryBase::RollBack(uint32 NewPendingFrame)
@@ -43,13 +53,15 @@ void UJoltRollbackBlackboard::BlackboardEntryBase::RollBack(uint32 NewPendingFra
 	// Goal: adjust entry to point at the value from the prior frame. May make the entry invalidated, if there were no values that old.
 	check(ExternalIdx == InternalIdx);
 
-	const uint32 LowestPossibleIdx = (ExternalIdx > Timestamps.Capacity()) ? (ExternalIdx - Timestamps.Capacity()) : 0u;
+	// Walk downwards to find the highest index with a frame < NewPendingFrame, without going below index 0 or revisiting a slot.
+	const uint32 NumSlotsToCheck = FMath::Min(BufferSize, ExternalIdx + 1);
 
-	// Walk downwards to find the highest index with a frame < NewPendingFrame. 
-	// If we hit uint32::max, that indicates we wrapped around from 0 and we're out of slots to check.
-	for (uint32 IdxToCheck = ExternalIdx; IdxToCheck >= LowestPossibleIdx && IdxToCheck != TNumericLimits<uint32>::Max(); --IdxToCheck)
+	for (uint32 NumChecked = 0; NumChecked < NumSlotsToCheck; ++NumChecked)
 	{
-		if (Timestamps[IdxToCheck].IsValid() && Timestamps[IdxToCheck].Frame < NewPendingFrame)
+		const uint32 IdxToCheck = ExternalIdx - NumChecked;
+		const EntryTimeStamp& TimeStamp = Timestamps[ToSlot(IdxToCheck)];
+
+		if (TimeStamp.IsValid() && TimeStamp.Frame < NewPendingFrame)
 		{
 			ExternalIdx = InternalIdx = IdxToCheck;
 			return;
@@ -57,7 +69,7 @@ void UJoltRollbackBlackboard::BlackboardEntryBase::RollBack(uint32 NewPendingFra
 	}
 
 	// If we made it here, then there are no entries that weren't rolled back, so let's make it clear
-	Timestamps[ExternalIdx].Invalidate();
+	Timestamps[ToSlot(ExternalIdx)].Invalidate();
 
 
 }
@@ -66,7 +78,7 @@ void UJoltRollbackBlackboard::BlackboardEntryBase::RollBack(uint32 NewPendingFra
 
 bool UJoltRollbackBlackboard::BlackboardEntryBase::CanReadEntryAt(const EntryTimeStamp& ReaderTimeStamp, EEntryIndexType IndexType) const
 {
-	const uint32 TimestampIdx = IndexType == EEntryIndexType::External ? ExternalIdx : InternalIdx;
+	const uint32 TimestampIdx = ToSlot(IndexType == EEntryIndexType::External ? ExternalIdx : InternalIdx);
 
 	if (!Timestamps[TimestampIdx].IsValid())
 	{
@@ -118,11 +130,41 @@ void UJoltRollbackBlackboard::EndSimulationFrame()
 	CurrentSimTimeStamp = InProgressSimTimeStamp;
 
 
-	// TODO: could we skip this if no "set" operations occurred? Consider different policies, like change-every-frame entries
+	// Only entries written this frame have an internal index that moved ahead of the external one
+	for (BlackboardEntryBase* Entry : EntriesWrittenThisFrame)
+	{
+		Entry->OnSimulationFrameEnd();
+		Entry->bWrittenThisFrame = false;
+	}
+	EntriesWrittenThisFrame.Reset();
+
+	// Records older than the backend history can no longer be the target of a rollback
+	const uint32 HistoryFrames = (uint32)UE_NP::NumFramesStorage;
+	if (RollbackJournal.Num() > (int32)(HistoryFrames * 2) && CurrentSimTimeStamp.Frame > HistoryFrames)
+	{
+		const uint32 OldestRollbackFrame = CurrentSimTimeStamp.Frame - HistoryFrames;
+		int32 NumExpired = 0;
+		while (NumExpired < RollbackJournal.Num() && RollbackJournal[NumExpired].Frame < OldestRollbackFrame)
+		{
+			++NumExpired;
+		}
+		RollbackJournal.RemoveAt(0, NumExpired, EAllowShrinking::No);
+	}
+}
+
+void UJoltRollbackBlackboard::OnEntryWritten_Internal(BlackboardEntryBase& Entry)
+{
+	if (Entry.bWrittenThisFrame)
+	{
+		return;
+	}
+
+	Entry.bWrittenThisFrame = true;
+	EntriesWrittenThisFrame.Add(&Entry);
 
-	for (const TPair<FName, TUniquePtr<BlackboardEntryBase>>& KVP : EntryMap)
+	if (Entry.IsRollbackSensitive())
 	{
-		KVP.Value->OnSimulationFrameEnd();
+		RollbackJournal.Add({ InProgressSimTimeStamp.Frame, &Entry });
 	}
 }
 
@@ -140,9 +182,11 @@ void UJoltRollbackBlackboard::BeginRollback(const FJoltMoverTimeStep& NewBaseTim
 
 	const EntryTimeStamp NewBaseTimeStamp((double)NewBaseTimeStep.BaseSimTimeMs, NewBaseTimeStep.ServerFrame);
 
-	for (const TPair<FName, TUniquePtr<BlackboardEntryBase>>& KVP : EntryMap)
+	// Only entries written on or after the new pending frame can hold values that need to be discarded.
+	// An entry written on several of those frames is visited once per frame, later visits find it already rolled back.
+	while (RollbackJournal.Num() > 0 && RollbackJournal.Last().Frame >= NewBaseTimeStamp.Frame)
 	{
-		KVP.Value->RollBack(NewBaseTimeStamp.Frame);
+		RollbackJournal.Pop(EAllowShrinking::No).Entry->RollBack(NewBaseTimeStamp.Frame);
 	}
 
 	// As the rollback occurs, we need to pull back the timestamps to match
@@ -53,6 +53,11 @@ public:
 	// Primary movement simulation update. Given an starting state and timestep, produce a new state. Called by Network Prediction system.
 	UE_API void SimulationTick(const FJoltNetSimTimeStep& TimeStep, const TJoltNetSimInput<KinematicMoverStateTypes>& SimInput, const TJoltNetSimOutput<KinematicMoverStateTypes>& SimOutput);
 	UE_API void PostPhysicsTick(const FJoltNetSimTimeStep& TimeStep, const TJoltNetSimInput<KinematicMoverStateTypes>& SimInput, const TJoltNetSimOutput<KinematicMoverStateTypes>& SimOutput);
+
+	// Parallel tick support, only used when j.np.Tick.Parallel is enabled. Forwarded to the Mover component.
+	UE_API bool CanSimulationTickInParallel() const;
+	UE_API void BeginParallelSimulationTick();
+	UE_API void CommitParallelSimulationTick();
 	// End NP Driver interface
 
 	// IJoltMoverBackendLiaisonInterface
@@ -11,6 +11,7 @@
 #define UE_API JOLTMOVER_API
 
 class UNavJoltMoverComponent;
+class UJoltMoverNavQueryBatcher;
 class INavigationDataInterface;
 class UJoltCommonLegacyMovementSettings;
 
@@ -89,6 +90,9 @@ public:
 	 */
 	UE_API virtual bool FindNavFloor(const FVector& TestLocation, FNavLocation& OutNavFloorLocation, const INavigationDataInterface* NavData) const;
 
+	/** Queues the navmesh query next tick is expected to make, so the nav query batcher can run it along with every other nav walker's */
+	UE_API void PrefetchNextNavQuery(UJoltMoverNavQueryBatcher& NavQueryBatcher, const FJoltMoverTimeStep& TimeStep, const FVector& NextFeetLocation, const FVector& MoveDelta) const;
+
 	// Returns the active turn generator. Note: you will need to cast the return value to the generator you expect to get, it can also be none
 	UFUNCTION(BlueprintPure, Category = Mover)
 	UE_API UObject* GetTurnGenerator();
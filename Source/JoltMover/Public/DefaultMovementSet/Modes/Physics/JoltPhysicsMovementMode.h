@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "JoltMovementMode.h"
+#include "Core/DataTypes/JoltBridgeTypes.h"
 #include "JoltPhysicsMovementMode.generated.h"
 
 /**
@@ -27,6 +28,9 @@ public:
 	
 	EJoltMoverFrictionOverrideMode GetFrictionOverrideMode() const {return FrictionOverrideMode; };
 	
+	// Contact overrides applied to the mover's physics body for the next physics step. Defaults to FrictionOverrideMode, override for surface velocity or restitution.
+	virtual FJoltContactModifierSettings GetContactModifierSettings() const;
+	
 	
 protected:
 	
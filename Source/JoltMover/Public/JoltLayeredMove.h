@@ -4,6 +4,7 @@
 
 #include "GameplayTagContainer.h"
 #include "MoveLibrary/JoltMovementUtilsTypes.h"
+#include "JoltMoverInstancePool.h"
 #include "JoltLayeredMove.generated.h"
 
 #define UE_API JOLTMOVER_API
@@ -193,9 +194,10 @@ struct FJoltLayeredMoveGroup
 		return FindActiveMove<MoveType>() || FindQueuedMove<MoveType>();
 	}
 
-	// Generates active layered move list (by calling FlushMoveArrays) and returns the an array of all currently active layered moves
-	UE_API TArray<TSharedPtr<FJoltLayeredMoveBase>> GenerateActiveMoves(const FJoltMoverTimeStep& TimeStep, const UJoltMoverComponent* MoverComp, UJoltMoverBlackboard* SimBlackboard);
-	UE_API TArray<TSharedPtr<FJoltLayeredMoveBase>> GenerateActiveMoves_Async(const FJoltMoverTimeStep& TimeStep, UJoltMoverBlackboard* SimBlackboard);
+	// Generates active layered move list (by calling FlushMoveArrays) and returns the array of all currently active layered moves.
+	// The array is owned by this group, iterate it in place rather than copying it.
+	UE_API const TArray<TSharedPtr<FJoltLayeredMoveBase>>& GenerateActiveMoves(const FJoltMoverTimeStep& TimeStep, const UJoltMoverComponent* MoverComp, UJoltMoverBlackboard* SimBlackboard);
+	UE_API const TArray<TSharedPtr<FJoltLayeredMoveBase>>& GenerateActiveMoves_Async(const FJoltMoverTimeStep& TimeStep, UJoltMoverBlackboard* SimBlackboard);
 
 	/** Serialize all moves and their states for this group */
 	UE_API void NetSerialize(FArchive& Ar, uint8 MaxNumMovesToSerialize = MAX_uint8);
@@ -259,6 +261,9 @@ protected:
 	/** Moves that are queued to become active next sim frame */
 	TArray< TSharedPtr<FJoltLayeredMoveBase> > QueuedLayeredMoves;
 
+	/** Instances recycled when this group is overwritten by a copy, e.g. during rollback */
+	TJoltMoverInstancePool<FJoltLayeredMoveBase> LayeredMovePool;
+
 	/** Used during simulation to cancel any moves that match a tag */
 	TArray<TPair<FGameplayTag, bool>> TagCancellationRequests;
 public:
@@ -4,6 +4,7 @@
 
 #include "GameplayTagContainer.h"
 #include "MoveLibrary/JoltMovementUtilsTypes.h"
+#include "JoltMoverInstancePool.h"
 #include "JoltMovementModifier.generated.h"
 
 #define UE_API JOLTMOVER_API
@@ -234,10 +235,11 @@ struct FJoltMovementModifierGroup
 	UE_API void CancelModifierFromHandle(const FJoltMovementModifierHandle& HandleToCancel);
 	UE_API void CancelModifiersByTag(FGameplayTag Tag, bool bRequiresExactMatch=false);
 	
-	// Generates active modifier list (by calling FlushModifierArrays) and returns the an array of all currently active modifiers
-	UE_API TArray<TSharedPtr<FJoltMovementModifierBase>> GenerateActiveModifiers(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState);
+	// Generates active modifier list (by calling FlushModifierArrays) and returns the array of all currently active modifiers.
+	// The array is owned by this group, iterate it in place rather than copying it.
+	UE_API const TArray<TSharedPtr<FJoltMovementModifierBase>>& GenerateActiveModifiers(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState);
 	
-	UE_API TArray<TSharedPtr<FJoltMovementModifierBase>> GenerateActiveModifiers_Async(const FJoltMovementModifierParams_Async& Params);
+	UE_API const TArray<TSharedPtr<FJoltMovementModifierBase>>& GenerateActiveModifiers_Async(const FJoltMovementModifierParams_Async& Params);
 
 	/** Copy operator - deep copy so it can be used for archiving/saving off moves */
 	UE_API FJoltMovementModifierGroup& operator=(const FJoltMovementModifierGroup& Other);
@@ -275,6 +277,9 @@ protected:
 
 	/** Movement modifiers that are queued to become active next sim frame */
 	TArray< TSharedPtr<FJoltMovementModifierBase> > QueuedModifiers;
+
+	/** Instances recycled when this group is overwritten by a copy, e.g. during rollback */
+	TJoltMoverInstancePool<FJoltMovementModifierBase> ModifierPool;
 	
 	// Clears out any finished or invalid modifiers and adds any queued modifiers to the active modifiers
 	UE_API void FlushModifierArrays(UJoltMoverComponent* MoverComp, const FJoltMoverTimeStep& TimeStep, const FJoltMoverSyncState& SyncState, const FJoltMoverAuxStateContext& AuxState);
@@ -168,6 +168,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "JoltBridge Physics|Objects", DisplayName="Set Physics State", meta=(DevelopmentOnly))
 	JOLTMOVER_API void RewindStateBackToPreviousFrame(const int32 FrameDelta);
 
+	// Parallel simulation tick, driven by the backend when j.np.Tick.Parallel is enabled. See bAllowParallelSimulationTick.
+	JOLTMOVER_API virtual bool CanSimulationTickInParallel() const;
+	// Until the matching commit, SimulationTick buffers its physics writes instead of pushing them to the physics world
+	JOLTMOVER_API void BeginParallelSimulationTick();
+	// Called on the game thread in a deterministic order once every parallel tick of the frame has finished
+	JOLTMOVER_API void CommitParallelSimulationTick();
+
 	
 	// Callbacks
 	UFUNCTION()
@@ -525,6 +532,15 @@ public:	// Queries
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = Mover)
 	JOLTMOVER_API TArray<FJoltTrajectorySampleInfo> GetPredictedTrajectory(FJoltMoverPredictTrajectoryParams PredictionParams);	
 
+	/**
+	 * Side-effect-free version of GetPredictedTrajectory. Component state is only read, never modified, so predictions for different movers
+	 * may run concurrently (see UJoltMoverTrajectorySubsystem). ScratchState is overwritten and only exists so callers can reuse its allocations.
+	 */
+	JOLTMOVER_API void PredictTrajectory(const FJoltMoverPredictTrajectoryParams& PredictionParams, FJoltMoverTickStartData& ScratchState, TArray<FJoltTrajectorySampleInfo>& OutSamples) const;
+
+	// Whether PredictTrajectory may be called off the game thread. False when the current mode's GenerateMove is implemented in script.
+	JOLTMOVER_API bool CanPredictTrajectoryInParallel() const;
+
 	// Get the current movement mode name
 	UFUNCTION(BlueprintPure, Category = Mover)
 	JOLTMOVER_API FName GetMovementModeName() const;
@@ -811,6 +827,25 @@ protected:
 	FJoltMoverDoubleBuffer<FJoltMoverSyncState> MoverSyncStateDoubleBuffer;
 	
 	const FJoltUpdatedMotionState* LastMoverDefaultSyncState = nullptr;
+	
+	// Bound to UJoltPhysicsWorldSubsystem::OnModifyContacts, refreshes this body's entry in the contact override table every step
+	FDelegateHandle ModifyContactsHandle;
+	bool bHasActiveContactModifier = false;
+	
+	// Component registered with UJoltPhysicsWorldSubsystem::AddTransformWriteBack, moved by the subsystem after every physics step
+	TWeakObjectPtr<USceneComponent> TransformWriteBackComponent;
+
+	// Physics writes produced by a SimulationTick running in parallel, applied by CommitParallelSimulationTick
+	struct FDeferredPhysicsWrite
+	{
+		FVector LinearVelocity = FVector::ZeroVector;
+		FVector AngularVelocity = FVector::ZeroVector;
+		FRotator Orientation = FRotator::ZeroRotator;
+		FVector Position = FVector::ZeroVector;
+		bool bPending = false;
+	};
+	FDeferredPhysicsWrite DeferredPhysicsWrite;
+	bool bInParallelSimulationTick = false;
 
 	FJoltMoverTimeStep CachedLastSimTickTimeStep;	// Saved timestep info from our last simulation tick, used during rollback handling. This will rewind during corrections.
 	FJoltMoverTimeStep CachedNewestSimTickTimeStep;	// Saved timestep info from the newest (farthest-advanced) simulation tick. This will not rewind during corrections.
@@ -887,6 +922,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BulletMover", AdvancedDisplay)
 	uint8 bIgnoreVelocityGeneratedByMovementMode : 1 = 0;
 
+	// If enabled, this component's simulation tick may run on a worker thread alongside other movers when j.np.Tick.Parallel is set.
+	// Physics writes are deferred to a serial commit, but movement modes and layered moves must only read the world
+	// and this component's own state. Ignored while any registered mode is not a physics mode (kinematic modes move
+	// the updated component directly), while any delegate broadcast from the simulation tick is bound (pre/post simulation tick,
+	// pre/post movement, mode changes, transitions, rollback, OnLanded) or while layered move registrations are pending. Applies to
+	// rollback resimulation steps as well.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JoltMover", AdvancedDisplay, Experimental)
+	uint8 bAllowParallelSimulationTick : 1 = 0;
+
 	// If enabled, we'll send inputs along with to sim proxy via the sync state, and they'll be available via GetLastInputCmd. This may be useful for cases where input is used to hint at object state, such as an anim graph. This option is intended to be temporary until all networking backends allow this.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JoltMover", AdvancedDisplay, Experimental)
 	uint8 bSyncInputsForSimProxy : 1 = 0;
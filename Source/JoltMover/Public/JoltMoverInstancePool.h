@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/Class.h"
+#include "JoltMoverLog.h"
+#include "JoltMoverModule.h"
+
+/**
+ * Recycles polymorphic sync state elements (layered moves, movement modifiers) between copies of the group that owns it.
+ * Copying a group into one that already holds instances of the same struct types becomes a CopyScriptStruct per element
+ * instead of a Clone, and instances dropped by a copy are kept around so that a later copy (e.g. restoring a rollback
+ * frame with one more move than the current frame) can reuse them instead of allocating.
+ *
+ * Elements may be shared with other groups (e.g. history frames holding the same TSharedPtr), so only elements this group
+ * holds the last reference to are ever written in place or recycled.
+ *
+ * BaseT must provide Clone(), GetScriptStruct() and AddReferencedObjects(FReferenceCollector&).
+ * The pool is owned by a single group and is intentionally never copied along with it.
+ */
+template<typename BaseT>
+struct TJoltMoverInstancePool
+{
+	static constexpr int32 MaxPooledInstances = 8;
+
+	TJoltMoverInstancePool() = default;
+	TJoltMoverInstancePool(const TJoltMoverInstancePool&) {}
+	TJoltMoverInstancePool& operator=(const TJoltMoverInstancePool&) { return *this; }
+
+	/** Makes Dest an element-wise deep copy of Src, reusing existing and pooled instances of matching struct types */
+	void CopyArray(TArray<TSharedPtr<BaseT>>& Dest, const TArray<TSharedPtr<BaseT>>& Src)
+	{
+		if (UE::JoltMover::DisableDataCopyInPlace != 0)
+		{
+			Dest.Reset(Src.Num());
+			for (const TSharedPtr<BaseT>& SrcElement : Src)
+			{
+				if (SrcElement.IsValid())
+				{
+					Dest.Add(TSharedPtr<BaseT>(SrcElement->Clone()));
+				}
+			}
+			return;
+		}
+
+		int32 NumCopied = 0;
+		for (const TSharedPtr<BaseT>& SrcElement : Src)
+		{
+			const BaseT* SrcData = SrcElement.Get();
+			if (!SrcData)
+			{
+				UE_LOG(LogJoltMover, Warning, TEXT("TJoltMoverInstancePool::CopyArray trying to copy an invalid element"));
+				continue;
+			}
+
+			if (NumCopied < Dest.Num())
+			{
+				TSharedPtr<BaseT>& DestElement = Dest[NumCopied];
+				UScriptStruct* SourceStruct = SrcData->GetScriptStruct();
+				if (DestElement.IsValid() && DestElement->GetScriptStruct() == SourceStruct && DestElement.IsUnique())
+				{
+					// Same type and nobody else sees it, so copy in place
+					SourceStruct->CopyScriptStruct(DestElement.Get(), SrcData, 1);
+				}
+				else
+				{
+					// Shared with another frame or holder: drop our reference (recycled only if it was the last) and take a fresh one
+					Release(DestElement);
+					DestElement = Acquire(*SrcData);
+				}
+			}
+			else
+			{
+				Dest.Add(Acquire(*SrcData));
+			}
+
+			++NumCopied;
+		}
+
+		for (int32 i = NumCopied; i < Dest.Num(); ++i)
+		{
+			Release(Dest[i]);
+		}
+		Dest.SetNum(NumCopied, EAllowShrinking::No);
+	}
+
+	/** Returns a copy of Src, taken from the pool if an instance of the same struct type is available */
+	TSharedPtr<BaseT> Acquire(const BaseT& Src)
+	{
+		UScriptStruct* SourceStruct = Src.GetScriptStruct();
+		for (int32 i = FreeInstances.Num() - 1; i >= 0; --i)
+		{
+			if (FreeInstances[i]->GetScriptStruct() == SourceStruct)
+			{
+				TSharedPtr<BaseT> Instance = MoveTemp(FreeInstances[i]);
+				FreeInstances.RemoveAtSwap(i, 1, EAllowShrinking::No);
+				SourceStruct->CopyScriptStruct(Instance.Get(), &Src, 1);
+				return Instance;
+			}
+		}
+
+		return TSharedPtr<BaseT>(Src.Clone());
+	}
+
+	/** Hands an instance back to the pool. Instances still referenced elsewhere are only dropped, never recycled. */
+	void Release(TSharedPtr<BaseT>& Instance)
+	{
+		if (Instance.IsValid() && Instance.IsUnique() && FreeInstances.Num() < MaxPooledInstances)
+		{
+			FreeInstances.Add(MoveTemp(Instance));
+		}
+		Instance.Reset();
+	}
+
+	void Empty()
+	{
+		FreeInstances.Empty();
+	}
+
+	/** Pooled instances still hold whatever they referenced when released, so keep those alive until they are overwritten */
+	void AddReferencedObjects(FReferenceCollector& Collector) const
+	{
+		for (const TSharedPtr<BaseT>& Instance : FreeInstances)
+		{
+			Instance->AddReferencedObjects(Collector);
+		}
+	}
+
+private:
+	TArray<TSharedPtr<BaseT>> FreeInstances;
+};
@@ -9,6 +9,7 @@
 #include "Engine/NetSerialization.h"
 #include "JoltMoverTypes.h"
 #include "MoveLibrary/JoltMovementRecord.h"
+#include "MoveLibrary/JoltMoverBlackboard.h"
 #include "JoltLayeredMove.h"
 #include "JoltLayeredMoveGroup.h"
 #include "JoltMovementModifier.h"
@@ -39,6 +40,16 @@ namespace CommonBlackboard
 	const FName LastModeChangeRecord = TEXT("LastModeChangeRecord");
 }
 
+// Precomputed handles for the keys above, used by UJoltMoverBlackboard to skip name lookups. Defined once in JoltMoverSimulationTypes.cpp.
+namespace CommonBlackboard::Keys
+{
+	extern JOLTMOVER_API const FJoltMoverBlackboardKey LastFloorResult;
+	extern JOLTMOVER_API const FJoltMoverBlackboardKey LastWaterResult;
+	extern JOLTMOVER_API const FJoltMoverBlackboardKey LastFoundDynamicMovementBase;
+	extern JOLTMOVER_API const FJoltMoverBlackboardKey LastAppliedDynamicMovementBase;
+	extern JOLTMOVER_API const FJoltMoverBlackboardKey TimeSinceSupported;
+}
+
 
 /**
  * Filled out by a MovementMode during simulation tick to indicate its ending state, allowing for a residual time step and switching modes mid-tick
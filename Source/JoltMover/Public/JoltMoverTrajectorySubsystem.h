@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/ObjectKey.h"
+#include "JoltMoverSimulationTypes.h"
+#include "JoltMoverTrajectorySubsystem.generated.h"
+
+#define UE_API JOLTMOVER_API
+
+class UJoltMoverComponent;
+
+/** A single trajectory query for UJoltMoverTrajectorySubsystem::PredictTrajectories */
+struct FJoltMoverTrajectoryRequest
+{
+	const UJoltMoverComponent* MoverComp = nullptr;
+	FJoltMoverPredictTrajectoryParams Params;
+};
+
+/**
+ * Batches trajectory predictions for all movers in a world.
+ * Predictions run through UJoltMoverComponent::PredictTrajectory, which only reads component state, so movers with native movement
+ * modes are evaluated in parallel. Trajectories requested through GetPredictedTrajectory are cached for the rest of the frame, and every
+ * mover that asked last frame is re-predicted in one parallel batch by the first request of the next frame.
+ *
+ * Batches run outside of the cache lock; only lookups and publishing results hold it.
+ */
+UCLASS(MinimalAPI)
+class UJoltMoverTrajectorySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Predicts every request, bypassing the frame cache. OutTrajectories is index-matched with Requests. */
+	UE_API void PredictTrajectories(TConstArrayView<FJoltMoverTrajectoryRequest> Requests, TArray<TArray<FJoltTrajectorySampleInfo>>& OutTrajectories);
+
+	/**
+	 * UJoltMoverComponent::GetPredictedTrajectory, cached for the current frame. Every caller in a frame gets the same samples for a mover,
+	 * predicted from its state when the frame's first request refreshed the batch (or when it was first asked for, if it wasn't in the
+	 * batch). A mover that moves later in the frame isn't re-predicted until the next one, so the result can lag a direct
+	 * GetPredictedTrajectory call by up to a frame of movement. Requests with optional start states or inputs are specific to the caller and
+	 * are never cached. Safe to call from any thread.
+	 */
+	UE_API void GetPredictedTrajectory(const UJoltMoverComponent& MoverComp, const FJoltMoverPredictTrajectoryParams& Params, TArray<FJoltTrajectorySampleInfo>& OutSamples);
+
+	UE_API virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override { return WorldType == EWorldType::Game || WorldType == EWorldType::PIE; }
+
+private:
+	struct FCachedTrajectory
+	{
+		TWeakObjectPtr<const UJoltMoverComponent> MoverComp;
+		FJoltMoverPredictTrajectoryParams Params;
+		TArray<FJoltTrajectorySampleInfo> Samples;
+		uint64 PredictedFrame = 0;
+		uint64 LastRequestedFrame = 0;
+	};
+
+	// Re-predicts every cached mover requested recently, in one batch. Called by the first cached request of each frame, with BatchLock held.
+	void RefreshCache(uint64 FrameNumber);
+
+	// Predicts Entries in parallel where the movement mode allows it, serially on the calling thread otherwise. Requires BatchLock.
+	void PredictBatch(TArrayView<FCachedTrajectory*> Entries);
+
+	static bool IsCacheable(const FJoltMoverPredictTrajectoryParams& Params);
+	static bool HasSameSettings(const FJoltMoverPredictTrajectoryParams& A, const FJoltMoverPredictTrajectoryParams& B);
+
+	// Cache and LastRefreshFrame are only touched while CacheLock is held. It is never held while predicting.
+	TMap<TObjectKey<UJoltMoverComponent>, FCachedTrajectory> Cache;
+	uint64 LastRefreshFrame = MAX_uint64;
+	FCriticalSection CacheLock;
+
+	// Serializes batches. Taken before CacheLock when both are needed.
+	FCriticalSection BatchLock;
+
+	// Per-worker step states, reused across batches so repeated predictions copy sync state collections in place
+	TArray<FJoltMoverTickStartData> WorkerScratchStates;
+
+	// Reusable batch arrays. These and WorkerScratchStates are only touched while BatchLock is held.
+	TArray<FCachedTrajectory*> ParallelEntries;
+	TArray<FCachedTrajectory> RequestEntries;
+	TArray<TObjectKey<UJoltMoverComponent>> RefreshKeys;
+};
+
+#undef UE_API
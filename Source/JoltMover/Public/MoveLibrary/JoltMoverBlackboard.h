@@ -19,11 +19,39 @@ enum class EJoltInvalidationReason : uint8
 };
 
 
+/**
+ * Precomputed handle to a blackboard object name. Every name maps to a dense, process-wide index so blackboards can
+ * store their objects in a flat array and skip hashing the name on each access. Construct once (e.g. as a static or
+ * namespace-scope constant) and reuse; constructing one registers the name, taking the write lock on the global registry
+ * the first time a name is seen. Find only reads the registry.
+ */
+struct FJoltMoverBlackboardKey
+{
+	FJoltMoverBlackboardKey() = default;
+	UE_API explicit FJoltMoverBlackboardKey(FName InName);
+	
+	/** Key of an already registered name, invalid if nothing registered it. A name never registered was never set either. */
+	UE_API static FJoltMoverBlackboardKey Find(FName InName);
+
+	FName GetName() const { return Name; }
+	int32 GetIndex() const { return Index; }
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+private:
+	FJoltMoverBlackboardKey(FName InName, int32 InIndex) : Name(InName), Index(InIndex) {}
+	
+	FName Name = NAME_None;
+	int32 Index = INDEX_NONE;
+};
+
+
 /** MoverBlackboard: this is a simple generic map that can store any type, used as a way for decoupled systems to 
  *  store calculations or transient state data that isn't necessary to reconstitute the movement simulation. 
  *  It has support for invalidation, which could occur, for example, when a rollback is triggered.
  *  Values submitted are copy-in, copy-out. 
  *  Unlike a traditional blackboard pattern, there is no support for subscribing to changes. 
+ *  Objects live in slots indexed by FJoltMoverBlackboardKey. A slot's storage is allocated the first time a type is set and
+ *  is reused by later Sets and after invalidation, so steady-state use doesn't allocate. The FName API resolves the key first.
  * TODO: expand invalidation rules attached to BBObjs, for instance if we wanted some to invalidate upon rollback. Some might expire over time or after a number of simulation frames. Or an item could be tagged with a predicted sim frame #, and become cleared once that frame is finalized/confirmed.
  */
 UCLASS(MinimalAPI, BlueprintType)
@@ -32,104 +60,112 @@ class UJoltMoverBlackboard : public UObject
 	GENERATED_BODY()
 
 private:
-	class BlackboardObject
+	// untyped base
+	struct ObjectContainerBase
 	{
-		// untyped base
-		struct ObjectContainerBase
-		{
-		};
-
-		// typed container
-		template<typename T>
-		struct ObjectContainer : ObjectContainerBase
-		{
-			ObjectContainer(const T& t) : Object(t) {}
-
-			const T& Get() { return Object; }
-			T& GetMutable() { return Object; }
-
-		private:
-			T Object;
-		};
+		virtual ~ObjectContainerBase() {}
+	};
 
+	// typed container
+	template<typename T>
+	struct ObjectContainer : ObjectContainerBase
+	{
+		ObjectContainer(const T& t) : Object(t) {}
 
-	public:
-		template<typename T>
-		BlackboardObject(const T& obj) : ContainerPtr(MakeShared<ObjectContainer<T>>(obj)) {}
+		const T& Get() const { return Object; }
+		T& GetMutable() { return Object; }
 
-		template<typename T>
-		const T& Get() const
-		{
-			ObjectContainer<T>* TypedContainer = static_cast<ObjectContainer<T>*>(ContainerPtr.Get());
-			return TypedContainer->Get();
-		}
+	private:
+		T Object;
+	};
 
-		template<typename T>
-		T& GetMutable() const
-		{
-			ObjectContainer<T>* TypedContainer = static_cast<ObjectContainer<T>*>(ContainerPtr.Get());
-			return TypedContainer->GetMutable();
-		}
+	// Used to detect a slot being reused for a different type, in which case the container is reallocated
+	template<typename T>
+	static const void* GetTypeId()
+	{
+		static const uint8 TypeId = 0;
+		return &TypeId;
+	}
 
-	private:
-		TSharedPtr<ObjectContainerBase> ContainerPtr;
-	};	// end BlackboardObject
+	struct BlackboardSlot
+	{
+		TUniquePtr<ObjectContainerBase> Container;
+		const void* TypeId = nullptr;
+		bool bIsSet = false;
+	};
  
 public:
 
 	/** Attempt to retrieve an object from the blackboard. If found, OutFoundValue will be set. Returns true/false to indicate whether it was found. */
- 	template<typename T>
-	bool TryGet(FName ObjName, T& OutFoundValue) const
+	template<typename T>
+	bool TryGet(const FJoltMoverBlackboardKey& ObjKey, T& OutFoundValue) const
 	{
-		UE::TReadScopeLock Lock(ObjectsMapLock);
+		UE::TReadScopeLock Lock(ObjectsLock);
 
-		if (const TUniquePtr<BlackboardObject>* ExistingObject = ObjectsByName.Find(ObjName))
+		if (const BlackboardSlot* Slot = FindSetSlot(ObjKey.GetIndex()))
 		{
-			OutFoundValue = ExistingObject->Get()->Get<T>();
+			OutFoundValue = static_cast<const ObjectContainer<T>*>(Slot->Container.Get())->Get();
 			return true;
 		}
 
 		return false;
 	}
 
-	// TODO: make GetOrAdds. One that takes a value, and one that takes a lambda that can generate the new value.
-	/*
-	template<typename T>
-	bool GetOrAdd(FName ObjName, some kinda lambda that returns T, T& OutFoundValue)
+ 	template<typename T>
+	bool TryGet(FName ObjName, T& OutFoundValue) const
 	{
-		if (const TUniquePtr<BlackboardObject>* ExistingObject = ObjectsByName.Find(ObjName))
-		{
-			OutFoundValue = ExistingObject->Get();
-			return true;
-		}
-
-		RunTheExec lambda and store it by the key, then return that value
-		return false;
+		return TryGet(FJoltMoverBlackboardKey::Find(ObjName), OutFoundValue);
 	}
-	template<typename T>
-	T GetOrAdd(FName ObjName, T ObjToAdd)
+
+	// TODO: make GetOrAdds. One that takes a value, and one that takes a lambda that can generate the new value.
+
+	/** Returns true/false to indicate if an object is stored with that name */
+	bool Contains(const FJoltMoverBlackboardKey& ObjKey) const
 	{
-		return ObjectsByName.FindOrAdd(ObjName, ObjToAdd);
+		UE::TReadScopeLock Lock(ObjectsLock);
+		return FindSetSlot(ObjKey.GetIndex()) != nullptr;
 	}
-	*/
 
-	/** Returns true/false to indicate if an object is stored with that name */
 	bool Contains(FName ObjName) const
 	{
-		UE::TReadScopeLock Lock(ObjectsMapLock);
-		return ObjectsByName.Contains(ObjName);
+		return Contains(FJoltMoverBlackboardKey::Find(ObjName));
 	}
 
 	/** Store object by a named key, overwriting any existing object */
 	template<typename T>
-	void Set(FName ObjName, T Obj)
+	void Set(const FJoltMoverBlackboardKey& ObjKey, const T& Obj)
+	{
+		if (!ObjKey.IsValid()) return;
+
+		UE::TWriteScopeLock Lock(ObjectsLock);
+
+		if (!Slots.IsValidIndex(ObjKey.GetIndex()))
+		{
+			Slots.SetNum(ObjKey.GetIndex() + 1);
+		}
+
+		BlackboardSlot& Slot = Slots[ObjKey.GetIndex()];
+		if (Slot.Container.IsValid() && Slot.TypeId == GetTypeId<T>())
+		{
+			static_cast<ObjectContainer<T>*>(Slot.Container.Get())->GetMutable() = Obj;
+		}
+		else
+		{
+			Slot.Container = MakeUnique<ObjectContainer<T>>(Obj);
+			Slot.TypeId = GetTypeId<T>();
+		}
+		Slot.bIsSet = true;
+	}
+
+	template<typename T>
+	void Set(FName ObjName, const T& Obj)
 	{
-		UE::TWriteScopeLock Lock(ObjectsMapLock);
-		ObjectsByName.Emplace(ObjName, MakeUnique<BlackboardObject>(Obj));
+		Set(FJoltMoverBlackboardKey(ObjName), Obj);
 	}
 
-	/** Invalidate an object by name */
-	UE_API void Invalidate(FName ObjName);
+	/** Invalidate an object by name. Its storage is kept around for the next Set. */
+	UE_API void Invalidate(const FJoltMoverBlackboardKey& ObjKey);
+	void Invalidate(FName ObjName) { Invalidate(FJoltMoverBlackboardKey::Find(ObjName)); }
 
 	/** Invalidate all objects that can be affected by a particular circumstance (such as a rollback) */
 	UE_API void Invalidate(EJoltInvalidationReason Reason);
@@ -142,8 +178,13 @@ public:
 	// End UObject interface
 
 private:
-	mutable FTransactionallySafeRWLock ObjectsMapLock;		// used internally when reading/writing to ObjectsByName map
-	TMap<FName, TUniquePtr<BlackboardObject>> ObjectsByName;
+	const BlackboardSlot* FindSetSlot(int32 SlotIndex) const
+	{
+		return (Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].bIsSet) ? &Slots[SlotIndex] : nullptr;
+	}
+
+	mutable FTransactionallySafeRWLock ObjectsLock;		// used internally when reading/writing to Slots
+	TArray<BlackboardSlot> Slots;						// indexed by FJoltMoverBlackboardKey::GetIndex
 };
 
 #undef UE_API
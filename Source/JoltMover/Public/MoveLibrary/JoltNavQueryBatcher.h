@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "JoltNavQueryBatcher.generated.h"
+
+#define UE_API JOLTMOVER_API
+
+class INavigationDataInterface;
+
+/** Running totals for UJoltMoverNavQueryBatcher, also emitted as JoltMover/Nav/* trace counters */
+struct FJoltNavQueryStats
+{
+	/** Queries a mode had to run on a navmesh itself because nothing matching was prefetched */
+	int64 QueriesIssued = 0;
+
+	/** Queries run ahead of time as part of a batch */
+	int64 QueriesPrefetched = 0;
+
+	/** Queries answered from a batch result */
+	int64 CacheHits = 0;
+
+	/** Batch results that no mode asked for before their tick ended */
+	int64 PrefetchesUnused = 0;
+};
+
+/**
+ * World-level navmesh query batcher for Mover nav walking modes.
+ *
+ * At the end of each simulation tick nav modes queue the queries they expect to make next tick (same start, same velocity). The first query
+ * made in the next tick runs the whole queue at once, sorted by navmesh tile so that each worker stays within a small set of tiles, and in
+ * parallel across task threads, outside of the batcher's lock. Modes then ask for their actual query; if it matches a prefetched one the
+ * batch result is returned, otherwise the query runs immediately like it did before. By default only the identical query hits, so
+ * results never depend on what was prefetched. A non-zero jolt.mover.nav.BatchQueries.Tolerance matches locations on a grid instead,
+ * trading that determinism for hits on slightly-off predictions: a hit may then differ from running the query directly by up to that
+ * distance, and whether it hits depends on other movers and batch timing, so server, client and resimulation can diverge.
+ *
+ * Safe to call from the game thread, the physics thread and from parallel mover ticks.
+ */
+UCLASS(MinimalAPI)
+class UJoltMoverNavQueryBatcher : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UE_API UJoltMoverNavQueryBatcher* Get(const UObject* WorldContextObject);
+
+	/** Marks the start of the sim tick at SimTimeMs. Runs every query that was prefetched for that time, if not done already. */
+	UE_API void BeginSimTick(double SimTimeMs);
+
+	/** Same as NavData->ProjectPoint, answered from the current tick's batch when possible */
+	UE_API bool ProjectPoint(const INavigationDataInterface* NavData, const FVector& Location, const FVector& Extent, FNavLocation& OutLocation);
+
+	/** Same as NavData->FindMoveAlongSurface, answered from the current tick's batch when possible */
+	UE_API bool FindMoveAlongSurface(const INavigationDataInterface* NavData, const FNavLocation& StartLocation, const FVector& TargetLocation, FNavLocation& OutLocation);
+
+	/** Queues a ProjectPoint expected to be made during the sim tick starting at SimTimeMs */
+	UE_API void PrefetchProjectPoint(double SimTimeMs, const INavigationDataInterface* NavData, const FVector& Location, const FVector& Extent);
+
+	/** Queues a FindMoveAlongSurface expected to be made during the sim tick starting at SimTimeMs */
+	UE_API void PrefetchMoveAlongSurface(double SimTimeMs, const INavigationDataInterface* NavData, const FNavLocation& StartLocation, const FVector& TargetLocation);
+
+	UE_API FJoltNavQueryStats GetStats() const;
+	UE_API void ResetStats();
+
+	UE_API virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override { return WorldType == EWorldType::Game || WorldType == EWorldType::PIE; }
+
+private:
+	enum class EQueryType : uint8
+	{
+		ProjectPoint,
+		MoveAlongSurface,
+	};
+
+	// Every input of a query, as the mode gave it
+	struct FQuery
+	{
+		const INavigationDataInterface* NavData = nullptr;
+		EQueryType Type = EQueryType::ProjectPoint;
+		NavNodeRef StartNodeRef = INVALID_NAVNODEREF;
+		FVector Start = FVector::ZeroVector;
+		FVector TargetOrExtent = FVector::ZeroVector;
+	};
+
+	// A query with its locations snapped to the match tolerance. The navmesh and start poly still have to match exactly.
+	struct FQueryKey
+	{
+		const INavigationDataInterface* NavData = nullptr;
+		EQueryType Type = EQueryType::ProjectPoint;
+		NavNodeRef StartNodeRef = INVALID_NAVNODEREF;
+		FVector Start = FVector::ZeroVector;
+		FVector TargetOrExtent = FVector::ZeroVector;
+
+		FQueryKey() = default;
+		explicit FQueryKey(const FQuery& Query);
+
+		bool operator==(const FQueryKey& Other) const
+		{
+			return NavData == Other.NavData && Type == Other.Type && StartNodeRef == Other.StartNodeRef && Start == Other.Start && TargetOrExtent == Other.TargetOrExtent;
+		}
+
+		friend uint32 GetTypeHash(const FQueryKey& Key)
+		{
+			uint32 Hash = HashCombineFast(PointerHash(Key.NavData), GetTypeHash(Key.StartNodeRef));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.Start));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.TargetOrExtent));
+			return HashCombineFast(Hash, (uint32)Key.Type);
+		}
+	};
+
+	struct FQueryResult
+	{
+		FNavLocation Location;
+		bool bSuccess = false;
+		bool bUsed = false;
+	};
+
+	struct FPendingQuery
+	{
+		FQuery Query;
+		FQueryKey Key;
+		uint64 TileSortKey = 0;
+		double SimTimeMs = 0.0;
+		FQueryResult Result;
+	};
+
+	void Prefetch(double SimTimeMs, const FQuery& Query);
+	void RunPendingQueries(double SimTimeMs);
+	bool FindOrRunQuery(const FQuery& Query, FNavLocation& OutLocation);
+
+	static bool RunQuery(const FQuery& Query, FNavLocation& OutLocation);
+	static uint64 ComputeTileSortKey(const FQuery& Query);
+
+	mutable FCriticalSection Lock;
+
+	// Sim time whose prefetched queries are in Results
+	double CurrentSimTimeMs = TNumericLimits<double>::Lowest();
+
+	TArray<FPendingQuery> PendingQueries;
+	TMap<FQueryKey, FQueryResult> Results;
+
+	FJoltNavQueryStats Stats;
+};
+
+#undef UE_API
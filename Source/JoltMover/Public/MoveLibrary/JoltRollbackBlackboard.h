@@ -2,7 +2,6 @@
 
 #pragma once
 
-#include "Containers/CircularBuffer.h"
 #include "JoltMoverLog.h"
 #include "UObject/Interface.h"
 #include "UObject/Object.h"
@@ -26,15 +25,14 @@ struct FJoltMoverTimeStep;
  *  - Policies: there are a variety of policy options to control buffer sizing, invalidation behavior, and entry persistence.
  * 
  * Notes:
- *  - This is implemented under-the-hood using circular buffers, alleviating the need for mem alloc/frees during use. It's important to create entries with policy settings appropriate for their use pattern.
+ *  - Each entry preallocates its slots when created, alleviating the need for mem alloc/frees during use. It's important to create entries with policy settings appropriate for their use pattern.
+ *  - Frame ends and rollbacks only visit the entries that were written in the affected frames, not every entry.
  *  - We use an "InternalWrapper" class to allow in-simulation objects like movement modes to use the same API, without needing to choose between internal- or external-facing functions. 
  *  - The "InternalWrapper" class will be replaced by a different pattern to govern access levels
  */
 
  // TODO: 
  // - Implement stronger concurrency controls at time of frame changes, and when new in-sim entries are written
- // - Implement sizing policies that rely on knowing a max number of elements to buffer (the backend may know these details)
- // - Consider using TArrays instead of circular buffers, due to the power-of-2 trick potentially wasting a lot of memory
  // - Expose for Blueprint use
 
 /**
@@ -48,16 +46,16 @@ enum class EJoltBlackboardSizingPolicy : uint8
 
 	/** Buffer size matches the backend simulation's history size, determined by ticking rate and history settings.
 	 * A simulation running a fixed 30 fps with a 1 second history will need a buffer size of 30. For variable rate simulations, buffer size cam only be estimated. 
-	 * NOT YET IMPLEMENTED
+	 * Uses the network prediction frame storage size (JNP_NUM_FRAME_STORAGE).
 	 */
-	FixedBackendBufferSize UMETA(Hidden),
+	FixedBackendBufferSize,
 
 	/** Minimizes data size for blackboard entries where thread contention and rolling back shouldn't change the value.
 	 * Example: a statistic tracking the maximum time spent in a particular mode's simulation tick. 
 	 * Note this will still have multiple elements for asynchronous simulations, to prevent thread contention over the entry.
-	 * NOT YET IMPLEMENTED
+	 * Entries using this policy are never rolled back, regardless of their rollback policy.
 	 */
-	SingleEntry UMETA(Hidden),
+	SingleEntry,
 };
 
 /**
@@ -149,7 +147,7 @@ private:
 	{
 	public:
 		BlackboardEntryBase() = delete;
-		UE_API BlackboardEntryBase(const EntrySettings& InSettings, uint32 BufferSize);
+		UE_API BlackboardEntryBase(const EntrySettings& InSettings, uint32 InBufferSize);
 
 		virtual ~BlackboardEntryBase()
 		{
@@ -166,15 +164,29 @@ private:
 
 		UE_API static uint32 ComputeBufferSize(EJoltBlackboardSizingPolicy InSizingPolicy, uint32 FixedBufferSize = -1);
 
+		// Whether a rollback can change what this entry reads back
+		bool IsRollbackSensitive() const
+		{
+			return Settings.SizingPolicy != EJoltBlackboardSizingPolicy::SingleEntry && Settings.RollbackPolicy == EJoltBlackboardRollbackPolicy::InvalidatedOnRollback;
+		}
+
 	protected:
 		UE_API bool CanReadEntryAt(const EntryTimeStamp& ReaderTimeStamp, EEntryIndexType IndexType) const;
 
+		// Maps an ever-increasing entry index onto a preallocated slot
+		uint32 ToSlot(uint32 Idx) const { return Idx % BufferSize; }
+
 		EntrySettings Settings;
 
-		TCircularBuffer<EntryTimeStamp> Timestamps;
+		uint32 BufferSize;
+		TArray<EntryTimeStamp> Timestamps;	// one per slot, sized exactly to BufferSize
 
 		uint32 ExternalIdx;	// Indexes to the last entry on a committed frame
 		uint32 InternalIdx;	// Indexes to where in-progress simulations should read/write (matches ExternalIdx when not mid-simulation, and advances if written during simulation)
+
+		bool bWrittenThisFrame = false;	// set on the first write of a sim frame, so the owning blackboard records this entry only once
+
+		friend class UJoltRollbackBlackboard;
 	};
 
 	template<typename EntryT>
@@ -189,15 +201,15 @@ private:
 		// TODO: consider what options need to be specified
 		BlackboardEntry(const EntrySettings& InSettings, uint32 InBufferSize, const EntryT* OptionalInitialObj=nullptr)
 			: BlackboardEntryBase(InSettings, InBufferSize)
-			, EntryBuffer(InBufferSize)
 		{
 			// JAH TODO: Consider making the initial object required, so we can also initialize where in the buffer we point to
 			if (OptionalInitialObj)
 			{
-				for (uint32 i = 0; i < EntryBuffer.Capacity(); i++)
-				{
-					EntryBuffer[i] = *OptionalInitialObj;
-				}
+				EntryBuffer.Init(*OptionalInitialObj, BufferSize);
+			}
+			else
+			{
+				EntryBuffer.SetNum(BufferSize);
 			}
 		}
 
@@ -206,7 +218,7 @@ private:
 		{
 			if (CanReadEntryAt(CurrentExternalTime, EEntryIndexType::External))
 			{
-				ValueOut = EntryBuffer[ExternalIdx];
+				ValueOut = EntryBuffer[ToSlot(ExternalIdx)];
 				return true;
 			}
 
@@ -218,7 +230,7 @@ private:
 		{
 			if (CanReadEntryAt(CurrentExternalTime, EEntryIndexType::External))
 			{ 
-				return &EntryBuffer[ExternalIdx];
+				return &EntryBuffer[ToSlot(ExternalIdx)];
 			}
 
 			return nullptr;
@@ -228,7 +240,7 @@ private:
 		{
 			if (CanReadEntryAt(InternalTime, EEntryIndexType::Internal))
 			{
-				ValueOut = EntryBuffer[InternalIdx];
+				ValueOut = EntryBuffer[ToSlot(InternalIdx)];
 				return true;
 			}
 
@@ -239,7 +251,7 @@ private:
 		{
 			if (CanReadEntryAt(InternalTime, EEntryIndexType::Internal))
 			{
-				return &EntryBuffer[InternalIdx];
+				return &EntryBuffer[ToSlot(InternalIdx)];
 			}
 
 			return nullptr;
@@ -249,14 +261,13 @@ private:
 		{
 			InternalIdx = ExternalIdx + 1;	// always writing internal, one slot ahead of external slot
 
-			EntryBuffer[InternalIdx] = Value;
-			Timestamps[InternalIdx] = TimeStamp;
+			EntryBuffer[ToSlot(InternalIdx)] = Value;
+			Timestamps[ToSlot(InternalIdx)] = TimeStamp;
 		}
 
-	
-		// TODO: Consider whether these need to be TCircularBuffers, or whether a TArray would be just fine.  TCircularBuffers round up to the next power of 2 in capacity, so may be wasting significant memory for larger structures.
-		// Note that these EntryBuffer is always the same capacity as Timestamps
-		TCircularBuffer<EntryT> EntryBuffer;
+
+		// Note that EntryBuffer is always the same size as Timestamps
+		TArray<EntryT> EntryBuffer;
 
 
 	};	// end BlackboardEntry
@@ -337,6 +348,7 @@ private:
 		if (BlackboardEntry<EntryT>* Entry = static_cast<BlackboardEntry<EntryT>*>(FindEntry(ObjName)))
 		{
 			Entry->SetEntryValue_Internal(Obj, InProgressSimTimeStamp);
+			OnEntryWritten_Internal(*Entry);
 			return true;
 		}
 
@@ -384,6 +396,9 @@ private:
 	}
 
 
+	// Records the entry so frame end / rollback only need to visit entries that were actually written
+	UE_API void OnEntryWritten_Internal(BlackboardEntryBase& Entry);
+
 private:
 	UE_API void BeginSimulationFrame(const FJoltMoverTimeStep& PendingTimeStep);
 	UE_API void EndSimulationFrame();
@@ -396,6 +411,18 @@ private:
 	
 	TMap<FName, TUniquePtr<BlackboardEntryBase>> EntryMap;
 
+	// Entries written during the in-progress sim frame, committed at EndSimulationFrame
+	TArray<BlackboardEntryBase*> EntriesWrittenThisFrame;
+
+	struct RollbackJournalRecord
+	{
+		uint32 Frame;
+		BlackboardEntryBase* Entry;
+	};
+
+	// Rollback-sensitive writes in frame order. Rolling back to frame N only revisits the records with Frame >= N.
+	TArray<RollbackJournalRecord> RollbackJournal;
+
 
 	bool bIsSimulationInProgress = false;
 	bool bIsResimulating = false;
@@ -23,7 +23,7 @@ void UJoltNetworkPredictionComponent::InitializeComponent()
 		// Init RepProxies
 		ReplicationProxy_ServerRPC.Init(&NetworkPredictionProxy, EJoltReplicationProxyTarget::ServerRPC);
 		ReplicationProxy_Autonomous.Init(&NetworkPredictionProxy, EJoltReplicationProxyTarget::AutonomousProxy);
-		ReplicationProxy_Simulated.Init(&NetworkPredictionProxy, EJoltReplicationProxyTarget::SimulatedProxy);
+		ReplicationProxy_Simulated.Init(&NetworkPredictionProxy, EJoltReplicationProxyTarget::SimulatedProxy, GetOwner());
 		ReplicationProxy_Replay.Init(&NetworkPredictionProxy, EJoltReplicationProxyTarget::Replay);
 
 		InitializeNetworkPredictionProxy();
@@ -7,6 +7,12 @@
 #include "Engine/NetConnection.h"
 #include "EngineUtils.h"
 #include "UObject/UObjectIterator.h"
+#include "Containers/SortedMap.h"
+#include "Containers/SparseArray.h"
+#include "HAL/PlatformTime.h"
+#include "JoltNetworkPredictionLog.h"
+#include "JoltNetworkPredictionReplicationProxy.h"
+#include "Services/JoltNetworkPredictionInstanceMap.h"
 
 namespace JoltNetworkPredictionDebug
 {
@@ -138,3 +144,252 @@ FAutoConsoleCommandWithWorldAndArgs DrawServerPrimitivesCmd(TEXT("j.np.Debug.Dra
 		}
 	});
 }));
+
+// -------------------------------------------------------------------------------------------------------
+//	Instance map benchmark: compares TJoltInstanceMap against the previous SortedMap + SparseArray layout.
+//	Usage: j.np.Debug.BenchmarkInstanceMap [NumInstances=4096] [NumLookupPasses=64]
+// -------------------------------------------------------------------------------------------------------
+
+namespace JoltNetworkPredictionDebug
+{
+	// Roughly the size of a frame state entry, so iteration cost is representative
+	struct FBenchmarkInstanceData
+	{
+		uint8 Payload[256];
+		int32 Value = 0;
+	};
+
+	// The layout TJoltInstanceMap used before switching to dense storage, kept here as the benchmark baseline
+	struct FSortedSparseInstanceMap
+	{
+		int32 GetIndex(int32 ID)
+		{
+			int32& Idx = Lookup.FindOrAdd(ID, INDEX_NONE);
+			if (Idx == INDEX_NONE)
+			{
+				FSparseArrayAllocationInfo AllocationInfo = Data.AddUninitializedAtLowestFreeIndex(LastFreeIndex);
+				Idx = AllocationInfo.Index;
+				new (AllocationInfo.Pointer) FBenchmarkInstanceData();
+			}
+			return Idx;
+		}
+
+		int32 GetIndexChecked(int32 ID) { return Lookup.FindChecked(ID); }
+		FBenchmarkInstanceData& GetByIndexChecked(int32 Idx) { return Data[Idx]; }
+
+		void Remove(int32 ID)
+		{
+			int32 Idx = INDEX_NONE;
+			if (Lookup.RemoveAndCopyValue(ID, Idx))
+			{
+				Data.RemoveAt(Idx);
+				LastFreeIndex = FMath::Min(LastFreeIndex, Idx);
+			}
+		}
+
+		TSortedMap<int32, int32> Lookup;
+		TSparseArray<FBenchmarkInstanceData> Data;
+		int32 LastFreeIndex = 0;
+	};
+
+	struct FInstanceMapTimings
+	{
+		double RegisterMs = 0.0;
+		double LookupMs = 0.0;
+		double UnregisterMs = 0.0;
+		int64 Checksum = 0;
+	};
+
+	template<typename RegisterFuncT, typename LookupFuncT, typename UnregisterFuncT>
+	FInstanceMapTimings RunInstanceMapBenchmark(const TArray<int32>& IDs, int32 NumLookupPasses, RegisterFuncT&& Register, LookupFuncT&& Lookup, UnregisterFuncT&& Unregister)
+	{
+		FInstanceMapTimings Timings;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 ID : IDs)
+		{
+			Register(ID);
+		}
+		Timings.RegisterMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumLookupPasses; ++Pass)
+		{
+			for (int32 ID : IDs)
+			{
+				Timings.Checksum += Lookup(ID);
+			}
+		}
+		Timings.LookupMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// Unregister every other instance first so removals land in the middle of the storage
+		Start = FPlatformTime::Seconds();
+		for (int32 Parity = 0; Parity < 2; ++Parity)
+		{
+			for (int32 i = Parity; i < IDs.Num(); i += 2)
+			{
+				Unregister(IDs[i]);
+			}
+		}
+		Timings.UnregisterMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		return Timings;
+	}
+}
+
+FAutoConsoleCommandWithWorldAndArgs BenchmarkInstanceMapCmd(TEXT("j.np.Debug.BenchmarkInstanceMap"), TEXT("Times register/lookup/unregister on the instance map. Args: [NumInstances=4096] [NumLookupPasses=64]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray< FString >& Args, UWorld* World) 
+{
+	using namespace JoltNetworkPredictionDebug;
+
+	const int32 NumInstances = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 4096;
+	const int32 NumLookupPasses = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 64;
+
+	// Spawn IDs arrive out of order in practice (server and client assigned IDs interleave)
+	TArray<int32> IDs;
+	IDs.Reserve(NumInstances);
+	FRandomStream Stream(NumInstances);
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		IDs.Add(i + 1);
+	}
+	for (int32 i = IDs.Num() - 1; i > 0; --i)
+	{
+		IDs.Swap(i, Stream.RandRange(0, i));
+	}
+
+	FSortedSparseInstanceMap SortedMap;
+	const FInstanceMapTimings SortedTimings = RunInstanceMapBenchmark(IDs, NumLookupPasses,
+		[&](int32 ID) { SortedMap.GetByIndexChecked(SortedMap.GetIndex(ID)).Value = ID; },
+		[&](int32 ID) { return SortedMap.GetByIndexChecked(SortedMap.GetIndexChecked(ID)).Value; },
+		[&](int32 ID) { SortedMap.Remove(ID); });
+
+	TJoltInstanceMap<FBenchmarkInstanceData> DenseMap;
+	const FInstanceMapTimings DenseTimings = RunInstanceMapBenchmark(IDs, NumLookupPasses,
+		[&](int32 ID) { DenseMap.FindOrAdd(FJoltNetworkPredictionID(ID, 0)).Value = ID; },
+		[&](int32 ID) { return DenseMap.GetByIndexChecked(DenseMap.GetIndexChecked(FJoltNetworkPredictionID(ID, 0))).Value; },
+		[&](int32 ID) { DenseMap.Remove(FJoltNetworkPredictionID(ID, 0)); });
+
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("InstanceMap benchmark: %d instances, %d lookup passes"), NumInstances, NumLookupPasses);
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("  SortedMap+SparseArray: Register %.3fms  Lookup %.3fms  Unregister %.3fms  (checksum %lld)"),
+		SortedTimings.RegisterMs, SortedTimings.LookupMs, SortedTimings.UnregisterMs, SortedTimings.Checksum);
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("  Dense:                 Register %.3fms  Lookup %.3fms  Unregister %.3fms  (checksum %lld)"),
+		DenseTimings.RegisterMs, DenseTimings.LookupMs, DenseTimings.UnregisterMs, DenseTimings.Checksum);
+}));
+
+// Compares the bits sent per tick by one RPC per input command against the packed input stream, for synthetic inputs that
+// change a byte now and then (held buttons, steady movement). Bunch and RPC headers are not counted, the packed stream saves
+// WindowSize-1 of those per tick on top of what is reported.
+FAutoConsoleCommandWithWorldAndArgs BenchmarkInputStreamCmd(TEXT("j.np.Debug.BenchmarkInputStream"), TEXT("Bits and time per tick of per-frame input RPCs vs the packed input stream. Args: [PayloadBits=96] [NumSims=1] [WindowSize=6] [ChangeChance=0.2] [NumTicks=2000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray< FString >& Args, UWorld* World) 
+{
+	const int32 PayloadBits = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 4096) : 96;
+	const int32 NumSims = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 64) : 1;
+	const int32 WindowSize = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 1, 32) : 6;
+	const float ChangeChance = Args.Num() > 3 ? FMath::Clamp(FCString::Atof(*Args[3]), 0.f, 1.f) : 0.2f;
+	const int32 NumTicks = Args.Num() > 4 ? FMath::Max(FCString::Atoi(*Args[4]), WindowSize) : 2000;
+
+	FRandomStream Stream(PayloadBits * 31 + NumSims);
+	const int32 PayloadBytes = FMath::DivideAndRoundUp(PayloadBits, 8);
+	const uint8 TailMask = (PayloadBits & 7) ? (uint8)((1u << (PayloadBits & 7)) - 1) : 0xFF;
+
+	// Input history, one frame per tick
+	TArray<FJoltInputStreamFrame> History;
+	History.SetNum(NumTicks);
+	for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+	{
+		FJoltInputStreamFrame& Frame = History[Tick];
+		Frame.Frame = Tick;
+		Frame.InterpolationTimeMS = Tick * 16.f;
+		for (int32 Sim = 0; Sim < NumSims; ++Sim)
+		{
+			TArray<uint8> Payload;
+			if (Tick == 0)
+			{
+				Payload.SetNumUninitialized(PayloadBytes);
+				for (uint8& Byte : Payload)
+				{
+					Byte = (uint8)Stream.RandHelper(256);
+				}
+			}
+			else
+			{
+				const FJoltInputPayload& Previous = History[Tick - 1].Inputs[Sim].InputData;
+				Payload = TArray<uint8>(Previous.GetData(), Previous.Num());
+				if (Stream.FRand() < ChangeChance)
+				{
+					Payload[Stream.RandHelper(PayloadBytes)] ^= (uint8)(1 + Stream.RandHelper(255));
+				}
+			}
+			Payload.Last() &= TailMask;
+			Frame.Inputs.Add(FJoltSimulationReplicatedInput(Sim + 1, PayloadBits, Payload));
+		}
+	}
+
+	int64 LegacyBits = 0;
+	int64 PackedBits = 0;
+	double LegacySeconds = 0.0;
+	double EncodeSeconds = 0.0;
+	double DecodeSeconds = 0.0;
+	int32 NumMismatches = 0;
+	FJoltInputStreamArena SendArena;
+	FJoltInputStreamArena ReceiveArena;
+	FJoltPackedInputStream Packed;
+	FJoltPackedInputStream Received;
+
+	for (int32 Tick = WindowSize - 1; Tick < NumTicks; ++Tick)
+	{
+		const TConstArrayView<FJoltInputStreamFrame> Window = MakeArrayView(History).Slice(Tick - WindowSize + 1, WindowSize);
+
+		double Start = FPlatformTime::Seconds();
+		for (const FJoltInputStreamFrame& Frame : Window)
+		{
+			// Server_ReceivedInput parameters
+			FBitWriter Writer(0, true);
+			int32 FrameNumber = Frame.Frame;
+			float InterpolationTimeMS = Frame.InterpolationTimeMS;
+			Writer << FrameNumber << InterpolationTimeMS;
+			uint32 NumInputs = Frame.Inputs.Num();
+			Writer.SerializeIntPacked(NumInputs);
+			for (const FJoltSimulationReplicatedInput& Input : Frame.Inputs)
+			{
+				bool bSuccess = true;
+				const_cast<FJoltSimulationReplicatedInput&>(Input).NetSerialize(Writer, nullptr, bSuccess);
+			}
+			LegacyBits += Writer.GetNumBits();
+		}
+		LegacySeconds += FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		Packed.Encode(Window, SendArena);
+		FBitWriter Writer(0, true);
+		bool bSuccess = true;
+		Packed.NetSerialize(Writer, nullptr, bSuccess);
+		EncodeSeconds += FPlatformTime::Seconds() - Start;
+		PackedBits += Writer.GetNumBits();
+
+		Start = FPlatformTime::Seconds();
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		Received.NetSerialize(Reader, nullptr, bSuccess);
+		ReceiveArena.Reset();
+		const bool bDecoded = Received.Decode(ReceiveArena);
+		const TConstArrayView<FJoltInputStreamFrame> Decoded = ReceiveArena.GetFrames();
+		DecodeSeconds += FPlatformTime::Seconds() - Start;
+
+		bool bMatches = bDecoded && Decoded.Num() == Window.Num();
+		for (int32 i = 0; bMatches && i < Window.Num(); ++i)
+		{
+			bMatches = Decoded[i].Frame == Window[i].Frame && Decoded[i].Inputs.Num() == Window[i].Inputs.Num();
+			for (int32 j = 0; bMatches && j < Window[i].Inputs.Num(); ++j)
+			{
+				bMatches = Decoded[i].Inputs[j].ID == Window[i].Inputs[j].ID && Decoded[i].Inputs[j].InputData == Window[i].Inputs[j].InputData;
+			}
+		}
+		NumMismatches += bMatches ? 0 : 1;
+	}
+
+	const int32 NumSends = NumTicks - WindowSize + 1;
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("InputStream benchmark: %d sims, %d bit inputs, window %d, change chance %.2f, %d ticks"), NumSims, PayloadBits, WindowSize, ChangeChance, NumSends);
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("  Per-frame RPCs: %d RPCs, %.1f bits per tick, %.3fus serialize"), WindowSize, (double)LegacyBits / NumSends, LegacySeconds * 1e6 / NumSends);
+	UE_LOG(LogJoltNetworkPrediction, Display, TEXT("  Packed stream:  1 RPC, %.1f bits per tick, %.3fus encode, %.3fus decode, %d mismatches"), (double)PackedBits / NumSends, EncodeSeconds * 1e6 / NumSends, DecodeSeconds * 1e6 / NumSends, NumMismatches);
+}));
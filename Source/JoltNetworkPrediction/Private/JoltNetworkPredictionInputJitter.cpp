@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JoltNetworkPredictionInputJitter.h"
+#include "JoltNetworkPredictionSettings.h"
+#include "JoltNetworkPredictionLog.h"
+
+// RFC 3550 jitter gain, and the gain of the loss rate per expected packet
+static constexpr float JitterGain = 1.f / 16.f;
+static constexpr float LossGain = 1.f / 32.f;
+
+// Gain of the buffered depth average, per fixed tick
+static constexpr float DepthGain = 0.1f;
+
+void FJoltInputJitterBuffer::SyncSettings(const FJoltNetworkPredictionSettings& Settings)
+{
+	bEnabled = Settings.bAdaptiveInputBuffer;
+	MinDepth = FMath::Max(Settings.AdaptiveInputBufferMinDepth, 1);
+	MaxDepth = FMath::Max(Settings.AdaptiveInputBufferMaxDepth, MinDepth);
+	JitterMultiplier = FMath::Max(Settings.AdaptiveInputBufferJitterMultiplier, 0.f);
+	ShrinkDelaySeconds = FMath::Max(Settings.AdaptiveInputBufferShrinkDelaySeconds, 0.f);
+	DesiredDepth = FMath::Clamp(DesiredDepth, MinDepth, MaxDepth);
+}
+
+void FJoltInputJitterBuffer::OnPacketReceived(int32 NewestFrame, double ArrivalTimeSeconds, float InFixedStepMS)
+{
+	// Duplicates and reordered packets bring nothing new
+	if (NewestFrame <= LastNewestFrame || InFixedStepMS <= 0.f)
+	{
+		return;
+	}
+	FixedStepMS = InFixedStepMS;
+
+	const double TransitMS = ArrivalTimeSeconds * 1000.0 - (double)NewestFrame * FixedStepMS;
+	if (LastNewestFrame != INDEX_NONE)
+	{
+		JitterMS += ((float)FMath::Abs(TransitMS - LastTransitMS) - JitterMS) * JitterGain;
+
+		// One packet is sent per client frame
+		const int32 LostPackets = NewestFrame - LastNewestFrame - 1;
+		for (int32 i = 0; i < FMath::Min(LostPackets, 32); ++i)
+		{
+			LossRate += (1.f - LossRate) * LossGain;
+		}
+		LossRate -= LossRate * LossGain;
+
+		if (LostPackets > 0)
+		{
+			RecentBurstFrames = FMath::Max(RecentBurstFrames, LostPackets);
+			LastBurstTime = ArrivalTimeSeconds;
+		}
+	}
+
+	LastNewestFrame = NewestFrame;
+	LastTransitMS = TransitMS;
+}
+
+void FJoltInputJitterBuffer::OnFrameConsumed(int32 BufferedFrames, double TimeSeconds)
+{
+	SmoothedDepth += ((float)BufferedFrames - SmoothedDepth) * DepthGain;
+
+	if (RecentBurstFrames > 0 && TimeSeconds - LastBurstTime > ShrinkDelaySeconds)
+	{
+		RecentBurstFrames = 0;
+	}
+	UpdateDesiredDepth(TimeSeconds);
+}
+
+void FJoltInputJitterBuffer::OnStarved(double TimeSeconds)
+{
+	++NumStarvations;
+	if (DesiredDepth < MaxDepth)
+	{
+		++DesiredDepth;
+		UE_LOG(LogJoltNetworkPrediction, Verbose, TEXT("Input buffer starved, desired depth raised to %d (jitter %.1fms, loss %.1f%%)"), DesiredDepth, JitterMS, LossRate * 100.f);
+	}
+	LastDepthChangeTime = TimeSeconds;
+}
+
+int32 FJoltInputJitterBuffer::GetBufferOffset() const
+{
+	return FMath::RoundToInt32(SmoothedDepth) - DesiredDepth;
+}
+
+void FJoltInputJitterBuffer::UpdateDesiredDepth(double TimeSeconds)
+{
+	if (FixedStepMS <= 0.f)
+	{
+		return;
+	}
+
+	const int32 JitterFrames = FMath::CeilToInt32(JitterMultiplier * JitterMS / FixedStepMS);
+	const int32 TargetDepth = FMath::Clamp(MinDepth + JitterFrames + RecentBurstFrames, MinDepth, MaxDepth);
+	if (TargetDepth > DesiredDepth)
+	{
+		DesiredDepth = TargetDepth;
+		LastDepthChangeTime = TimeSeconds;
+	}
+	else if (TargetDepth < DesiredDepth && TimeSeconds - LastDepthChangeTime >= ShrinkDelaySeconds)
+	{
+		--DesiredDepth;
+		LastDepthChangeTime = TimeSeconds;
+	}
+}
+
+void FJoltInputJitterBuffer::Reset()
+{
+	LastNewestFrame = INDEX_NONE;
+	LastTransitMS = 0.0;
+	JitterMS = 0.f;
+	LossRate = 0.f;
+	RecentBurstFrames = 0;
+	LastBurstTime = 0.0;
+	DesiredDepth = MinDepth;
+	SmoothedDepth = 0.f;
+	LastDepthChangeTime = 0.0;
+	NumStarvations = 0;
+}
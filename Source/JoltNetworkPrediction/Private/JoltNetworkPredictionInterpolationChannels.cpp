@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JoltNetworkPredictionInterpolationChannels.h"
+
+void FJoltInterpolationChannelBuffer::SetNum(int32 InNum)
+{
+	NumSlots = InNum;
+	if (NumSlots <= Capacity)
+	{
+		return;
+	}
+
+	// Streams are laid out by component, so growing moves every stream to its new offset
+	const int32 NewCapacity = FMath::RoundUpToPowerOfTwo(FMath::Max(NumSlots, 16));
+	TArray<double>* Buffers[] = { &FromData, &DeltaData, &OutData };
+	for (TArray<double>* Buffer : Buffers)
+	{
+		TArray<double> Grown;
+		Grown.SetNumZeroed(NewCapacity * NumComponents);
+		for (int32 Component = 0; Component < NumComponents && Capacity > 0; ++Component)
+		{
+			FMemory::Memcpy(Grown.GetData() + Component * NewCapacity, Buffer->GetData() + Component * Capacity, Capacity * sizeof(double));
+		}
+		*Buffer = MoveTemp(Grown);
+	}
+	Capacity = NewCapacity;
+}
+
+void FJoltInterpolationChannelBuffer::SetWindow(int32 Slot, const FJoltInterpolationChannels& From, const FJoltInterpolationChannels& To)
+{
+	check(Slot >= 0 && Slot < NumSlots);
+
+	// Shortest arc: q and -q are the same rotation
+	const FQuat ToRotation = (From.Rotation | To.Rotation) < 0.0 ? -To.Rotation : To.Rotation;
+
+	const double FromValues[NumComponents] =
+	{
+		From.Location.X, From.Location.Y, From.Location.Z,
+		From.Rotation.X, From.Rotation.Y, From.Rotation.Z, From.Rotation.W,
+		From.LinearVelocity.X, From.LinearVelocity.Y, From.LinearVelocity.Z,
+		From.AngularVelocity.X, From.AngularVelocity.Y, From.AngularVelocity.Z,
+	};
+	const double ToValues[NumComponents] =
+	{
+		To.Location.X, To.Location.Y, To.Location.Z,
+		ToRotation.X, ToRotation.Y, ToRotation.Z, ToRotation.W,
+		To.LinearVelocity.X, To.LinearVelocity.Y, To.LinearVelocity.Z,
+		To.AngularVelocity.X, To.AngularVelocity.Y, To.AngularVelocity.Z,
+	};
+
+	for (int32 Component = 0; Component < NumComponents; ++Component)
+	{
+		Stream(FromData, Component)[Slot] = FromValues[Component];
+		Stream(DeltaData, Component)[Slot] = ToValues[Component] - FromValues[Component];
+	}
+}
+
+void FJoltInterpolationChannelBuffer::Interpolate(float PCT)
+{
+	if (NumSlots == 0)
+	{
+		return;
+	}
+
+	const double Alpha = FMath::Clamp((double)PCT, 0.0, 1.0);
+
+	// Slots past NumSlots hold stale data but are harmless to blend, so every stream goes through as one flat loop
+	const int32 NumValues = Capacity * NumComponents;
+	const double* RESTRICT From = FromData.GetData();
+	const double* RESTRICT Delta = DeltaData.GetData();
+	double* RESTRICT Out = OutData.GetData();
+	for (int32 i = 0; i < NumValues; ++i)
+	{
+		Out[i] = From[i] + Delta[i] * Alpha;
+	}
+
+	double* RESTRICT X = Stream(OutData, RotX);
+	double* RESTRICT Y = Stream(OutData, RotY);
+	double* RESTRICT Z = Stream(OutData, RotZ);
+	double* RESTRICT W = Stream(OutData, RotW);
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		const double SizeSquared = X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i] + W[i] * W[i];
+		const double Scale = SizeSquared > UE_DOUBLE_SMALL_NUMBER ? FMath::InvSqrt(SizeSquared) : 0.0;
+		X[i] *= Scale;
+		Y[i] *= Scale;
+		Z[i] *= Scale;
+		W[i] = SizeSquared > UE_DOUBLE_SMALL_NUMBER ? W[i] * Scale : 1.0;
+	}
+}
+
+void FJoltInterpolationChannelBuffer::GetResult(int32 Slot, FJoltInterpolationChannels& Out) const
+{
+	check(Slot >= 0 && Slot < NumSlots);
+
+	Out.Location.Set(Stream(OutData, LocX)[Slot], Stream(OutData, LocY)[Slot], Stream(OutData, LocZ)[Slot]);
+	Out.Rotation = FQuat(Stream(OutData, RotX)[Slot], Stream(OutData, RotY)[Slot], Stream(OutData, RotZ)[Slot], Stream(OutData, RotW)[Slot]);
+	Out.LinearVelocity.Set(Stream(OutData, LinX)[Slot], Stream(OutData, LinY)[Slot], Stream(OutData, LinZ)[Slot]);
+	Out.AngularVelocity.Set(Stream(OutData, AngX)[Slot], Stream(OutData, AngY)[Slot], Stream(OutData, AngZ)[Slot]);
+}
@@ -4,6 +4,7 @@
 #include "JoltNetworkPredictionPlayerControllerComponent.h"
 
 #include "JoltNetworkPredictionWorldManager.h"
+#include "JoltNetworkPredictionLog.h"
 
 
 // Sets default values for this component's properties
@@ -71,6 +72,53 @@ void UJoltNetworkPredictionPlayerControllerComponent::SendServerRpc(const int32&
 	InputsToSend.Reset();
 }
 
+void UJoltNetworkPredictionPlayerControllerComponent::QueueInputStreamFrame(const int32& Frame)
+{
+	FJoltInputStreamFrame& StreamFrame = InputStreamArena.AddFrame();
+	StreamFrame.Frame = Frame;
+	StreamFrame.InterpolationTimeMS = InterpolationTimeMS;
+	StreamFrame.Inputs.Append(InputsToSend);
+	InputsToSend.Reset();
+}
+
+void UJoltNetworkPredictionPlayerControllerComponent::SendInputStream()
+{
+	if (InputStreamArena.GetFrames().Num() > 0)
+	{
+		OutgoingInputStream.Encode(InputStreamArena.GetFrames(), InputStreamArena);
+		Server_ReceivedInputStream(OutgoingInputStream);
+		InputStreamArena.Reset();
+	}
+}
+
+void UJoltNetworkPredictionPlayerControllerComponent::Server_ReceivedInputStream_Implementation(const FJoltPackedInputStream& Stream)
+{
+	UJoltNetworkPredictionWorldManager* Manager = GetWorld()->GetSubsystem<UJoltNetworkPredictionWorldManager>();
+	if (!Manager)
+	{
+		return;
+	}
+
+	InputStreamArena.Reset();
+	if (!Stream.Decode(InputStreamArena))
+	{
+		UE_LOG(LogJoltNetworkPrediction, Warning, TEXT("Malformed input stream received from %s"), *GetNameSafe(GetOwner()));
+		InputStreamArena.Reset();
+		return;
+	}
+	if (InputStreamArena.GetFrames().Num() > 0)
+	{
+		InputJitter.OnPacketReceived(InputStreamArena.GetFrames().Last().Frame, FPlatformTime::Seconds(), Manager->GetFixedTickState().FixedStepRealTimeMS);
+	}
+
+	// Oldest first, frames the server already has are eaten by OnInputReceived
+	for (const FJoltInputStreamFrame& StreamFrame : InputStreamArena.GetFrames())
+	{
+		Manager->OnInputReceived(StreamFrame.Frame, StreamFrame.InterpolationTimeMS, StreamFrame.Inputs, this);
+	}
+	InputStreamArena.Reset();
+}
+
 void UJoltNetworkPredictionPlayerControllerComponent::SendAckedFrames(const FJoltSerializedAckedFrames& AckedFrames)
 {
 	Server_ReceivedAckedFrames(AckedFrames);
@@ -106,6 +154,7 @@ void UJoltNetworkPredictionPlayerControllerComponent::Server_ReceivedInput_Imple
 	}*/
 	if (Manager)
 	{
+		InputJitter.OnPacketReceived(Frame, FPlatformTime::Seconds(), Manager->GetFixedTickState().FixedStepRealTimeMS);
 		Manager->OnInputReceived(Frame,InInterpolationTime,Inputs,this);
 	}
 }
@@ -149,6 +198,31 @@ void UJoltNetworkPredictionPlayerControllerComponent::AdvanceLastConsumedFrame(c
 	{
 		return;
 	}
+	if (InputJitter.IsEnabled())
+	{
+		const double Now = FPlatformTime::Seconds();
+		const int32 DesiredDepth = InputJitter.GetDesiredDepth();
+		if (LastConsumedFrame == INDEX_NONE)
+		{
+			LastConsumedFrame = FMath::Max(LastReceivedFrame - DesiredDepth, 0);
+		}
+		else if (LastConsumedFrame >= LastReceivedFrame)
+		{
+			// Repeat the last command instead of stepping back over consumed ones. The buffer gains a frame, time dilation
+			// brings the client back to the (now deeper) desired depth.
+			InputJitter.OnStarved(Now);
+		}
+		else if (LastReceivedFrame - LastConsumedFrame > FMath::Max(DesiredDepth, MaxBufferSize))
+		{
+			LastConsumedFrame = LastReceivedFrame - DesiredDepth;
+		}
+		else
+		{
+			LastConsumedFrame++;
+		}
+		InputJitter.OnFrameConsumed(LastReceivedFrame - LastConsumedFrame, Now);
+		return;
+	}
 	if (LastConsumedFrame >= LastReceivedFrame)
 	{
 		//ToDo Log input starvation.
@@ -165,7 +239,7 @@ void UJoltNetworkPredictionPlayerControllerComponent::AdvanceLastConsumedFrame(c
 }
 
 void UJoltNetworkPredictionPlayerControllerComponent::AddInputToSend(const int32& ID, const uint32& DataSize,
-	const TArray<uint8>& Data)
+	const FJoltInputPayload& Data)
 {
 	InputsToSend.Add(FJoltSimulationReplicatedInput(ID, DataSize,Data));
 }
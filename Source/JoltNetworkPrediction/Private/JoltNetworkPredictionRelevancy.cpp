@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JoltNetworkPredictionRelevancy.h"
+#include "JoltNetworkPredictionSettings.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetConnection.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(JoltNetworkPredictionRelevancy)
+
+TRACE_DECLARE_INT_COUNTER(JoltNPSimProxyUpdatesSent, TEXT("JoltNetworkPrediction/SimProxy/UpdatesSent"));
+TRACE_DECLARE_INT_COUNTER(JoltNPSimProxyUpdatesSkipped, TEXT("JoltNetworkPrediction/SimProxy/UpdatesSkipped"));
+
+namespace JoltNetPrecision
+{
+	static thread_local EJoltNetPrecision CurrentPrecision = EJoltNetPrecision::Full;
+
+	EJoltNetPrecision Get()
+	{
+		return CurrentPrecision;
+	}
+
+	FScope::FScope(EJoltNetPrecision Precision)
+		: Previous(CurrentPrecision)
+	{
+		CurrentPrecision = Precision;
+	}
+
+	FScope::~FScope()
+	{
+		CurrentPrecision = Previous;
+	}
+}
+
+// Proxies that have not been sent to a connection for this long are dropped from its state (unregistered or no longer relevant)
+static constexpr double StaleSendTimeSeconds = 10.0;
+
+void FJoltSimProxyRelevancy::SyncSettings(const FJoltNetworkPredictionSettings& Settings)
+{
+	Bands = Settings.SimulatedProxyLODBands;
+	Bands.Sort([](const FJoltSimProxyLODBand& A, const FJoltSimProxyLODBand& B) { return A.MaxDistance < B.MaxDistance; });
+	bEnabled = Settings.bEnableSimulatedProxyLOD && Bands.Num() > 0;
+
+	BandMaxDistSquared.Reset(Bands.Num());
+	for (const FJoltSimProxyLODBand& Band : Bands)
+	{
+		BandMaxDistSquared.Add(FMath::Square(Band.MaxDistance));
+	}
+}
+
+const FJoltSimProxyLODBand& FJoltSimProxyRelevancy::FindBand(float DistSquared) const
+{
+	for (int32 i = 0; i < BandMaxDistSquared.Num(); ++i)
+	{
+		if (DistSquared <= BandMaxDistSquared[i])
+		{
+			return Bands[i];
+		}
+	}
+	return Bands.Last();
+}
+
+bool FJoltSimProxyRelevancy::ShouldSend(const UNetConnection* Connection, const AActor* Actor, int32 ID, EJoltNetPrecision& OutPrecision)
+{
+	OutPrecision = EJoltNetPrecision::Full;
+	if (!bEnabled || !Connection || !Actor)
+	{
+		return true;
+	}
+
+	// Without a view target there is nothing to measure against, treat it as close
+	const AActor* Viewer = Connection->ViewTarget;
+	if (!Viewer)
+	{
+		return true;
+	}
+
+	const FJoltSimProxyLODBand& Band = FindBand(FVector::DistSquared(Viewer->GetActorLocation(), Actor->GetActorLocation()));
+	OutPrecision = Band.Precision;
+
+	const double Now = FPlatformTime::Seconds();
+	double& LastSendTime = Connections.FindOrAdd(Connection).LastSendTimes.FindOrAdd(ID, 0.0);
+	if (Band.UpdateRateHz > 0.f && (Now - LastSendTime) < 1.0 / Band.UpdateRateHz)
+	{
+		++Stats.Skipped;
+		TRACE_COUNTER_INCREMENT(JoltNPSimProxyUpdatesSkipped);
+		return false;
+	}
+
+	LastSendTime = Now;
+	++Stats.Sent[(int32)OutPrecision];
+	TRACE_COUNTER_INCREMENT(JoltNPSimProxyUpdatesSent);
+	return true;
+}
+
+void FJoltSimProxyRelevancy::Prune(double CurrentTime)
+{
+	for (auto It = Connections.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		for (auto SendIt = It.Value().LastSendTimes.CreateIterator(); SendIt; ++SendIt)
+		{
+			if (CurrentTime - SendIt.Value() > StaleSendTimeSeconds)
+			{
+				SendIt.RemoveCurrent();
+			}
+		}
+	}
+}
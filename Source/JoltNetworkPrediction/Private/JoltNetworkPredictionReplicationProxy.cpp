@@ -2,7 +2,9 @@
 
 #include "JoltNetworkPredictionReplicationProxy.h"
 #include "JoltNetworkPredictionProxy.h"
+#include "JoltNetworkPredictionWorldManager.h"
 #include "Engine/NetConnection.h"
+#include "Engine/PackageMapClient.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltNetworkPredictionReplicationProxy)
 
@@ -10,33 +12,79 @@
 //	FJoltReplicationProxy
 // -------------------------------------------------------------------------------------------------------------------------------
 
-void FJoltReplicationProxy::Init(FJoltNetworkPredictionProxy* InJoltNetSimProxy, EJoltReplicationProxyTarget InReplicationTarget)
+void FJoltReplicationProxy::Init(FJoltNetworkPredictionProxy* InJoltNetSimProxy, EJoltReplicationProxyTarget InReplicationTarget, const AActor* InOwner)
 {
 	JoltNetSimProxy = InJoltNetSimProxy;
 	ReplicationTarget = InReplicationTarget;
+	Owner = InOwner;
 }
 
 bool FJoltReplicationProxy::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
 	if (jnpEnsureMsgf(NetSerializeFunc, TEXT("NetSerializeFunc not set for FJoltReplicationProxy %d"), ReplicationTarget))
 	{
-		NetSerializeFunc(FJoltNetSerializeParams(Ar,Map,ReplicationTarget));
+		if (ReplicationTarget == EJoltReplicationProxyTarget::SimulatedProxy)
+		{
+			NetSerializeSimulatedProxy(Ar, Map);
+		}
+		else
+		{
+			NetSerializeFunc(FJoltNetSerializeParams(Ar,Map,ReplicationTarget));
+		}
 		return true;
 	}
 	return true;
 }
 
+void FJoltReplicationProxy::NetSerializeSimulatedProxy(FArchive& Ar, UPackageMap* Map)
+{
+	FJoltNetSerializeParams Params(Ar, Map, ReplicationTarget);
+
+	bool bHasUpdate = true;
+	uint32 Precision = (uint32)EJoltNetPrecision::Full;
+	if (Ar.IsSaving())
+	{
+		UJoltNetworkPredictionWorldManager* WorldManager = JoltNetSimProxy ? JoltNetSimProxy->GetWorldManager() : nullptr;
+		const UPackageMapClient* PackageMapClient = Cast<UPackageMapClient>(Map);
+		if (WorldManager && PackageMapClient)
+		{
+			EJoltNetPrecision SendPrecision = EJoltNetPrecision::Full;
+			bHasUpdate = WorldManager->GetSimProxyRelevancy().ShouldSend(PackageMapClient->GetConnection(), Owner.Get(), JoltNetSimProxy->GetID(), SendPrecision);
+			Precision = (uint32)SendPrecision;
+		}
+	}
+
+	Ar.SerializeBits(&bHasUpdate, 1);
+	if (!bHasUpdate)
+	{
+		bSkippedSend = true;
+		return;
+	}
+
+	Ar.SerializeInt(Precision, (uint32)EJoltNetPrecision::Low + 1);
+	Params.Precision = (EJoltNetPrecision)FMath::Min(Precision, (uint32)EJoltNetPrecision::Low);
+
+	JoltNetPrecision::FScope PrecisionScope(Params.Precision);
+	NetSerializeFunc(Params);
+}
+
 void FJoltReplicationProxy::OnPreReplication()
 {
 	if (JoltNetSimProxy)
 	{
 		CachedPendingFrame = JoltNetSimProxy->GetPendingFrame();
 	}
+
+	if (bSkippedSend)
+	{
+		++SkippedSendSerial;
+		bSkippedSend = false;
+	}
 }
 
 bool FJoltReplicationProxy::Identical(const FJoltReplicationProxy* Other, uint32 PortFlags) const
 {
-	return (CachedPendingFrame == Other->CachedPendingFrame);
+	return (CachedPendingFrame == Other->CachedPendingFrame) && (SkippedSendSerial == Other->SkippedSendSerial);
 }
 
 // -------------------------------------------------------------------------------------------------------------------------------
@@ -86,6 +134,230 @@ void FJoltServerReplicationRPCParameter::NetSerializeToProxy(FJoltReplicationPro
 	CachedPackageMap = nullptr;
 }
 
+// -------------------------------------------------------------------------------------------------------------------------------
+//	FJoltPackedInputStream
+// -------------------------------------------------------------------------------------------------------------------------------
+
+namespace JoltPackedInputStream
+{
+	// Anything larger is rejected on receive rather than allocated
+	static constexpr uint32 MaxStreamBits = 64 * 1024 * 8;
+	static constexpr uint32 MaxFrames = 64;
+	static constexpr uint32 MaxSimulations = 256;
+
+	// Payload bytes with the bits past NumBits cleared, so XORs of equal inputs are all zero
+	static void GetPayload(const FJoltSimulationReplicatedInput& Input, FJoltInputPayload& OutBytes)
+	{
+		const int32 NumBytes = FMath::Min((int32)FMath::DivideAndRoundUp(Input.DataSize, 8u), Input.InputData.Num());
+		OutBytes.Set(Input.InputData.GetData(), NumBytes);
+		if (const uint32 TailBits = Input.DataSize & 7; TailBits != 0 && NumBytes > 0)
+		{
+			OutBytes.Last() &= (uint8)((1u << TailBits) - 1);
+		}
+	}
+
+	static const FJoltSimulationReplicatedInput* FindInput(const FJoltInputStreamFrame& Frame, uint32 ID)
+	{
+		return Frame.Inputs.FindByPredicate([ID](const FJoltSimulationReplicatedInput& Input) { return Input.ID == ID; });
+	}
+}
+
+void FJoltPackedInputStream::Encode(TConstArrayView<FJoltInputStreamFrame> Frames, FJoltInputStreamArena& Arena)
+{
+	using namespace JoltPackedInputStream;
+
+	NumFrames = FMath::Min((uint32)Frames.Num(), MaxFrames);
+	Frames = Frames.Right(NumFrames);
+	NewestFrame = NumFrames > 0 ? (uint32)FMath::Max(Frames.Last().Frame, 0) : 0;
+
+	TArray<uint32, TInlineAllocator<4>> IDs;
+	for (const FJoltInputStreamFrame& Frame : Frames)
+	{
+		for (const FJoltSimulationReplicatedInput& Input : Frame.Inputs)
+		{
+			IDs.AddUnique(Input.ID);
+		}
+	}
+
+	FBitWriter& Writer = Arena.ScratchWriter;
+	Writer.Reset();
+	uint32 NumIDs = FMath::Min((uint32)IDs.Num(), MaxSimulations);
+	Writer.SerializeIntPacked(NumIDs);
+
+	for (int32 FrameIdx = Frames.Num() - 1; FrameIdx >= 0; --FrameIdx)
+	{
+		float InterpolationTimeMS = Frames[FrameIdx].InterpolationTimeMS;
+		Writer << InterpolationTimeMS;
+	}
+
+	FJoltInputPayload Payload;
+	FJoltInputPayload NewerPayload;
+	for (uint32 IDIdx = 0; IDIdx < NumIDs; ++IDIdx)
+	{
+		uint32 ID = IDs[IDIdx];
+		Writer.SerializeIntPacked(ID);
+
+		const FJoltSimulationReplicatedInput* Newer = nullptr;
+		for (int32 FrameIdx = Frames.Num() - 1; FrameIdx >= 0; --FrameIdx)
+		{
+			const FJoltSimulationReplicatedInput* Input = FindInput(Frames[FrameIdx], ID);
+			uint8 bPresent = Input != nullptr;
+			Writer.WriteBit(bPresent);
+			if (!Input)
+			{
+				Newer = nullptr;
+				continue;
+			}
+
+			GetPayload(*Input, Payload);
+			if (Newer)
+			{
+				uint8 bUnchanged = Input->DataSize == Newer->DataSize && Payload == NewerPayload;
+				Writer.WriteBit(bUnchanged);
+				if (bUnchanged)
+				{
+					Newer = Input;
+					continue;
+				}
+			}
+
+			uint32 DataSize = Input->DataSize;
+			Writer.SerializeIntPacked(DataSize);
+			if (Newer)
+			{
+				for (int32 ByteIdx = 0; ByteIdx < Payload.Num(); ++ByteIdx)
+				{
+					uint8 Delta = Payload[ByteIdx] ^ (NewerPayload.IsValidIndex(ByteIdx) ? NewerPayload[ByteIdx] : 0);
+					Writer.WriteBit(Delta != 0);
+					if (Delta != 0)
+					{
+						Writer << Delta;
+					}
+				}
+			}
+			else
+			{
+				Writer.SerializeBits(Payload.GetData(), DataSize);
+			}
+
+			Newer = Input;
+			Swap(Payload, NewerPayload);
+		}
+	}
+
+	NumBits = (uint32)Writer.GetNumBits();
+	Data.Reset();
+	Data.Append(Writer.GetData(), (int32)Writer.GetNumBytes());
+}
+
+bool FJoltPackedInputStream::Decode(FJoltInputStreamArena& Arena) const
+{
+	using namespace JoltPackedInputStream;
+
+	if (NewestFrame + 1 < NumFrames)
+	{
+		return false;
+	}
+	for (uint32 FrameIdx = 0; FrameIdx < NumFrames; ++FrameIdx)
+	{
+		Arena.AddFrame().Frame = (int32)(NewestFrame - (NumFrames - 1) + FrameIdx);
+	}
+	if (NumFrames == 0)
+	{
+		return true;
+	}
+	const TArrayView<FJoltInputStreamFrame> OutFrames = Arena.GetFrames();
+
+	TJoltReusableBitReader<FBitReader>& Reader = Arena.ScratchReader;
+	Reader.ResetData(Data.GetData(), NumBits);
+	uint32 NumIDs = 0;
+	Reader.SerializeIntPacked(NumIDs);
+	if (NumIDs > MaxSimulations)
+	{
+		return false;
+	}
+
+	for (int32 FrameIdx = OutFrames.Num() - 1; FrameIdx >= 0; --FrameIdx)
+	{
+		Reader << OutFrames[FrameIdx].InterpolationTimeMS;
+	}
+
+	for (uint32 IDIdx = 0; IDIdx < NumIDs && !Reader.IsError(); ++IDIdx)
+	{
+		uint32 ID = 0;
+		Reader.SerializeIntPacked(ID);
+
+		const FJoltSimulationReplicatedInput* Newer = nullptr;
+		for (int32 FrameIdx = OutFrames.Num() - 1; FrameIdx >= 0 && !Reader.IsError(); --FrameIdx)
+		{
+			if (!Reader.ReadBit())
+			{
+				Newer = nullptr;
+				continue;
+			}
+
+			FJoltSimulationReplicatedInput& Input = OutFrames[FrameIdx].Inputs.AddDefaulted_GetRef();
+			Input.ID = ID;
+			if (Newer && Reader.ReadBit())
+			{
+				Input.DataSize = Newer->DataSize;
+				Input.InputData = Newer->InputData;
+				Newer = &Input;
+				continue;
+			}
+
+			Reader.SerializeIntPacked(Input.DataSize);
+			if (Input.DataSize > MaxStreamBits)
+			{
+				return false;
+			}
+			Input.InputData.SetNumZeroed(FMath::DivideAndRoundUp(Input.DataSize, 8u));
+			if (Newer)
+			{
+				for (int32 ByteIdx = 0; ByteIdx < Input.InputData.Num(); ++ByteIdx)
+				{
+					uint8 Delta = 0;
+					if (Reader.ReadBit())
+					{
+						Reader << Delta;
+					}
+					Input.InputData[ByteIdx] = Delta ^ (Newer->InputData.IsValidIndex(ByteIdx) ? Newer->InputData[ByteIdx] : 0);
+				}
+			}
+			else
+			{
+				Reader.SerializeBits(Input.InputData.GetData(), Input.DataSize);
+			}
+			Newer = &Input;
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+bool FJoltPackedInputStream::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace JoltPackedInputStream;
+
+	Ar.SerializeIntPacked(NewestFrame);
+	Ar.SerializeIntPacked(NumFrames);
+	Ar.SerializeIntPacked(NumBits);
+	if (Ar.IsLoading())
+	{
+		if (NumFrames > MaxFrames || NumBits > MaxStreamBits)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		Data.SetNumZeroed(FMath::DivideAndRoundUp(NumBits, 8u));
+	}
+	Ar.SerializeBits(Data.GetData(), NumBits);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
 // -------------------------------------------------------------------------------------------------------------------------------
 //	FJoltScopedBandwidthLimitBypass
 // -------------------------------------------------------------------------------------------------------------------------------
@@ -2,6 +2,8 @@
 
 #include "JoltNetworkPredictionWorldManager.h"
 #include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
 #include "PBDRigidsSolver.h"
 #include "ChaosSolversModule.h"
 #include "JoltNetworkPredictionLagCompensation.h"
@@ -20,6 +22,10 @@ JOLTNETSIM_DEVCVAR_SHIPCONST_INT(ToggleLagCompensationDebug, 0, "j.np.DrawLagCom
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JoltNetworkPredictionWorldManager)
 
+TRACE_DECLARE_INT_COUNTER(JoltNPInputsReceived, TEXT("JoltNetworkPrediction/Input/Received"));
+TRACE_DECLARE_INT_COUNTER(JoltNPInputsDispatched, TEXT("JoltNetworkPrediction/Input/Dispatched"));
+TRACE_DECLARE_INT_COUNTER(JoltNPInputBitsDispatched, TEXT("JoltNetworkPrediction/Input/BitsDispatched"));
+
 
 UJoltNetworkPredictionWorldManager* UJoltNetworkPredictionWorldManager::ActiveInstance=nullptr;
 
@@ -68,6 +74,14 @@ void UJoltNetworkPredictionWorldManager::Deinitialize()
 void UJoltNetworkPredictionWorldManager::SyncNetworkPredictionSettings(const UJoltNetworkPredictionSettingsObject* SettingsObj)
 {
 	this->Settings = SettingsObj->Settings;
+	SimProxyRelevancy.SyncSettings(Settings);
+	for (UJoltNetworkPredictionPlayerControllerComponent* RPCHandler : RPCHandlers)
+	{
+		if (IsValid(RPCHandler))
+		{
+			RPCHandler->GetInputJitter().SyncSettings(Settings);
+		}
+	}
 }
 
 float UJoltNetworkPredictionWorldManager::GetCurrentLagCompensationTimeMS(const AActor* Actor) const
@@ -118,7 +132,7 @@ FNpLagCompensationData UJoltNetworkPredictionWorldManager::GetActorDefaultStateA
 }
 
 
-void UJoltNetworkPredictionWorldManager::OnInputReceived(const int32& Frame,const float& InterpolationTime,const TArray<FJoltSimulationReplicatedInput>& Inputs
+void UJoltNetworkPredictionWorldManager::OnInputReceived(const int32& Frame,const float& InterpolationTime,TConstArrayView<FJoltSimulationReplicatedInput> Inputs
                                                      , UJoltNetworkPredictionPlayerControllerComponent* RPCHandler)
 {
 	// make sure handler is in the input handlers array.
@@ -126,11 +140,16 @@ void UJoltNetworkPredictionWorldManager::OnInputReceived(const int32& Frame,cons
 	{
 		return;
 	}
-	RPCHandlers.AddUnique(RPCHandler);
+	if (!RPCHandlers.Contains(RPCHandler))
+	{
+		RegisterRPCHandler(RPCHandler);
+	}
 	
 	const bool ShouldEatCmd = RPCHandler->LastReceivedFrame >= Frame;
 	if (!ShouldEatCmd)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(JoltNetworkPrediction::DispatchReceivedInput);
+		TRACE_COUNTER_ADD(JoltNPInputsReceived, Inputs.Num());
 		for (TUniquePtr<IJoltInputService>& Ptr : Services.FixedInputRemote.Array)
 		{
 			Ptr->OnFixedInputReceived(Frame,InterpolationTime,Inputs,RPCHandler,&FixedTickState);
@@ -161,6 +180,7 @@ void UJoltNetworkPredictionWorldManager::OnReceivedAckedData(const FJoltSerializ
 void UJoltNetworkPredictionWorldManager::RegisterRPCHandler(UJoltNetworkPredictionPlayerControllerComponent* RPCHandler)
 {
 	RPCHandlers.AddUnique(RPCHandler);
+	RPCHandler->GetInputJitter().SyncSettings(Settings);
 }
 
 void UJoltNetworkPredictionWorldManager::UnRegisterRPCHandler(UJoltNetworkPredictionPlayerControllerComponent* RPCHandler)
@@ -194,6 +214,16 @@ void UJoltNetworkPredictionWorldManager::OnWorldPreTick(UWorld* InWorld, ELevelT
 		UClass* ReplicatedManagerClass = GetDefault<UJoltNetworkPredictionSettingsObject>()->Settings.ReplicatedManagerClassOverride.Get();
 		ReplicatedManager = ReplicatedManagerClass ? InWorld->SpawnActor<AJoltNetworkPredictionReplicatedManager>(ReplicatedManagerClass) : InWorld->SpawnActor<AJoltNetworkPredictionReplicatedManager>();
 	}
+
+	if (SimProxyRelevancy.IsEnabled() && InWorld->GetNetMode() != NM_Client)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastRelevancyPruneTime > 1.0)
+		{
+			SimProxyRelevancy.Prune(Now);
+			LastRelevancyPruneTime = Now;
+		}
+	}
 }
 
 void UJoltNetworkPredictionWorldManager::OnWorldPreTick_Internal(float InDeltaSeconds, float InFixedFrameRate)
@@ -515,6 +545,22 @@ void UJoltNetworkPredictionWorldManager::BeginNewSimulationFrame_Internal(float
 						Subsystem->StepVirtualCharacters(FixedTimeStep);
 						Subsystem->StepPhysics(FixedTimeStep);
 						Subsystem->SaveStateForFrame(Step.Frame);
+						
+						// Corrections can land on any frame the server has not acknowledged yet, and take a round trip to arrive.
+						// Lets the physics snapshot history size itself to that instead of its worst case.
+						if (!bIsServer)
+						{
+							const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+							const UNetConnection* ServerConnection = NetDriver ? NetDriver->ServerConnection.Get() : nullptr;
+							const int32 RTTFrames = ServerConnection ? FMath::CeilToInt32(ServerConnection->AvgLag * 1000.f / FixedTickState.FixedStepMS) : 0;
+							const int32 UnackedFrames = FixedTickState.ConfirmedFrame != INDEX_NONE ? FixedTickState.PendingFrame - FixedTickState.ConfirmedFrame : 0;
+							Subsystem->ReportRollbackWindow(FMath::Max(RTTFrames, UnackedFrames));
+						}
+						// The server rewinds for lag compensation, as far back as RewindActors clamps to
+						else
+						{
+							Subsystem->ReportRollbackWindow(FMath::CeilToInt32(GetMaxRewindDuration(this) / FixedTickState.FixedStepMS));
+						}
 					}
 				
 				}
@@ -550,10 +596,35 @@ void UJoltNetworkPredictionWorldManager::BeginNewSimulationFrame_Internal(float
 			
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(JoltNetworkPrediction::CallServerRPC);
-				// send multiple RPC for each input command.
-				// since we are sending inputs for all simulation together this is better than sending all in 1 RPC
+				// Packed: the whole window of input commands in one delta packed RPC.
+				// Otherwise one RPC per input command, each carrying the inputs of every simulation for that frame.
 				
-				if (Services.FixedServerRPC.Array.Num() > 0)
+				if (Services.FixedServerRPC.Array.Num() > 0 && Settings.bPackRedundantInputs)
+				{
+					const int32 NumInputToSend = FMath::Max(Settings.FixedTickInputSendCount,1);
+					const int32 StartFrame = FMath::Max(FixedTickState.PendingFrame - NumInputToSend ,0);
+					for (int32 i = StartFrame; i < FixedTickState.PendingFrame; i++)
+					{
+						for (TUniquePtr<IJoltFixedServerRPCService>& Ptr : Services.FixedServerRPC.Array)
+						{
+							Ptr->AddInputToHandler(i);
+						}
+						for (UJoltNetworkPredictionPlayerControllerComponent*& InputHandler : RPCHandlers)
+						{
+							InputHandler->QueueInputStreamFrame(i);
+						}
+					}
+					for (UJoltNetworkPredictionPlayerControllerComponent*& InputHandler : RPCHandlers)
+					{
+						InputHandler->SendInputStream();
+						if (FixedTickState.LocalAckedFrames.IDsToAckedFrames.Num() > 0)
+						{
+							InputHandler->SendAckedFrames(FJoltSerializedAckedFrames(FixedTickState.LocalAckedFrames));
+						}
+					}
+					FixedTickState.LocalAckedFrames.IDsToAckedFrames.Reset();
+				}
+				else if (Services.FixedServerRPC.Array.Num() > 0)
 				{
 					const int32 NumInputToSend = FMath::Max(Settings.FixedTickInputSendCount,1);
 					const int32 StartFrame = FMath::Max(FixedTickState.PendingFrame - NumInputToSend ,0);
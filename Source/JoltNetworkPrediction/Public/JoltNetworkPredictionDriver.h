@@ -7,6 +7,7 @@
 #include "JoltNetworkPredictionDebug.h"
 #include "JoltNetworkPredictionStateTypes.h"
 #include "JoltNetworkPredictionStateView.h"
+#include "JoltNetworkPredictionInterpolationChannels.h"
 #include "Components/PrimitiveComponent.h"
 
 class UJoltNetworkPredictionPlayerControllerComponent;
@@ -657,6 +658,49 @@ struct FJoltNetworkPredictionDriverBase
 	{
 	}
 
+	// -----------------------------------------------------------------------------------------------------------------------------------
+	//	Interpolation channels
+	//
+	//	Sync states exposing their transform and velocities (see FJoltInterpolationChannels) are interpolated by the fixed tick
+	//	interpolation service in one structure of arrays pass over all instances, instead of an Interpolate call per instance.
+	//	The driver can then also take the results of all instances in one call:
+	//
+	//		static void FinalizeInterpolatedFrames(TConstArrayView<DriverType*> Drivers, TConstArrayView<const SyncType*> Syncs, TConstArrayView<const AuxType*> Auxes);
+	//
+	//	Without it FinalizeFrame is called for each instance.
+	// -----------------------------------------------------------------------------------------------------------------------------------
+	struct CInterpolationChannelsFuncable
+	{
+		template <typename InSyncType>
+		auto Requires(InSyncType* Sync, FJoltInterpolationChannels& Channels) -> decltype(static_cast<const InSyncType*>(Sync)->GetInterpolationChannels(Channels), Sync->SetInterpolationChannels(Channels));
+	};
+
+	static constexpr bool HasInterpolationChannels = TModels_V<CInterpolationChannelsFuncable, SyncType>;
+
+	struct CFinalizeInterpolatedFramesFuncable
+	{
+		template <typename InDriverType>
+		auto Requires(TConstArrayView<InDriverType*> Drivers, TConstArrayView<const SyncType*> Syncs, TConstArrayView<const AuxType*> Auxes) -> decltype(InDriverType::FinalizeInterpolatedFrames(Drivers, Syncs, Auxes));
+	};
+
+	static constexpr bool HasFinalizeInterpolatedFrames = TModels_V<CFinalizeInterpolatedFramesFuncable, DriverType>;
+
+	static void FinalizeInterpolatedFrames(TConstArrayView<DriverType*> Drivers, TConstArrayView<const SyncType*> Syncs, TConstArrayView<const AuxType*> Auxes)
+	{
+		jnpCheckSlow(Drivers.Num() == Syncs.Num() && Drivers.Num() == Auxes.Num());
+		if constexpr (HasFinalizeInterpolatedFrames)
+		{
+			DriverType::FinalizeInterpolatedFrames(Drivers, Syncs, Auxes);
+		}
+		else
+		{
+			for (int32 i = 0; i < Drivers.Num(); ++i)
+			{
+				FinalizeFrame(Drivers[i], Syncs[i], Auxes[i]);
+			}
+		}
+	}
+
 	// -----------------------------------------------------------------------------------------------------------------------------------
 	//	Show/Hide ForInterpolation
 	//
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FJoltNetworkPredictionSettings;
+
+// Server side model of one client's input arrival, sizing how many of its input commands the server keeps buffered.
+//	-Jitter is the RFC 3550 interarrival estimate: the smoothed change of (arrival time - client frame time) from one input
+//	 packet to the next.
+//	-Loss shows as the newest received frame jumping by more than one. The redundant input window (FixedTickInputSendCount)
+//	 recovers the frames, but only with the next packet, so the length of recent loss bursts is added to the depth.
+//	-Starving the buffer raises the depth by one at once. It only comes back down one frame per ShrinkDelaySeconds, so
+//	 a good connection sits at MinDepth and a bad one is not walked back into starvation by a few quiet seconds.
+//	-Time dilation is driven by GetBufferOffset, the smoothed distance from the desired depth.
+class JOLTNETWORKPREDICTION_API FJoltInputJitterBuffer
+{
+public:
+
+	void SyncSettings(const FJoltNetworkPredictionSettings& Settings);
+	bool IsEnabled() const { return bEnabled; }
+
+	// An input RPC arrived whose newest frame is NewestFrame
+	void OnPacketReceived(int32 NewestFrame, double ArrivalTimeSeconds, float FixedStepMS);
+
+	// Once per server fixed tick, after consumption, with the number of frames received but not consumed yet
+	void OnFrameConsumed(int32 BufferedFrames, double TimeSeconds);
+
+	// Consumption caught up with the newest received frame
+	void OnStarved(double TimeSeconds);
+
+	int32 GetDesiredDepth() const { return DesiredDepth; }
+
+	// Smoothed buffered frames minus the desired depth. Positive when the client runs too far ahead.
+	int32 GetBufferOffset() const;
+
+	float GetJitterMS() const { return JitterMS; }
+	float GetLossRate() const { return LossRate; }
+	int32 GetNumStarvations() const { return NumStarvations; }
+
+	void Reset();
+
+private:
+
+	void UpdateDesiredDepth(double TimeSeconds);
+
+	// Settings
+	bool bEnabled = false;
+	int32 MinDepth = 1;
+	int32 MaxDepth = 16;
+	float JitterMultiplier = 2.5f;
+	double ShrinkDelaySeconds = 2.0;
+
+	// Arrival model
+	int32 LastNewestFrame = INDEX_NONE;
+	double LastTransitMS = 0.0;
+	float FixedStepMS = 0.f;
+	float JitterMS = 0.f;
+	float LossRate = 0.f;
+	int32 RecentBurstFrames = 0;
+	double LastBurstTime = 0.0;
+
+	// Buffer state
+	int32 DesiredDepth = 1;
+	float SmoothedDepth = 0.f;
+	double LastDepthChangeTime = 0.0;
+	int32 NumStarvations = 0;
+};
@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Transform and velocities of a sync state: the part of it the fixed tick interpolation service can blend for every instance of a
+// model in one pass. A sync state opts in by implementing
+//
+//		void GetInterpolationChannels(FJoltInterpolationChannels& Out) const;
+//		void SetInterpolationChannels(const FJoltInterpolationChannels& In);
+//
+// The service then no longer calls its Interpolate. Only the channels are blended: the rest of the sync state and the aux state are
+// taken from the frame being interpolated to.
+struct FJoltInterpolationChannels
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector LinearVelocity = FVector::ZeroVector;
+	FVector AngularVelocity = FVector::ZeroVector;
+};
+
+// From/To channels of many instances as structure of arrays, one contiguous stream per scalar component.
+//	-SetWindow is called when the interpolation frames change (once per fixed tick), Interpolate every render frame.
+//	-Interpolate is a flat lerp over all streams followed by a normalize of the rotation streams. To rotations are put on the
+//	 same hemisphere as From in SetWindow, so this is the normalized lerp along the shortest arc.
+class JOLTNETWORKPREDICTION_API FJoltInterpolationChannelBuffer
+{
+public:
+
+	// Sets the number of slots. Memory is kept when shrinking.
+	void SetNum(int32 InNum);
+	int32 Num() const { return NumSlots; }
+
+	void SetWindow(int32 Slot, const FJoltInterpolationChannels& From, const FJoltInterpolationChannels& To);
+
+	void Interpolate(float PCT);
+
+	void GetResult(int32 Slot, FJoltInterpolationChannels& Out) const;
+
+private:
+
+	enum EComponent : int32
+	{
+		LocX, LocY, LocZ,
+		RotX, RotY, RotZ, RotW,
+		LinX, LinY, LinZ,
+		AngX, AngY, AngZ,
+		NumComponents
+	};
+
+	double* Stream(TArray<double>& Data, int32 Component) { return Data.GetData() + Component * Capacity; }
+	const double* Stream(const TArray<double>& Data, int32 Component) const { return Data.GetData() + Component * Capacity; }
+
+	TArray<double> FromData;
+	TArray<double> DeltaData;	// To - From
+	TArray<double> OutData;
+	int32 NumSlots = 0;
+	int32 Capacity = 0;
+};
@@ -47,6 +47,10 @@ struct FJoltNetworkPredictionModelDef
 	static const TCHAR* GetName() { return nullptr; }
 
 	static constexpr int32 GetSortPriority() { return (int32)EJoltNetworkPredictionSortPriority::Last; }
+
+	// Whether instances may run SimulationTick on worker threads when j.np.Tick.Parallel is enabled.
+	// Requires Simulation to implement CanSimulationTickInParallel, BeginParallelSimulationTick and CommitParallelSimulationTick.
+	static constexpr bool SupportsParallelTick() { return false; }
 };
 
 // ----------------------------------------------------------------------
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "JoltNetworkPredictionReplicationProxy.h"
+#include "JoltNetworkPredictionInputJitter.h"
 #include "JoltNetworkPredictionTickState.h"
 #include "Components/ActorComponent.h"
 #include "JoltNetworkPredictionPlayerControllerComponent.generated.h"
@@ -55,7 +56,16 @@ public:
 	int32 LastConsumedFrame = INDEX_NONE;
 	float InterpolationTimeMS = 0.0f;
 	void AdvanceLastConsumedFrame(const int32& MaxBufferSize);
-	void AddInputToSend(const int32& ID, const uint32& DataSize , const TArray<uint8>& Data);
+	FJoltInputJitterBuffer& GetInputJitter() { return InputJitter; }
+	const FJoltInputJitterBuffer& GetInputJitter() const { return InputJitter; }
+	void AddInputToSend(const int32& ID, const uint32& DataSize , const FJoltInputPayload& Data);
+
+	// Packed input stream (FJoltNetworkPredictionSettings::bPackRedundantInputs): the inputs added since the last call become
+	// Frame of the stream, and the whole window goes out in one Server_ReceivedInputStream on SendInputStream.
+	void QueueInputStreamFrame(const int32& Frame);
+	void SendInputStream();
+	UFUNCTION(Server,Unreliable)
+	void Server_ReceivedInputStream(const FJoltPackedInputStream& Stream);
 
 	// Register by ID directly
 	void RegisterInputReceiver(int32 ID, TFunction<void(
@@ -89,6 +99,13 @@ private:
 	// by the RPC and received then unpacked on the server.
 	TArray<FJoltSimulationReplicatedInput> InputsToSend;
 
+	// Frames queued for the next packed input stream (client), frames decoded from the last one received (server)
+	FJoltInputStreamArena InputStreamArena;
+	FJoltPackedInputStream OutgoingInputStream;
+
+	// Server side arrival model of this client's inputs, sets how far behind LastReceivedFrame consumption runs
+	FJoltInputJitterBuffer InputJitter;
+
 	UPROPERTY(ReplicatedUsing=OnRep_TimeDilation)
 	FJoltSimTimeDilation TimeDilation;
 	
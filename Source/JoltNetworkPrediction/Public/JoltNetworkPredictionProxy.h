@@ -257,6 +257,7 @@ struct FJoltNetworkPredictionProxy
 	ENetRole GetCachedNetRole() const { return CachedNetRole; }
 	bool GetCachedHasNetConnection() const { return bCachedHasNetConnection; }
 	int32 GetID() const {return ID;}
+	UJoltNetworkPredictionWorldManager* GetWorldManager() const { return WorldManager; }
 	UJoltNetworkPredictionPlayerControllerComponent* GetCachedRPCHandler() const { return CachedRPCHandler; }
 
 private:
@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "JoltNetworkPredictionRelevancy.generated.h"
+
+class AActor;
+class UNetConnection;
+struct FJoltNetworkPredictionSettings;
+
+// How finely a simulated proxy update is quantized. Chosen per connection by FJoltSimProxyRelevancy, written in front of the
+// update, and visible to state NetSerialize functions through FJoltNetSerializeParams::Precision or JoltNetPrecision::Get().
+UENUM()
+enum class EJoltNetPrecision : uint8
+{
+	Full,
+	Medium,
+	Low,
+};
+
+// One distance band of the simulated proxy LOD
+USTRUCT()
+struct FJoltSimProxyLODBand
+{
+	GENERATED_BODY()
+
+	// The band covers proxies up to this far (cm) from the receiving connection's view target
+	UPROPERTY(config, EditAnywhere, Category = Relevancy, meta=(ClampMin = 0))
+	float MaxDistance = 0.f;
+
+	// Updates per second sent to that connection. 0 sends on every replication update of the actor.
+	UPROPERTY(config, EditAnywhere, Category = Relevancy, meta=(ClampMin = 0))
+	float UpdateRateHz = 0.f;
+
+	UPROPERTY(config, EditAnywhere, Category = Relevancy)
+	EJoltNetPrecision Precision = EJoltNetPrecision::Full;
+};
+
+namespace JoltNetPrecision
+{
+	// Precision of the simulated proxy update currently being (de)serialized on this thread. Full outside of one.
+	JOLTNETWORKPREDICTION_API EJoltNetPrecision Get();
+
+	struct JOLTNETWORKPREDICTION_API FScope
+	{
+		explicit FScope(EJoltNetPrecision Precision);
+		~FScope();
+
+	private:
+		EJoltNetPrecision Previous;
+	};
+}
+
+// Server side update rate and precision LOD for simulated proxies, decided per receiving connection.
+//	-The simulated proxy replication proxy asks ShouldSend before serializing for a connection. Skipped updates cost one bit and
+//	 none of the state serialization.
+//	-Bands come from FJoltNetworkPredictionSettings::SimulatedProxyLODBands. Proxies past the last band use its rate and precision.
+//	-Clients fill the gaps like any other missing frame: interpolated proxies interpolate across them (keep the slowest band's
+//	 interval under FixedTickInterpolationBufferedMS), forward predicted ones keep simulating until the next correction.
+class JOLTNETWORKPREDICTION_API FJoltSimProxyRelevancy
+{
+public:
+
+	struct FStats
+	{
+		int64 Sent[3] = { 0, 0, 0 };	// Per EJoltNetPrecision
+		int64 Skipped = 0;
+	};
+
+	void SyncSettings(const FJoltNetworkPredictionSettings& Settings);
+	bool IsEnabled() const { return bEnabled; }
+
+	// Whether the proxy for ID owned by Actor gets an update to Connection this time, and at which precision
+	bool ShouldSend(const UNetConnection* Connection, const AActor* Actor, int32 ID, EJoltNetPrecision& OutPrecision);
+
+	// Forgets closed connections and proxies that have not been sent for a while
+	void Prune(double CurrentTime);
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FStats(); }
+
+private:
+
+	const FJoltSimProxyLODBand& FindBand(float DistSquared) const;
+
+	struct FConnectionState
+	{
+		TMap<int32, double> LastSendTimes;	// Proxy ID -> time of the last update sent
+	};
+
+	TArray<FJoltSimProxyLODBand> Bands;		// Sorted by MaxDistance
+	TArray<float> BandMaxDistSquared;
+	bool bEnabled = false;
+
+	TMap<TObjectKey<UNetConnection>, FConnectionState> Connections;
+	FStats Stats;
+};
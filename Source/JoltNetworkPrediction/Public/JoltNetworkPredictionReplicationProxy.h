@@ -2,6 +2,9 @@
 
 #pragma once
 #include "JoltNetworkPredictionCheck.h"
+#include "JoltNetworkPredictionRelevancy.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
 
 #include "JoltNetworkPredictionReplicationProxy.generated.h"
 
@@ -31,6 +34,10 @@ struct FJoltNetSerializeParams
 	FArchive& Ar;
 	UPackageMap* Map;
 	EJoltReplicationProxyTarget ReplicationTarget = EJoltReplicationProxyTarget::ServerRPC;
+
+	// Quantization the state is serialized with. Only simulated proxy updates go below Full, see FJoltSimProxyRelevancy.
+	EJoltNetPrecision Precision = EJoltNetPrecision::Full;
+
 	template<typename T>
 	const T* GetBaseDeltaState() const
 	{
@@ -47,7 +54,7 @@ struct JOLTNETWORKPREDICTION_API FJoltReplicationProxy
 {
 	GENERATED_BODY()
 
-	void Init(FJoltNetworkPredictionProxy* InJoltNetSimProxy, EJoltReplicationProxyTarget InReplicationTarget);
+	void Init(FJoltNetworkPredictionProxy* InJoltNetSimProxy, EJoltReplicationProxyTarget InReplicationTarget, const AActor* InOwner = nullptr);
 	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
 	void OnPreReplication();	
 	bool Identical(const FJoltReplicationProxy* Other, uint32 PortFlags) const;
@@ -57,8 +64,19 @@ struct JOLTNETWORKPREDICTION_API FJoltReplicationProxy
 
 private:
 
+	// Simulated proxy updates are prefixed with whether the connection gets this update, and at which precision
+	void NetSerializeSimulatedProxy(FArchive& Ar, UPackageMap* Map);
+
 	EJoltReplicationProxyTarget ReplicationTarget;
 	int32 CachedPendingFrame = INDEX_NONE;
+
+	// Actor the proxy replicates with, measured against each connection's view target for simulated proxy LOD
+	TWeakObjectPtr<const AActor> Owner;
+
+	// Bumped when an update was skipped for some connection, so the next replication pass serializes the proxy again even
+	// if the simulation has not moved on (otherwise that connection could be left on a stale frame).
+	int32 SkippedSendSerial = 0;
+	bool bSkippedSend = false;
 };
 
 template<>
@@ -141,18 +159,50 @@ private:
 };
 
 
+// Serialized bits of one input command. Held inline up to InlineBytes, which covers typical input commands, so copying inputs
+// between the send and receive buffers does not touch the heap. Larger commands spill to the heap like a TArray.
+struct FJoltInputPayload
+{
+	static constexpr int32 InlineBytes = 64;
+
+	FJoltInputPayload() = default;
+	FJoltInputPayload(TConstArrayView<uint8> InBytes) : Bytes(InBytes.GetData(), InBytes.Num()) { }
+
+	void Set(const uint8* Src, int32 NumBytes)
+	{
+		Bytes.Reset();
+		Bytes.Append(Src, NumBytes);
+	}
+
+	void SetNumZeroed(int32 NumBytes) { Bytes.Reset(); Bytes.AddZeroed(NumBytes); }
+
+	uint8* GetData() { return Bytes.GetData(); }
+	const uint8* GetData() const { return Bytes.GetData(); }
+	int32 Num() const { return Bytes.Num(); }
+	bool IsValidIndex(int32 Index) const { return Bytes.IsValidIndex(Index); }
+	uint8& operator[](int32 Index) { return Bytes[Index]; }
+	uint8 operator[](int32 Index) const { return Bytes[Index]; }
+	uint8& Last() { return Bytes.Last(); }
+
+	bool operator==(const FJoltInputPayload& Other) const { return Bytes == Other.Bytes; }
+
+private:
+	TArray<uint8, TInlineAllocator<InlineBytes>> Bytes;
+};
+
 USTRUCT()
 struct FJoltSimulationReplicatedInput
 {
 	GENERATED_BODY()
 
+	// Largest input command accepted from the network
+	static constexpr uint32 MaxDataSize = 16 * 1024 * 8;
+
 	FJoltSimulationReplicatedInput(){}
-	FJoltSimulationReplicatedInput(const int32& InID,const uint32& InDataSize, const TArray<uint8>& InData)
-	{
-		ID = InID;
-		DataSize = InDataSize;
-		InputData = InData;
-	};
+	FJoltSimulationReplicatedInput(const int32& InID,const uint32& InDataSize, TConstArrayView<uint8> InData)
+		: ID(InID), DataSize(InDataSize), InputData(InData) { }
+	FJoltSimulationReplicatedInput(const int32& InID,const uint32& InDataSize, const FJoltInputPayload& InData)
+		: ID(InID), DataSize(InDataSize), InputData(InData) { }
 	
 	UPROPERTY()
 	uint32 ID = 0;
@@ -160,26 +210,27 @@ struct FJoltSimulationReplicatedInput
 	UPROPERTY()
 	uint32 DataSize = 0;
 
-	UPROPERTY()
-	TArray<uint8> InputData;
+	// DataSize bits, replicated by NetSerialize
+	FJoltInputPayload InputData;
 
 	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& OutSuccess)
 	{
 		Ar.SerializeIntPacked(ID);
 		Ar.SerializeIntPacked(DataSize);
 		
-		uint32 Num = InputData.Num();
-		Ar.SerializeIntPacked(Num);
 		if (Ar.IsLoading())
 		{
-			InputData.SetNum(Num);
-		}
-		for (uint32 i = 0; i < Num; i++)
-		{
-			Ar << InputData[i];
+			if (DataSize > MaxDataSize)
+			{
+				Ar.SetError();
+				OutSuccess = false;
+				return false;
+			}
+			InputData.SetNumZeroed(FMath::DivideAndRoundUp(DataSize, 8u));
 		}
+		Ar.SerializeBits(InputData.GetData(), DataSize);
 		
-		OutSuccess = true;
+		OutSuccess = !Ar.IsError();
 		return true;
 	}
 };
@@ -192,6 +243,98 @@ struct TStructOpsTypeTraits<FJoltSimulationReplicatedInput> : public TStructOpsT
 	};
 };
 
+// One client input frame of every simulation driven by a player controller
+struct FJoltInputStreamFrame
+{
+	int32 Frame = INDEX_NONE;
+	float InterpolationTimeMS = 0.f;
+	TArray<FJoltSimulationReplicatedInput, TInlineAllocator<2>> Inputs;
+};
+
+// Bit reader that keeps its buffer when pointed at new data, so reading one input after another does not allocate once warm
+template<typename ReaderType>
+class TJoltReusableBitReader : public ReaderType
+{
+public:
+	using ReaderType::ReaderType;
+
+	void ResetData(const uint8* Src, int64 CountBits)
+	{
+		this->Buffer.Reset();
+		this->Buffer.Append(Src, (int32)((CountBits + 7) >> 3));
+		this->Num = CountBits;
+		this->Pos = 0;
+		this->ClearError();
+	}
+};
+
+// Per RPC handler storage for the input stream. Frames, their inputs and the scratch archives keep their memory between sends and
+// receives: a steady window size and number of simulations runs without heap allocations.
+struct FJoltInputStreamArena
+{
+	// A pooled frame with no inputs
+	FJoltInputStreamFrame& AddFrame()
+	{
+		if (NumFrames == Frames.Num())
+		{
+			Frames.AddDefaulted();
+		}
+		FJoltInputStreamFrame& Frame = Frames[NumFrames++];
+		Frame.Frame = INDEX_NONE;
+		Frame.InterpolationTimeMS = 0.f;
+		Frame.Inputs.Reset();
+		return Frame;
+	}
+
+	void Reset() { NumFrames = 0; }
+
+	TArrayView<FJoltInputStreamFrame> GetFrames() { return MakeArrayView(Frames.GetData(), NumFrames); }
+	TConstArrayView<FJoltInputStreamFrame> GetFrames() const { return MakeArrayView(Frames.GetData(), NumFrames); }
+
+	FBitWriter ScratchWriter{0, true};
+	TJoltReusableBitReader<FBitReader> ScratchReader{nullptr, 0};
+
+private:
+	TArray<FJoltInputStreamFrame> Frames;
+	int32 NumFrames = 0;
+};
+
+// The redundant window of client input frames (FixedTickInputSendCount), packed into a single server RPC.
+//	-The newest frame of each simulation is written in full.
+//	-Older frames are written as a byte-wise XOR against the next newer frame of the same simulation: one bit per unchanged byte, nine
+//	 per changed one, and a single bit when the whole payload is unchanged. Held inputs cost next to nothing past the newest frame.
+//	-Payloads are the already NetSerialized input commands, so each frame is serialized once by the sender whatever the window size.
+USTRUCT()
+struct JOLTNETWORKPREDICTION_API FJoltPackedInputStream
+{
+	GENERATED_BODY()
+
+	// Frames must be consecutive and in ascending order. Arena provides the scratch writer.
+	void Encode(TConstArrayView<FJoltInputStreamFrame> Frames, FJoltInputStreamArena& Arena);
+
+	// Rebuilds the frames in ascending order into the reset Arena. False if the stream is malformed, the arena is then incomplete.
+	bool Decode(FJoltInputStreamArena& Arena) const;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	int32 GetNumBits() const { return (int32)NumBits; }
+
+private:
+
+	uint32 NewestFrame = 0;
+	uint32 NumFrames = 0;
+	uint32 NumBits = 0;
+	TArray<uint8, TInlineAllocator<256>> Data;
+};
+template<>
+struct TStructOpsTypeTraits<FJoltPackedInputStream> : public TStructOpsTypeTraitsBase2<FJoltPackedInputStream>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 USTRUCT()
 struct FJoltSimTimeDilation
 {
@@ -867,6 +867,7 @@ public:
 		FNetBitWriter* MainWriter = static_cast<FNetBitWriter*>(&P.Ar);
 		FNetBitWriter LocalNetWriter (P.Map , (MainWriter->GetMaxBits() + 7) / 8);
 		FJoltNetSerializeParams LocalParams(LocalNetWriter,P.Map,P.ReplicationTarget);
+		LocalParams.Precision = P.Precision;
 
 		FJoltNetworkPredictionSerialization::WriteCompressedFrame(LocalParams.Ar, PendingFrame); // 4. PendingFrame (Server's frame)
 		
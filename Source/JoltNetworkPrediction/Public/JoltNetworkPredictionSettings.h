@@ -5,6 +5,7 @@
 #include "Templates/SubclassOf.h"
 #include "CoreMinimal.h"
 #include "JoltNetworkPredictionReplicatedManager.h"
+#include "JoltNetworkPredictionRelevancy.h"
 #include "JoltNetworkPredictionSettings.generated.h"
 
 class AJoltNetworkPredictionReplicatedManager;
@@ -62,6 +63,10 @@ struct FJoltNetworkPredictionSettings
 	UPROPERTY(config, EditAnywhere, Category = Input)
 	int32 FixedTickInputSendCount = 6;
 
+	// Send the FixedTickInputSendCount input commands as one delta packed RPC (FJoltPackedInputStream) instead of one RPC per command
+	UPROPERTY(config, EditAnywhere, Category = Input)
+	bool bPackRedundantInputs = true;
+
 	UPROPERTY(config, EditAnywhere, Category = Input)
 	int32 FixedTickDesiredBufferedInputCount = 4;
 
@@ -73,6 +78,26 @@ struct FJoltNetworkPredictionSettings
 	UPROPERTY(config, EditAnywhere, Category = Input)
 	int32 MaximumRemoteInputFaultLimit = 6;
 
+	// Server sizes each client's input buffer from the jitter and loss measured on its input RPCs (FJoltInputJitterBuffer)
+	// instead of FixedTickDesiredBufferedInputCount plus the connection's average jitter and loss counters.
+	UPROPERTY(config, EditAnywhere, Category = Input)
+	bool bAdaptiveInputBuffer = true;
+
+	// Frames buffered for a connection with no jitter or loss
+	UPROPERTY(config, EditAnywhere, Category = Input, meta=(EditCondition = "bAdaptiveInputBuffer", ClampMin = 1))
+	int32 AdaptiveInputBufferMinDepth = 1;
+
+	UPROPERTY(config, EditAnywhere, Category = Input, meta=(EditCondition = "bAdaptiveInputBuffer", ClampMin = 1))
+	int32 AdaptiveInputBufferMaxDepth = 16;
+
+	// Jitter covered by the buffer, in multiples of the measured mean deviation
+	UPROPERTY(config, EditAnywhere, Category = Input, meta=(EditCondition = "bAdaptiveInputBuffer", ClampMin = 0))
+	float AdaptiveInputBufferJitterMultiplier = 2.5f;
+
+	// Time the buffer holds its depth after growing before it shrinks by one frame
+	UPROPERTY(config, EditAnywhere, Category = Input, meta=(EditCondition = "bAdaptiveInputBuffer", ClampMin = 0))
+	float AdaptiveInputBufferShrinkDelaySeconds = 2.f;
+
 
 	// this represents how much ping the lag compensation supports.
 	// this does not mean a specific player will be rewound max for this duration,
@@ -85,6 +110,23 @@ struct FJoltNetworkPredictionSettings
 	// the max history duration kept in the buffer in Milliseconds
 	UPROPERTY(config, EditAnywhere, Category = LagCompensation)
 	int32 MaxBufferedRewindHistoryTimeMS = 1000;
+
+	// ------------------------------------------------------------------------------------------
+
+	// Server sends simulated proxy updates to each connection at a rate and precision picked from SimulatedProxyLODBands,
+	// by distance between the proxy and the connection's view target.
+	UPROPERTY(config, EditAnywhere, Category = Relevancy)
+	bool bEnableSimulatedProxyLOD = false;
+
+	// Proxies past the last band use the last band. Keep the slowest interval under FixedTickInterpolationBufferedMS so
+	// interpolated proxies never run dry between two updates.
+	UPROPERTY(config, EditAnywhere, Category = Relevancy, meta=(EditCondition = "bEnableSimulatedProxyLOD"))
+	TArray<FJoltSimProxyLODBand> SimulatedProxyLODBands =
+	{
+		{ 2500.f, 0.f, EJoltNetPrecision::Full },
+		{ 6000.f, 20.f, EJoltNetPrecision::Medium },
+		{ 15000.f, 10.f, EJoltNetPrecision::Low },
+	};
 	
 };
 
@@ -106,6 +106,9 @@ public:
 
 	const FJoltNetworkPredictionSettings& GetSettings() const { return Settings; }
 
+	// Server side per connection LOD of simulated proxy updates
+	FJoltSimProxyRelevancy& GetSimProxyRelevancy() { return SimProxyRelevancy; }
+
 	
 
 	const FJoltFixedTickState& GetFixedTickState() const { return FixedTickState; }
@@ -114,7 +117,7 @@ public:
 	// IMPORTANT: this makes variable tick state unusable since it's only implemented for fixed tick
 	// this is very crude way of doing this, each service can add a lambda along with the ID to its own UJoltNetworkPredictionPlayerControllerComponent
 	// and when an input is received the component will loop through inputs received which has ID for each entry and call the lambda for correct IDs
-	void OnInputReceived(const int32& Frame,const float& InterpolationTime,const TArray<FJoltSimulationReplicatedInput>& Inputs,
+	void OnInputReceived(const int32& Frame,const float& InterpolationTime,TConstArrayView<FJoltSimulationReplicatedInput> Inputs,
 		UJoltNetworkPredictionPlayerControllerComponent* RPCHandler);
 	void OnReceivedAckedData(const FJoltSerializedAckedFrames& AckedFrames, UJoltNetworkPredictionPlayerControllerComponent* RPCHandler);
 
@@ -128,6 +131,9 @@ private:
 	
 	FJoltNetworkPredictionSettings Settings;
 
+	FJoltSimProxyRelevancy SimProxyRelevancy;
+	double LastRelevancyPruneTime = 0.0;
+
 	FJoltFixedTickState FixedTickState;
 	FJoltVariableTickState VariableTickState;
 	FJoltNetworkPredictionServiceRegistry Services;
@@ -382,7 +388,11 @@ void UJoltNetworkPredictionWorldManager::ConfigureInstance(FJoltNetworkPredictio
 	const int32 PrevPendingFrame = InstanceData.Info.View->PendingFrame;
 	const bool bNewInstance = (InstanceData.NetRole == ROLE_None);
 	InstanceData.NetRole = Role;
-	InstanceData.Info.RPCHandler = RPCHandler;
+	if (InstanceData.Info.RPCHandler != RPCHandler)
+	{
+		InstanceData.Info.RPCHandler = RPCHandler;
+		Services.OnRPCHandlerChanged<ModelDef>();
+	}
 	
 	TJoltRemoteInputService<ModelDef>::SetMaxFaultLimit(Settings.MaximumRemoteInputFaultLimit);
 	TJoltRemoteInputService<ModelDef>::SetDesiredBufferedInputs(Settings.FixedTickDesiredBufferedInputCount);
@@ -1,132 +1,198 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #pragma once
-#include "Containers/SparseArray.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/UniqueObj.h"
+#include "JoltNetworkPredictionCheck.h"
 #include "JoltNetworkPredictionID.h"
 
+// Dense storage shared by the instance maps below.
+//	-O(1) add/remove/lookup. IDs are hashed to a stable slot index, slots point into a dense, contiguous element array.
+//	-Removal swaps the last element into the hole, so the element array never has gaps. Only the moved element's slot
+//	 is patched, stable indices handed out earlier stay valid.
+//	-Freed slots are reused lowest index first, which keeps service bit arrays indexed by slot compact.
+template<typename ElementType>
+struct TJoltDenseInstanceStorage
+{
+	int32 GetIndex(const FJoltNetworkPredictionID& ID)
+	{
+		int32& SlotIdx = Lookup.FindOrAdd((int32)ID, INDEX_NONE);
+		if (SlotIdx == INDEX_NONE)
+		{
+			SlotIdx = AllocateSlot();
+			Slots[SlotIdx].DenseIdx = Dense.AddDefaulted();
+			DenseToSlot.Add(SlotIdx);
+		}
+		return SlotIdx;
+	}
+
+	int32 FindIndex(const FJoltNetworkPredictionID& ID) const
+	{
+		const int32* SlotIdx = Lookup.Find((int32)ID);
+		return SlotIdx ? *SlotIdx : INDEX_NONE;
+	}
+
+	int32 GetIndexChecked(const FJoltNetworkPredictionID& ID) const
+	{
+		return Lookup.FindChecked((int32)ID);
+	}
+
+	void Remove(const FJoltNetworkPredictionID& ID)
+	{
+		int32 SlotIdx = INDEX_NONE;
+		if (!Lookup.RemoveAndCopyValue((int32)ID, SlotIdx))
+		{
+			return;
+		}
+
+		FSlot& Slot = Slots[SlotIdx];
+		const int32 DenseIdx = Slot.DenseIdx;
+		const int32 LastDenseIdx = Dense.Num() - 1;
+		if (DenseIdx != LastDenseIdx)
+		{
+			Slots[DenseToSlot[LastDenseIdx]].DenseIdx = DenseIdx;
+		}
+
+		Dense.RemoveAtSwap(DenseIdx, 1, EAllowShrinking::No);
+		DenseToSlot.RemoveAtSwap(DenseIdx, 1, EAllowShrinking::No);
+
+		Slot.DenseIdx = INDEX_NONE;
+		FreeSlots.HeapPush(SlotIdx);
+	}
+
+	bool IsValidIndex(int32 SlotIdx) const
+	{
+		return Slots.IsValidIndex(SlotIdx) && Slots[SlotIdx].DenseIdx != INDEX_NONE;
+	}
+
+	ElementType& GetElementChecked(int32 SlotIdx)
+	{
+		jnpCheckSlow(IsValidIndex(SlotIdx));
+		return Dense[Slots[SlotIdx].DenseIdx];
+	}
+
+	int32 Num() const { return Dense.Num(); }
+
+	void Reserve(int32 Number)
+	{
+		Lookup.Reserve(Number);
+		Slots.Reserve(Number);
+		Dense.Reserve(Number);
+		DenseToSlot.Reserve(Number);
+	}
+
+private:
+
+	int32 AllocateSlot()
+	{
+		if (FreeSlots.Num() > 0)
+		{
+			int32 SlotIdx = INDEX_NONE;
+			FreeSlots.HeapPop(SlotIdx, EAllowShrinking::No);
+			return SlotIdx;
+		}
+		return Slots.AddDefaulted();
+	}
+
+	struct FSlot
+	{
+		int32 DenseIdx = INDEX_NONE;
+	};
+
+	TMap<int32, int32> Lookup;		// SpawnID -> stable slot index
+	TArray<FSlot> Slots;			// stable slot index -> dense index
+	TArray<int32> FreeSlots;		// min heap of free slot indices
+	TArray<ElementType> Dense;		// contiguous instance data
+	TArray<int32> DenseToSlot;		// dense index -> stable slot index, used to patch the moved element on removal
+};
+
 // Generic associative container for instance data keyed off of the FJoltNetworkPredictionID
-// SortedMap + SparseArray provides:
-//	-O(log n) add/remove. 
+// Dense storage provides:
+//	-O(1) add/remove/lookup.
 //	-Stable index that can be cached for O(1) lookup in various service acceleration structures
-//	-Data* are not stable out of this data structure
+//	-Data* are not stable out of this data structure (removal moves the last element into the freed spot)
 template<typename T>
 struct TJoltInstanceMap
 {
 	T& FindOrAdd(const FJoltNetworkPredictionID& ID)
 	{
-		return Data[GetIndex(ID)];
+		return Storage.GetElementChecked(Storage.GetIndex(ID));
 	}
 
 	T* Find(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex* MappedIdx = Lookup.Find((int32)ID);
-		if (MappedIdx)
-		{
-			jnpEnsure(MappedIdx->idx != INDEX_NONE);
-			return &Data[MappedIdx->idx];
-		}
-		return nullptr;
+		const int32 Idx = Storage.FindIndex(ID);
+		return Idx != INDEX_NONE ? &Storage.GetElementChecked(Idx) : nullptr;
 	}
 
 	void Remove(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex RemovedIdx;
-		if (Lookup.RemoveAndCopyValue((int32)ID, RemovedIdx))
-		{
-			Data.RemoveAt(RemovedIdx.idx);
-			LastFreeIndex = FMath::Min(LastFreeIndex, RemovedIdx.idx);
-		}
+		Storage.Remove(ID);
 	}
 
 	int32 GetIndexChecked(const FJoltNetworkPredictionID& ID)
 	{
-		return Lookup.FindChecked((int32)ID).idx;
+		return Storage.GetIndexChecked(ID);
 	}
 
 	int32 GetIndex(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex& MappedIdx = Lookup.FindOrAdd((int32)ID);
-		if (MappedIdx.idx == INDEX_NONE)
-		{
-			FSparseArrayAllocationInfo AllocationInfo = Data.AddUninitializedAtLowestFreeIndex(LastFreeIndex);
-			MappedIdx.idx = AllocationInfo.Index;
-			new (AllocationInfo.Pointer) T();
-		}
-		return MappedIdx.idx;
+		return Storage.GetIndex(ID);
 	}
 
 	T& GetByIndexChecked(int32 idx)
 	{
-		jnpCheckSlow(Data.IsValidIndex(idx));
-		return Data[idx];
+		return Storage.GetElementChecked(idx);
 	}
 
-private:
+	int32 Num() const { return Storage.Num(); }
+	void Reserve(int32 Number) { Storage.Reserve(Number); }
 
-	struct FIndex { int32 idx=INDEX_NONE; }; // just to default to INDEX_NONE for new entries
-	TSortedMap<int32, FIndex> Lookup; // Sorted map of priority (spawnID -> stable index into SparseArray)
-	int32 LastFreeIndex = 0;
+private:
 
-	TSparseArray<T> Data;
+	TJoltDenseInstanceStorage<T> Storage;
 };
 
+// Same as TJoltInstanceMap but each instance is individually allocated, so T& remain valid until the ID is removed.
 template<typename T>
 struct TJoltStableInstanceMap
 {
 	T& FindOrAdd(const FJoltNetworkPredictionID& ID)
 	{
-		return Data[GetIndex(ID)].Get();
+		return Storage.GetElementChecked(Storage.GetIndex(ID)).Get();
 	}
 
 	T* Find(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex* MappedIdx = Lookup.Find((int32)ID);
-		if (MappedIdx)
-		{
-			jnpEnsure(MappedIdx->idx != INDEX_NONE);
-			return &Data[MappedIdx->idx].Get();
-		}
-		return nullptr;
+		const int32 Idx = Storage.FindIndex(ID);
+		return Idx != INDEX_NONE ? &Storage.GetElementChecked(Idx).Get() : nullptr;
 	}
 
 	void Remove(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex RemovedIdx;
-		if (Lookup.RemoveAndCopyValue((int32)ID, RemovedIdx))
-		{
-			Data.RemoveAt(RemovedIdx.idx);
-			LastFreeIndex = FMath::Min(LastFreeIndex, RemovedIdx.idx);
-		}
+		Storage.Remove(ID);
 	}
 
 	int32 GetIndexChecked(const FJoltNetworkPredictionID& ID)
 	{
-		return Lookup.FindChecked((int32)ID).idx;
+		return Storage.GetIndexChecked(ID);
 	}
 
 	int32 GetIndex(const FJoltNetworkPredictionID& ID)
 	{
-		FIndex& MappedIdx = Lookup.FindOrAdd((int32)ID);
-		if (MappedIdx.idx == INDEX_NONE)
-		{
-			FSparseArrayAllocationInfo AllocationInfo = Data.AddUninitializedAtLowestFreeIndex(LastFreeIndex);
-			MappedIdx.idx = AllocationInfo.Index;
-			new (AllocationInfo.Pointer) TUniqueObj<T>();
-		}
-		return MappedIdx.idx;
+		return Storage.GetIndex(ID);
 	}
 
 	T& GetByIndexChecked(int32 idx)
 	{
-		jnpCheckSlow(Data.IsValidIndex(idx));
-		return Data[idx].Get();
+		return Storage.GetElementChecked(idx).Get();
 	}
 
-private:
+	int32 Num() const { return Storage.Num(); }
+	void Reserve(int32 Number) { Storage.Reserve(Number); }
 
-	struct FIndex { int32 idx=INDEX_NONE; }; // just to default to INDEX_NONE for new entries
-	TSortedMap<int32, FIndex> Lookup; // Sorted map of priority (spawnID -> stable index into SparseArray)
-	int32 LastFreeIndex = 0;
+private:
 
-	TSparseArray<TUniqueObj<T>> Data;
+	TJoltDenseInstanceStorage<TUniqueObj<T>> Storage;
 };
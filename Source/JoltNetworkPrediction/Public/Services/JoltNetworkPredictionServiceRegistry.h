@@ -127,6 +127,16 @@ public:
 		DataStore->ServerRecv_IndependentTick.Remove(ID);
 	}
 
+	// The instance's RPC handler changed while its services stayed the same, server input routing has to follow it
+	template<typename ModelDef>
+	void OnRPCHandlerChanged()
+	{
+		if (FixedInputRemote.Array.IsValidIndex(ModelDef::ID) && FixedInputRemote.Array[ModelDef::ID].IsValid())
+		{
+			static_cast<TJoltRemoteInputService<ModelDef>*>(FixedInputRemote.Array[ModelDef::ID].Get())->MarkRoutesDirty();
+		}
+	}
+
 	// -----------------------------------------------------------------------------------------
 	//	DataStore
 	// -----------------------------------------------------------------------------------------
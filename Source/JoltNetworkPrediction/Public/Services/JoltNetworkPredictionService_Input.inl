@@ -6,6 +6,11 @@
 #include "JoltNetworkPredictionReplicationProxy.h"
 #include "JoltNetworkPredictionTrace.h"
 #include "Services/JoltNetworkPredictionInstanceData.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+// Server input receive throughput. Defined in JoltNetworkPredictionWorldManager.cpp.
+TRACE_DECLARE_INT_COUNTER_EXTERN(JoltNPInputsDispatched);
+TRACE_DECLARE_INT_COUNTER_EXTERN(JoltNPInputBitsDispatched);
 
 
 namespace NetworkPredictionCVars
@@ -28,7 +33,7 @@ public:
 
 	virtual ~IJoltInputService() = default;
 	virtual void ProduceInput(int32 DeltaTimeMS, const float& InterpolationTimeMS) = 0;
-	virtual void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime , const TArray<FJoltSimulationReplicatedInput>& Inputs
+	virtual void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime , TConstArrayView<FJoltSimulationReplicatedInput> Inputs
 		,UJoltNetworkPredictionPlayerControllerComponent* InputHandler
 		,FJoltFixedTickState* TickState) = 0;
 };
@@ -82,7 +87,7 @@ public:
 		}
 	}
 
-	void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime, const TArray<FJoltSimulationReplicatedInput>& Inputs
+	void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime, TConstArrayView<FJoltSimulationReplicatedInput> Inputs
 		, UJoltNetworkPredictionPlayerControllerComponent* InputHandler
 		,FJoltFixedTickState* TickState) final override
 	{
@@ -131,59 +136,80 @@ public:
 		
 		const int32 ServerRecvIdx = DataStore->ServerRecv.GetIndex(ID);
 		InstanceMap.Add((int32)ID, FInstance{ID.GetTraceID(), InstanceIndex, ServerRecvIdx});
+		bRoutesDirty = true;
 	}
 
 	void UnregisterInstance(FJoltNetworkPredictionID ID)
 	{
 		InstanceMap.Remove(ID);
+		bRoutesDirty = true;
+	}
+	
+	// An instance's RPC handler changed without its services changing, e.g. its pawn was possessed by a new controller
+	void MarkRoutesDirty()
+	{
+		bRoutesDirty = true;
 	}
 
-	void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime,const TArray<FJoltSimulationReplicatedInput>& Inputs
+	void OnFixedInputReceived(const int32& ClientFrame,const float& InterpolationTime,TConstArrayView<FJoltSimulationReplicatedInput> Inputs
 		,UJoltNetworkPredictionPlayerControllerComponent* RPCHandler
 		,FJoltFixedTickState* TickState) final override
 	{
 		jnpEnsure(ClientFrame >= 0);
-		for (auto& MapIt : InstanceMap)
+		const FHandlerRoutes* HandlerRoutes = FindRoutes(RPCHandler);
+		if (!HandlerRoutes)
 		{
-			FInstance& Instance = MapIt.Value;
-			TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(Instance.InstanceIndex);
-			if (RPCHandler != InstanceData.Info.RPCHandler || !InstanceData.Info.RPCHandler)
+			// None of this model's instances take input from this handler
+			return;
+		}
+
+		// One reader shared by every RPC, pointed at each input in turn
+		UNetConnection* NetConnection = RPCHandler->GetNetConnection();
+		Reader.PackageMap = NetConnection->PackageMap;
+		FJoltNetSerializeParams Params(Reader,NetConnection->PackageMap,EJoltReplicationProxyTarget::ServerRPC);
+
+		for (const FJoltSimulationReplicatedInput& Input : Inputs)
+		{
+			// Inputs of other models' instances go to their own services
+			const FRoute* Route = HandlerRoutes->Find((int32)Input.ID);
+			if (!Route)
 			{
-				continue; 
+				continue;
 			}
-			//ToDO : Make const TArray<FJoltSimulationReplicatedInput> a TMap, Loop through InstanceMap and Lookup in TMap
-			for (const FJoltSimulationReplicatedInput& Input : Inputs)
+
+			TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(Route->InstanceIndex);
+			if (InstanceData.Info.RPCHandler != RPCHandler)
 			{
-				if (Input.ID != MapIt.Key)
-				{
-					continue;
-				}
+				// Handler changed since the routes were built
+				bRoutesDirty = true;
+				continue;
+			}
 
-				UNetConnection* NetConnection = InstanceData.Info.RPCHandler->GetNetConnection();
-				FNetBitReader Reader(NetConnection->PackageMap,Input.InputData.GetData(),Input.DataSize);
-				FJoltNetSerializeParams Params(Reader,NetConnection->PackageMap,EJoltReplicationProxyTarget::ServerRPC);
+			Reader.ResetData(Input.InputData.GetData(), Input.DataSize);
 			
-				UE_JNP_TRACE_SIM(Instance.TraceID);
-				TJoltServerRecvData_Fixed<ModelDef>& ServerRecvData = DataStore->ServerRecv.GetByIndexChecked(Instance.ServerRecvIdx);
-				for (int32 DroppedFrame = RPCHandler->LastReceivedFrame+1; DroppedFrame < ClientFrame; ++DroppedFrame)
+			UE_JNP_TRACE_SIM(Route->TraceID);
+			TJoltServerRecvData_Fixed<ModelDef>& ServerRecvData = DataStore->ServerRecv.GetByIndexChecked(Route->ServerRecvIdx);
+			for (int32 DroppedFrame = RPCHandler->LastReceivedFrame+1; DroppedFrame < ClientFrame; ++DroppedFrame)
+			{
+				UE_JNP_TRACE_SYSTEM_FAULT("Gap in input stream detected on server. Client frames involved: LastConsumedFrame: %d LastRecvFrame: %d. DroppedFrame: %d", ServerRecvData.LastConsumedFrame, ServerRecvData.LastRecvFrame, DroppedFrame);
+				if (DroppedFrame > 0)
 				{
-					UE_JNP_TRACE_SYSTEM_FAULT("Gap in input stream detected on server. Client frames involved: LastConsumedFrame: %d LastRecvFrame: %d. DroppedFrame: %d", ServerRecvData.LastConsumedFrame, ServerRecvData.LastRecvFrame, DroppedFrame);
-					if (DroppedFrame > 0)
-					{
-						// FixedTick can't skip frames like independent, so copy previous input
-						ServerRecvData.InputBuffer[DroppedFrame] = ServerRecvData.InputBuffer[DroppedFrame-1];
-					}
+					// FixedTick can't skip frames like independent, so copy previous input
+					ServerRecvData.InputBuffer[DroppedFrame] = ServerRecvData.InputBuffer[DroppedFrame-1];
 				}
-			
-				FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(ServerRecvData.InputBuffer[ClientFrame].Value, Params); // 2. InputCmd
-				ServerRecvData.InputBuffer[ClientFrame].Key = InterpolationTime;
-				ServerRecvData.LastRecvFrame = ClientFrame;
-				// Trace what we received
-				const int32 ExpectedFrameDelay = ClientFrame - RPCHandler->LastConsumedFrame;
-				const int32 ExpectedConsumeFrame = TickState->PendingFrame + ExpectedFrameDelay - 1;
-				UE_JNP_TRACE_NET_RECV(ExpectedConsumeFrame, ExpectedConsumeFrame * TickState->FixedStepMS);
-				UE_JNP_TRACE_USER_STATE_INPUT(ModelDef, ServerRecvData.InputBuffer[ClientFrame].Value.Get());
 			}
+		
+			FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(ServerRecvData.InputBuffer[ClientFrame].Value, Params); // 2. InputCmd
+			ServerRecvData.InputBuffer[ClientFrame].Key = InterpolationTime;
+			ServerRecvData.LastRecvFrame = ClientFrame;
+			// Trace what we received
+			const int32 ExpectedFrameDelay = ClientFrame - RPCHandler->LastConsumedFrame;
+			const int32 ExpectedConsumeFrame = TickState->PendingFrame + ExpectedFrameDelay - 1;
+			UE_JNP_TRACE_NET_RECV(ExpectedConsumeFrame, ExpectedConsumeFrame * TickState->FixedStepMS);
+			UE_JNP_TRACE_USER_STATE_INPUT(ModelDef, ServerRecvData.InputBuffer[ClientFrame].Value.Get());
+			
+			TRACE_COUNTER_INCREMENT(JoltNPInputsDispatched);
+			TRACE_COUNTER_ADD(JoltNPInputBitsDispatched, Input.DataSize);
 		}
 	};
 
@@ -229,15 +255,24 @@ public:
 			
 			if (NetworkPredictionCVars::DisableTimeDilation() == 0)
 			{
-				UNetConnection* NetConnection = InstanceData.Info.RPCHandler->GetNetConnection();
 				const int32 LastReceivedFrame = InstanceData.Info.RPCHandler->LastReceivedFrame;
 				const int32 LastConsumedFrame = InstanceData.Info.RPCHandler->LastConsumedFrame;
-				const float PingMS = NetConnection->AvgLag * 1000.f;
-				// Jitter up to fixed tick time is covered by the 1 frame of fixed buffered frames.
-				const float PacketLossFrames = NetConnection->InPacketsLost + NetConnection->OutPacketsLost;
-				int32 JitterFrames = FMath::RoundToInt32(NetConnection->GetAverageJitterInMS() / DeltaTimeMS);
-				const int32 DesiredBufferedFrames = DesiredBufferedInputs + JitterFrames + PacketLossFrames;
-				int32 BufferOffset =  (LastReceivedFrame - LastConsumedFrame)  - DesiredBufferedFrames;// - ServerRecvState->InputFault;
+				int32 BufferOffset = 0;
+				const FJoltInputJitterBuffer& InputJitter = InstanceData.Info.RPCHandler->GetInputJitter();
+				if (InputJitter.IsEnabled())
+				{
+					// Desired depth from the client's measured jitter and loss, offset smoothed so single late packets don't dilate
+					BufferOffset = InputJitter.GetBufferOffset();
+				}
+				else
+				{
+					UNetConnection* NetConnection = InstanceData.Info.RPCHandler->GetNetConnection();
+					// Jitter up to fixed tick time is covered by the 1 frame of fixed buffered frames.
+					const float PacketLossFrames = NetConnection->InPacketsLost + NetConnection->OutPacketsLost;
+					int32 JitterFrames = FMath::RoundToInt32(NetConnection->GetAverageJitterInMS() / DeltaTimeMS);
+					const int32 DesiredBufferedFrames = DesiredBufferedInputs + JitterFrames + PacketLossFrames;
+					BufferOffset =  (LastReceivedFrame - LastConsumedFrame)  - DesiredBufferedFrames;// - ServerRecvState->InputFault;
+				}
 				if (LastReceivedFrame == INDEX_NONE || LastConsumedFrame == INDEX_NONE)
 				{
 					BufferOffset = INT8_MAX;
@@ -297,6 +332,65 @@ private:
 
 	TSortedMap<int32, FInstance> InstanceMap;
 	TJoltModelDataStore<ModelDef>* DataStore;
+
+	// Server input routing: RPC handler -> instance ID -> where its received inputs go
+	struct FRoute
+	{
+		int32 TraceID;
+		int32 InstanceIndex;
+		int32 ServerRecvIdx;
+	};
+	using FHandlerRoutes = TSortedMap<int32, FRoute, TInlineAllocator<2>>;
+	TMap<const UJoltNetworkPredictionPlayerControllerComponent*, FHandlerRoutes> Routes;
+	bool bRoutesDirty = true;
+	
+	// Handlers still without routes after a rebuild, so input of other models' instances does not rebuild on every RPC
+	TSet<const UJoltNetworkPredictionPlayerControllerComponent*> UnroutedHandlers;
+
+	void RebuildRoutes()
+	{
+		Routes.Reset();
+		for (auto& MapIt : InstanceMap)
+		{
+			const FInstance& Instance = MapIt.Value;
+			const TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(Instance.InstanceIndex);
+			if (InstanceData.Info.RPCHandler)
+			{
+				Routes.FindOrAdd(InstanceData.Info.RPCHandler).Add(MapIt.Key, FRoute{Instance.TraceID, Instance.InstanceIndex, Instance.ServerRecvIdx});
+			}
+		}
+		bRoutesDirty = false;
+	}
+
+	const FHandlerRoutes* FindRoutes(const UJoltNetworkPredictionPlayerControllerComponent* RPCHandler)
+	{
+		if (!RPCHandler)
+		{
+			return nullptr;
+		}
+		
+		if (bRoutesDirty)
+		{
+			RebuildRoutes();
+			UnroutedHandlers.Reset();
+		}
+		
+		const FHandlerRoutes* HandlerRoutes = Routes.Find(RPCHandler);
+		if (!HandlerRoutes && !UnroutedHandlers.Contains(RPCHandler))
+		{
+			// A handler change that was not reported would drop this client's input for good, so look again once
+			RebuildRoutes();
+			HandlerRoutes = Routes.Find(RPCHandler);
+			if (!HandlerRoutes)
+			{
+				UnroutedHandlers.Add(RPCHandler);
+			}
+		}
+		return HandlerRoutes;
+	}
+
+	// Keeps its buffer across inputs and RPCs so dispatch does not allocate once warm
+	TJoltReusableBitReader<FNetBitReader> Reader{nullptr, nullptr, 0};
 	
 	inline static int32 MaxFaultLimit = 6;
 
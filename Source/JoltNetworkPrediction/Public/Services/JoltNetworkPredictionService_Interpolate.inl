@@ -7,6 +7,7 @@
 #include "JoltNetworkPredictionTickState.h"
 #include "JoltNetworkPredictionTrace.h"
 #include "JoltNetworkPredictionUtil.h"
+#include "JoltNetworkPredictionInterpolationChannels.h"
 #include "Services/JoltNetworkPredictionInstanceData.h"
 
 // Interpolation does generic linear interpolation on received replicated data.
@@ -35,6 +36,7 @@ namespace NetworkPredictionCVars
 	JOLTNETSIM_DEVCVAR_SHIPCONST_INT(DrawInterpolation, 0, "j.np.Interpolation.Draw", "Draw interpolation debug state in world");
 
 	JOLTNETSIM_DEVCVAR_SHIPCONST_INT(DisableInterpolation, 0, "j.np.Interpolation.Disable", "Disables smooth interpolation and just Finalizes the last received frame");
+	JOLTNETSIM_DEVCVAR_SHIPCONST_INT(InterpolationChannels, 1, "j.np.Interpolation.Channels", "Fixed tick models whose sync state exposes interpolation channels are interpolated in one batched pass. 0 calls Interpolate per instance instead.");
 }
 
 
@@ -87,7 +89,7 @@ public:
 		// Point the PresentationView to our managed state. Note this only has to be done once
 		FInstance* InternalInstance = (FInstance*)AllocInfo.Pointer;
 		InstanceData.Info.View->UpdatePresentationView(InternalInstance->SyncState, InternalInstance->AuxState);
-		
+		bChannelWindowDirty = true;
 	}
 
 	void UnregisterInstance(FJoltNetworkPredictionID ID)
@@ -108,6 +110,7 @@ public:
 		
 		ClientRecvBitMask[ClientRecvIdx] = false;
 		Instances.RemoveAt(ClientRecvIdx);
+		bChannelWindowDirty = true;
 	}
 
 	void Reconcile(FJoltFixedTickState* TickState) final override
@@ -199,6 +202,7 @@ public:
 
 			// We've taken care of this instance, reset it for next time
 			DataStore->ClientRecvBitMask[ClientRecvIdx] = false;
+			bChannelWindowDirty = true;
 		}
 	}
 
@@ -230,13 +234,14 @@ public:
 			return;
 		}
 		
+		const bool bBatchChannels = UseInterpolationChannels();
+		bChannelWindowDirty |= !bBatchChannels;
+
 		for (auto& It : Instances)
 		{
 			FInstance& Instance = It;
 			UE_JNP_TRACE_SIM(Instance.TraceID);
 
-			TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(Instance.FramesIdx);
-			
 			// Ensure To/From frames are valid (replication code have been starved while local interpolation state marches on)
 			if (Instance.LastWrittenFrame < ToFrame)
 			{
@@ -246,6 +251,8 @@ public:
 					continue;
 				}
 
+				TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(Instance.FramesIdx);
+
 				//UE_JNP_TRACE_SYSTEM_FAULT("Invalid interpolation frames. Copying old content forward. LastWrittenFrame: %d. ToFrame: %d", Instance.LastWrittenFrame, ToFrame);
 				if (Instance.LastWrittenFrame < FromFrame)
 				{
@@ -256,10 +263,18 @@ public:
 
 				Instance.LastWrittenFrame = ToFrame;
 				jnpEnsureSlow(Instance.LastWrittenFrame >= 0);
+				bChannelWindowDirty = true;
+			}
+
+			if (bBatchChannels)
+			{
+				continue;
 			}
 
 			// Interpolate and dispatch
 			{
+				TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(Instance.FramesIdx);
+
 				typename TJoltInstanceFrameState<ModelDef>::FFrame& FromFrameData = Frames.Buffer[FromFrame];
 				typename TJoltInstanceFrameState<ModelDef>::FFrame& ToFrameData = Frames.Buffer[ToFrame];
 
@@ -280,10 +295,106 @@ public:
 				FJoltNetworkPredictionDriver<ModelDef>::DispatchCues(&InstanceData.CueDispatcher.Get(), InstanceData.Info.Driver, FromFrame, InterpolatedTimeMS, 0);
 			}
 		}
+
+		if constexpr (FJoltNetworkPredictionDriver<ModelDef>::HasInterpolationChannels)
+		{
+			if (bBatchChannels)
+			{
+				FinalizeChannels(FromFrame, ToFrame, PCT, InterpolatedTimeMS);
+			}
+		}
 	}
 
 private:
 
+	static bool UseInterpolationChannels()
+	{
+		if constexpr (FJoltNetworkPredictionDriver<ModelDef>::HasInterpolationChannels)
+		{
+			return NetworkPredictionCVars::InterpolationChannels() > 0;
+		}
+		return false;
+	}
+
+	// Batched path for sync states with interpolation channels. The From/To channels of every instance are gathered into
+	// ChannelBuffer once per interpolation window, every render frame then blends them in one pass and hands all results
+	// to the drivers together.
+	void FinalizeChannels(const int32 FromFrame, const int32 ToFrame, const float PCT, const int32 InterpolatedTimeMS)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(JoltNetworkPrediction::InterpolateChannels);
+
+		if (bChannelWindowDirty || ChannelWindowToFrame != ToFrame)
+		{
+			GatherChannelWindow(FromFrame, ToFrame);
+		}
+
+		ChannelBuffer.Interpolate(PCT);
+
+		FJoltInterpolationChannels Channels;
+		for (int32 Slot = 0; Slot < ChannelSlots.Num(); ++Slot)
+		{
+			ChannelBuffer.GetResult(Slot, Channels);
+			Instances[ChannelSlots[Slot]].SyncState->SetInterpolationChannels(Channels);
+		}
+
+		FJoltNetworkPredictionDriver<ModelDef>::FinalizeInterpolatedFrames(ChannelDrivers, ChannelSyncs, ChannelAuxes);
+
+		for (const int32 InstanceIdx : ChannelSlots)
+		{
+			FInstance& Instance = Instances[InstanceIdx];
+			UE_JNP_TRACE_SIM(Instance.TraceID);
+
+			TInstanceData<ModelDef>& InstanceData = DataStore->Instances.GetByIndexChecked(Instance.InstanceIdx);
+			typename TJoltInstanceFrameState<ModelDef>::FFrame& ToFrameData = DataStore->Frames.GetByIndexChecked(Instance.FramesIdx).Buffer[ToFrame];
+
+			// See the FIXME on UpdateView in FinalizeFrame
+			InstanceData.Info.View->UpdateView(ToFrame, InterpolatedTimeMS, &ToFrameData.InputCmd, ToFrameData.SyncState, ToFrameData.AuxState);
+			FJoltNetworkPredictionDriver<ModelDef>::DispatchCues(&InstanceData.CueDispatcher.Get(), InstanceData.Info.Driver, FromFrame, InterpolatedTimeMS, 0);
+		}
+	}
+
+	void GatherChannelWindow(const int32 FromFrame, const int32 ToFrame)
+	{
+		ChannelSlots.Reset();
+		ChannelDrivers.Reset();
+		ChannelSyncs.Reset();
+		ChannelAuxes.Reset();
+		ChannelBuffer.SetNum(Instances.Num());
+
+		FJoltInterpolationChannels FromChannels;
+		FJoltInterpolationChannels ToChannels;
+		for (auto It = Instances.CreateIterator(); It; ++It)
+		{
+			FInstance& Instance = *It;
+			if (Instance.LastWrittenFrame < ToFrame)
+			{
+				// Nothing received yet
+				continue;
+			}
+
+			TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(Instance.FramesIdx);
+			typename TJoltInstanceFrameState<ModelDef>::FFrame& FromFrameData = Frames.Buffer[FromFrame];
+			typename TJoltInstanceFrameState<ModelDef>::FFrame& ToFrameData = Frames.Buffer[ToFrame];
+
+			// Everything outside of the channels comes from the frame we are interpolating to
+			Instance.SyncState = ToFrameData.SyncState;
+			Instance.AuxState = ToFrameData.AuxState;
+
+			FromFrameData.SyncState->GetInterpolationChannels(FromChannels);
+			ToFrameData.SyncState->GetInterpolationChannels(ToChannels);
+			ChannelBuffer.SetWindow(ChannelSlots.Num(), FromChannels, ToChannels);
+
+			ChannelSlots.Add(It.GetIndex());
+			ChannelDrivers.Add(DataStore->Instances.GetByIndexChecked(Instance.InstanceIdx).Info.Driver);
+			ChannelSyncs.Add(Instance.SyncState.Get());
+			ChannelAuxes.Add(Instance.AuxState.Get());
+		}
+
+		ChannelBuffer.SetNum(ChannelSlots.Num());
+		ChannelWindowToFrame = ToFrame;
+		bChannelWindowDirty = false;
+	}
+
 	struct FInstance
 	{
 		FInstance(int32 InTraceID, int32 InInstanceIdx, int32 InFramesIdx)
@@ -306,6 +417,15 @@ private:
 
 	TJoltModelDataStore<ModelDef>* DataStore;
 
+	// Interpolation channel batch, slot order. Rebuilt when the window moves or any instance's frames change.
+	FJoltInterpolationChannelBuffer ChannelBuffer;
+	TArray<int32> ChannelSlots; // Indices into Instances
+	TArray<typename ModelDef::Driver*> ChannelDrivers;
+	TArray<const SyncType*> ChannelSyncs;
+	TArray<const AuxType*> ChannelAuxes;
+	int32 ChannelWindowToFrame = INDEX_NONE;
+	bool bChannelWindowDirty = true;
+
 
 	static void CopyFrameData(int32 SourceFrame, int32 DestFrame, TJoltInstanceFrameState<ModelDef>& Frames, FInstance& Instance)
 	{
@@ -125,23 +125,37 @@ public:
 			UJoltNetworkPredictionPlayerControllerComponent* RPCHandler = InstanceData.Info.RPCHandler;
 			if (RPCHandler && RPCHandler->GetNetConnection())
 			{
-				UPackageMap* Map = RPCHandler->GetNetConnection()->PackageMap;
-				FNetBitWriter TempWriter(Map,0);
-				FJoltNetSerializeParams Params(TempWriter,Map,EJoltReplicationProxyTarget::ServerRPC);
 				TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(Instance.FramesID);
-				if (NetworkPredictionCVars::ForceSendDefaultInputCommands())
+				
+				// Every frame is sent FixedTickInputSendCount times, but local input never changes once produced: serialize it once
+				if (Instance.SerializedInputs.Num() == 0)
 				{
-					// for debugging, send blank default input instead of what we've produced locally
-					static TJoltConditionalState<InputType> DefaultInputCmd;
-					FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(DefaultInputCmd, Params); 
+					Instance.SerializedInputs.SetNum(NumCachedInputs);
 				}
-				else
+				FSerializedInput& Serialized = Instance.SerializedInputs[Frame % NumCachedInputs];
+				if (Serialized.Frame != Frame)
 				{
-					FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(Frames.Buffer[Frame].InputCmd, Params); // 2. InputCmd
+					UPackageMap* Map = RPCHandler->GetNetConnection()->PackageMap;
+					ScratchWriter.Reset();
+					ScratchWriter.PackageMap = Map;
+					FJoltNetSerializeParams Params(ScratchWriter,Map,EJoltReplicationProxyTarget::ServerRPC);
+					if (NetworkPredictionCVars::ForceSendDefaultInputCommands())
+					{
+						// for debugging, send blank default input instead of what we've produced locally
+						static TJoltConditionalState<InputType> DefaultInputCmd;
+						FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(DefaultInputCmd, Params); 
+					}
+					else
+					{
+						FJoltNetworkPredictionDriver<ModelDef>::NetSerialize(Frames.Buffer[Frame].InputCmd, Params); // 2. InputCmd
+					}
+
+					Serialized.Frame = Frame;
+					Serialized.DataSize = (uint32)ScratchWriter.GetNumBits();
+					Serialized.Data.Set(ScratchWriter.GetData(), (int32)ScratchWriter.GetNumBytes());
 				}
 
-				uint32 DataSize = (uint32)TempWriter.GetNumBits();
-				RPCHandler->AddInputToSend(MapIt.Key, DataSize,*TempWriter.GetBuffer());
+				RPCHandler->AddInputToSend(MapIt.Key, Serialized.DataSize, Serialized.Data);
 				RPCHandler->InterpolationTimeMS = Frames.Buffer[Frame].InterpolationTimeMS;
 			}
 		}
@@ -150,6 +164,17 @@ public:
 
 private:
 
+	// Serialized InputCmd of a frame, reused while the frame is inside the send window
+	struct FSerializedInput
+	{
+		int32 Frame = INDEX_NONE;
+		uint32 DataSize = 0;
+		FJoltInputPayload Data;
+	};
+	
+	// Must cover the largest FixedTickInputSendCount
+	static constexpr int32 NumCachedInputs = 32;
+
 	// The vast majority of the time there will be <= 1 instances that wants to call the ServerRPC.
 	// Only split screen type situations will require more.
 	struct FInstance
@@ -158,8 +183,12 @@ private:
 		int32 FramesID;
 		int32 InstanceIndex;
 		DriverType* Driver;
+		TArray<FSerializedInput> SerializedInputs;
 	};
 
 	TSortedMap<int32, FInstance, TInlineAllocator<1>> Instances;
 	TJoltModelDataStore<ModelDef>* DataStore;
+
+	// Shared by every instance, keeps its buffer between frames
+	FNetBitWriter ScratchWriter{nullptr, 0};
 };
\ No newline at end of file
@@ -4,11 +4,19 @@
 
 // HEADER_UNIT_SKIP - Not included directly
 
+#include "Async/ParallelFor.h"
+#include "JoltNetworkPredictionCVars.h"
 #include "JoltNetworkPredictionInstanceData.h"
 #include "JoltNetworkPredictionTickState.h"
 #include "JoltNetworkPredictionTrace.h"
 #include "JoltNetworkPredictionUtil.h"
 
+namespace NetworkPredictionCVars
+{
+	JOLTNETSIM_DEVCVAR_SHIPCONST_INT(ParallelTick,				0, "j.np.Tick.Parallel",				"Tick simulations whose ModelDef supports it concurrently on worker threads. World writes are deferred and committed serially in ID order.");
+	JOLTNETSIM_DEVCVAR_SHIPCONST_INT(ParallelTickMinBatchSize,	4, "j.np.Tick.Parallel.MinBatchSize",	"Batches with fewer parallel-eligible instances than this are ticked on the calling thread.");
+}
+
 // Common util used by the ticking services. Might make sense to move to FJoltNetworkPredictionDriverBase if needed elsewhere
 template<typename ModelDef>
 struct TJoltTickUtil
@@ -21,7 +29,7 @@ struct TJoltTickUtil
 	using FrameDataType = typename TJoltInstanceFrameState<ModelDef>::FFrame;
 
 	template<typename SimulationType = typename ModelDef::Simulation>
-	static typename TEnableIf<!std::is_same_v<SimulationType, void>>::Type DoTick(TInstanceData<ModelDef>& Instance, FrameDataType& InputFrameData, FrameDataType& OutputFrameData, const FJoltNetSimTimeStep& Step, const int32 CueTimeMS, EJoltSimulationTickContext TickContext)
+	static typename TEnableIf<!std::is_same_v<SimulationType, void>>::Type DoTick(TInstanceData<ModelDef>& Instance, FrameDataType& InputFrameData, FrameDataType& OutputFrameData, const FJoltNetSimTimeStep& Step, const int32 CueTimeMS, EJoltSimulationTickContext TickContext, const bool bTraceOutput = true)
 	{
 		Instance.CueDispatcher->PushContext({Step.Frame, CueTimeMS, TickContext});
 		
@@ -49,15 +57,52 @@ struct TJoltTickUtil
 		View->bTickInProgress = false;
 		Instance.CueDispatcher->PopContext();
 
+		// Trace state is global, so parallel ticks trace their output later from the commit loop instead
+		if (bTraceOutput)
+		{
+			TraceTickOutput(OutputFrameData);
+		}
+	}
+
+	template<typename SimulationType = typename ModelDef::Simulation>
+	static typename TEnableIf<std::is_same_v<SimulationType, void>>::Type DoTick(TInstanceData<ModelDef>& Instance, FrameDataType& InputFrameData, FrameDataType& OutputFrameData, const FJoltNetSimTimeStep& Step, const int32 EndTimeMS, EJoltSimulationTickContext TickContext, const bool bTraceOutput = true)
+	{
+		jnpCheckf(false, TEXT("DoTick called on %s with no Simulation defined"), ModelDef::GetName());
+	}
+
+	static void TraceTickOutput(FrameDataType& OutputFrameData)
+	{
 		// Fixme: should only trace aux if it changed
 		UE_JNP_TRACE_USER_STATE_SYNC(ModelDef, OutputFrameData.SyncState.Get());
 		UE_JNP_TRACE_USER_STATE_AUX(ModelDef, OutputFrameData.AuxState.Get());
 	}
 
-	template<typename SimulationType = typename ModelDef::Simulation>
-	static typename TEnableIf<std::is_same_v<SimulationType, void>>::Type DoTick(TInstanceData<ModelDef>& Instance, FrameDataType& InputFrameData, FrameDataType& OutputFrameData, const FJoltNetSimTimeStep& Step, const int32 EndTimeMS, EJoltSimulationTickContext TickContext)
+	// Parallel tick protocol, only instantiated for ModelDefs that return true from SupportsParallelTick.
+	// The simulation decides per instance whether it can tick off the game thread. Once begun, it must not write to
+	// the world from SimulationTick and instead buffer those writes until CommitParallelSimulationTick.
+	static bool CanTickInParallel(TInstanceData<ModelDef>& Instance)
 	{
-		jnpCheckf(false, TEXT("DoTick called on %s with no Simulation defined"), ModelDef::GetName());
+		if constexpr (ModelDef::SupportsParallelTick())
+		{
+			return Instance.Info.Simulation->CanSimulationTickInParallel();
+		}
+		return false;
+	}
+
+	static void BeginParallelTick(TInstanceData<ModelDef>& Instance)
+	{
+		if constexpr (ModelDef::SupportsParallelTick())
+		{
+			Instance.Info.Simulation->BeginParallelSimulationTick();
+		}
+	}
+
+	static void CommitParallelTick(TInstanceData<ModelDef>& Instance)
+	{
+		if constexpr (ModelDef::SupportsParallelTick())
+		{
+			Instance.Info.Simulation->CommitParallelSimulationTick();
+		}
 	}
 };
 
@@ -126,6 +171,15 @@ protected:
 		const int32 StartTime = Step.TotalSimulationTime;
 		const int32 EndTime = ServiceStep.EndTotalSimulationTime;
 
+		if constexpr (ModelDef::SupportsParallelTick())
+		{
+			if (NetworkPredictionCVars::ParallelTick() > 0)
+			{
+				TickParallel_Internal<bIsResim>(InputFrame, OutputFrame, Step, EndTime);
+				return;
+			}
+		}
+
 		for (auto It : InstancesToTick)
 		{
 			TInstanceData<ModelDef>& Instance = DataStore->Instances.GetByIndexChecked(It.Value.InstanceIdx);
@@ -147,6 +201,63 @@ protected:
 		}
 	}
 
+	// Three phases:
+	//	-Prepare (serial, ID order): copy input, tick instances that can't run in parallel, collect the ones that can.
+	//	-Tick (parallel): SimulationTick on the collected instances. They only read from the world and write to their own frame buffers.
+	//	-Commit (serial, ID order): flush each instance's deferred world writes and trace its output.
+	// Commit order only depends on the IDs, never on worker scheduling, so the results match between runs.
+	template<bool bIsResim>
+	void TickParallel_Internal(const int32 InputFrame, const int32 OutputFrame, const FJoltNetSimTimeStep& Step, const int32 EndTime)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(JoltNetworkPrediction::TickParallel);
+
+		ParallelBatch.Reset();
+
+		for (auto It : InstancesToTick)
+		{
+			TInstanceData<ModelDef>& Instance = DataStore->Instances.GetByIndexChecked(It.Value.InstanceIdx);
+			TJoltInstanceFrameState<ModelDef>& Frames = DataStore->Frames.GetByIndexChecked(It.Value.FrameBufferIdx);
+
+			typename TJoltInstanceFrameState<ModelDef>::FFrame& InputFrameData = Frames.Buffer[InputFrame];
+			typename TJoltInstanceFrameState<ModelDef>::FFrame& OutputFrameData = Frames.Buffer[OutputFrame];
+
+			if (!bIsResim || Instance.NetRole == ROLE_SimulatedProxy)
+			{
+				OutputFrameData.InputCmd = InputFrameData.InputCmd;
+			}
+
+			if (TJoltTickUtil<ModelDef>::CanTickInParallel(Instance))
+			{
+				TJoltTickUtil<ModelDef>::BeginParallelTick(Instance);
+				ParallelBatch.Add({ &Instance, &InputFrameData, &OutputFrameData, It.Value.TraceID });
+				continue;
+			}
+
+			UE_JNP_TRACE_SIM_TICK(It.Value.TraceID);
+			TJoltTickUtil<ModelDef>::DoTick(Instance, InputFrameData, OutputFrameData, Step, EndTime, GetTickContext<bIsResim>(Instance.NetRole));
+		}
+
+		if (ParallelBatch.Num() == 0)
+		{
+			return;
+		}
+
+		const EParallelForFlags Flags = ParallelBatch.Num() < NetworkPredictionCVars::ParallelTickMinBatchSize() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+		ParallelFor(ParallelBatch.Num(), [this, &Step, EndTime](int32 BatchIdx)
+		{
+			FParallelTickEntry& Entry = ParallelBatch[BatchIdx];
+			TJoltTickUtil<ModelDef>::DoTick(*Entry.Instance, *Entry.InputFrameData, *Entry.OutputFrameData, Step, EndTime, GetTickContext<bIsResim>(Entry.Instance->NetRole), false);
+		}, Flags);
+
+		for (FParallelTickEntry& Entry : ParallelBatch)
+		{
+			TJoltTickUtil<ModelDef>::CommitParallelTick(*Entry.Instance);
+
+			UE_JNP_TRACE_SIM_TICK(Entry.TraceID);
+			TJoltTickUtil<ModelDef>::TraceTickOutput(*Entry.OutputFrameData);
+		}
+	}
+
 	template<bool bIsResim>
 	EJoltSimulationTickContext GetTickContext(ENetRole NetRole)
 	{
@@ -189,8 +300,18 @@ protected:
 		int32 FrameBufferIdx; // idx into TJoltModelDataStore::Frames
 	};
 
+	struct FParallelTickEntry
+	{
+		TInstanceData<ModelDef>* Instance;
+		typename TJoltInstanceFrameState<ModelDef>::FFrame* InputFrameData;
+		typename TJoltInstanceFrameState<ModelDef>::FFrame* OutputFrameData;
+		int32 TraceID;
+	};
+
 	TSortedMap<int32, FInstance> InstancesToTick;
 	TJoltModelDataStore<ModelDef>* DataStore;
+
+	TArray<FParallelTickEntry> ParallelBatch; // Scratch for TickParallel_Internal, kept around to avoid reallocating every tick
 	
 };
 
@@ -7,6 +7,7 @@ using System.Text;
 using UnrealBuildTool;
 using System.Linq;
 using System.Text.RegularExpressions;
+using EpicGames.Core;
 
 
 public class UnrealJoltLibrary : ModuleRules
@@ -28,7 +29,11 @@ public class UnrealJoltLibrary : ModuleRules
 		var cmakeOptions = "";
 
 		// NOTE: for big worlds, larger than 5KM. https://jrouwe.github.io/JoltPhysics/index.html#big-worlds 
-		/*cmakeOptions += " -DDOUBLE_PRECISION=ON"; */ // Uncomment this if you need double precision. This is 8-10% slower
+		// Large world mode, see MBuildUtils.UseDoublePrecision. This is 8-10% slower
+		if (MBuildUtils.UseDoublePrecision(Target))
+		{
+			cmakeOptions += " -DDOUBLE_PRECISION=ON ";
+		}
 		cmakeOptions += " -DCROSS_PLATFORM_DETERMINISTIC=ON ";
 		cmakeOptions += " -DOBJECT_LAYER_BITS=32 ";
 		
@@ -199,7 +204,12 @@ public class UnrealJoltLibrary : ModuleRules
 
 		// Now add the Jolt macros on the Module: for well-formed ABI ---
 		// Available defines https://jrouwe.github.io/JoltPhysics/md__build_2_r_e_a_d_m_e.html#autotoc_md70
-		/*PublicDefinitions.Add("JPH_DOUBLE_PRECISION");*/ // Uncomment this if you need double precision. This is 8-10% slower
+		// Must match the DOUBLE_PRECISION cmake option the library was built with
+		if (MBuildUtils.UseDoublePrecision(Target))
+		{
+			Console.WriteLine("Building Jolt: DOUBLE PRECISION");
+			PublicDefinitions.Add("JPH_DOUBLE_PRECISION");
+		}
 		PublicDefinitions.Add("JPH_CROSS_PLATFORM_DETERMINISTIC");
 		PublicDefinitions.Add("JPH_OBJECT_LAYER_BITS=32");
 		PublicDefinitions.Add("JPH_OBJECT_STREAM");
@@ -353,6 +363,25 @@ public class MBuildUtils {
 	}
 
 	
+	/* Large world mode. Builds Jolt and everything including it with JPH_DOUBLE_PRECISION, so positions (RVec3) are doubles.
+	   Enable with
+	       [JoltPhysics.Build]
+	       bDoublePrecision=True
+	   in the project's DefaultEngine.ini, or by setting the JOLT_DOUBLE_PRECISION=1 environment variable for a one off build.
+	   */
+	public static bool UseDoublePrecision(ReadOnlyTargetRules Target)
+	{
+		if (Environment.GetEnvironmentVariable("JOLT_DOUBLE_PRECISION") == "1")
+		{
+			return true;
+		}
+
+		DirectoryReference ProjectDir = Target.ProjectFile != null ? Target.ProjectFile.Directory : null;
+		ConfigHierarchy EngineIni = ConfigCache.ReadHierarchy(ConfigHierarchyType.Engine, ProjectDir, Target.Platform);
+		bool bDoublePrecision = false;
+		return EngineIni.GetBool("JoltPhysics.Build", "bDoublePrecision", out bDoublePrecision) && bDoublePrecision;
+	}
+	
 	public static string GetJoltBuildDir(string ModuleDirectory, ReadOnlyTargetRules Target)
 	{
 		string configFolder = "lib";
@@ -377,6 +406,12 @@ public class MBuildUtils {
 				break;
 		}
 
+		// Single and double precision libraries are not link compatible, keep them apart so switching rebuilds
+		if (UseDoublePrecision(Target))
+		{
+			configFolder += "-double";
+		}
+
 		if (Target.Platform == UnrealTargetPlatform.Win64)
 		{
 			return Path.Combine(ModuleDirectory, configFolder, "Win64");